@@ -0,0 +1,60 @@
+; @file Test_Scroll_Down.asm
+; Scroll down the sprites drawn on the display top corners, then check with collisions that the rows uncovered at the display top are empty (including the top-left corner pixels, which are stored in the frame buffer first byte). The test is done on the 64x32 display, then on the 128x64 display.
+; @author Adrien RICCIARDI
+
+; Private variables
+define Row V0
+define Left_Column V1
+define Right_Column V2
+define Error_Digit V3
+
+	; Entry point, fill the 8 top rows of both 64x32 display corners
+	CLS
+	LD Row, 0
+	LD Left_Column, 0
+	LD Right_Column, 56
+	LD I, Sprite
+	DRW Left_Column, Row, 8
+	DRW Right_Column, Row, 8
+
+	; Move the sprites down, the uncovered rows must be cleared
+	SCD 4
+	CALL Check_Top_Rows
+
+	; Do the same on the 128x64 display
+	HIGH
+	CLS
+	LD Right_Column, 120
+	LD I, Sprite
+	DRW Left_Column, Row, 8
+	DRW Right_Column, Row, 8
+	SCD 4
+	CALL Check_Top_Rows
+
+Infinite_Loop:
+	JP Infinite_Loop
+
+	; Draw a 2-row line on both top corners, it must not collide with anything, then erase the line
+Check_Top_Rows:
+	LD I, Sprite
+	DRW Left_Column, Row, 2
+	SE VF, 0
+	JP Scroll_Error
+	DRW Left_Column, Row, 2
+	DRW Right_Column, Row, 2
+	SE VF, 0
+	JP Scroll_Error
+	DRW Right_Column, Row, 2
+	RET
+
+	; Display a 'E' on the display left side
+Scroll_Error:
+	LD Row, 16
+	LD Left_Column, 0
+	LD Error_Digit, #0E
+	LD F, Error_Digit
+	DRW Left_Column, Row, 5
+	JP Infinite_Loop
+
+Sprite:
+db #FF, #FF, #FF, #FF, #FF, #FF, #FF, #FF
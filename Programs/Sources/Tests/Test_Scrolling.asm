@@ -0,0 +1,82 @@
+; @file Test_Scrolling.asm
+; Scroll a 64x32 picture and a 128x64 picture in all Super-Chip directions, then keep scrolling the 128x64 picture to the left and to the right to measure the scrolling speed.
+; @author Adrien RICCIARDI
+
+; Private variables
+define Row V0
+define Column V1
+define Digit V2
+define Delay V3
+
+	; Entry point, draw the 16 small digits on two lines of the 64x32 display
+	LD Row, 4
+	LD Column, 0
+	LD Digit, 0
+Draw_Small_Digit:
+	LD F, Digit
+	DRW Column, Row, 5
+	ADD Column, 8
+	SE Column, 64 ; Was the last displaying column reached ?
+	JP Next_Small_Digit
+	; Yes, go to second displaying row
+	ADD Row, 8
+	LD Column, 0
+Next_Small_Digit:
+	ADD Digit, 1
+	SE Digit, 16 ; Is the last digit displayed ?
+	JP Draw_Small_Digit
+
+	; Move the picture, the pixels crossing the display edges are lost
+	SCR
+	SCR
+	SCL
+	SCD 3
+	CALL Wait
+
+	; Draw the 10 big digits on two lines of the 128x64 display
+	HIGH
+	CLS
+	LD Row, 8
+	LD Column, 8
+	LD Digit, 0
+Draw_Big_Digit:
+	LD HF, Digit
+	DRW Column, Row, 10
+	ADD Column, 24
+	SE Column, 128 ; Was the last displaying column reached ?
+	JP Next_Big_Digit
+	; Yes, go to second displaying row
+	ADD Row, 24
+	LD Column, 8
+Next_Big_Digit:
+	ADD Digit, 1
+	SE Digit, 10 ; Is the last digit displayed ?
+	JP Draw_Big_Digit
+
+	; Move the picture
+	SCL
+	SCL
+	SCR
+	SCD 5
+	CALL Wait
+
+	; Keep scrolling the picture, it stays in place once the columns on the display edges have been cleared
+Scroll_Loop:
+	SCR
+	SCL
+	SCL
+	SCR
+	; Display the scrolled picture, drawing the same sprite twice leaves the picture unchanged
+	DRW Column, Row, 10
+	DRW Column, Row, 10
+	JP Scroll_Loop
+
+	; Let the picture be displayed for a while
+Wait:
+	LD Delay, 200
+	LD DT, Delay
+Wait_Loop:
+	LD Delay, DT
+	SE Delay, 0 ; Is the delay elapsed ?
+	JP Wait_Loop
+	RET
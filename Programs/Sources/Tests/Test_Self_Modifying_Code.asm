@@ -0,0 +1,110 @@
+; @file Test_Self_Modifying_Code.asm
+; Execute some instructions, overwrite some of their bytes with the LD [I], Vx and LD B, Vx instructions, then execute them again to check that the modified instructions are executed.
+; Each instruction group is executed a first time before being modified, so an interpreter keeping the decoded instructions must discard them when one of their bytes is written.
+; The second byte of an instruction is modified, then the third and the fourth bytes of a pair of instructions (some interpreters execute such pairs as a single instruction).
+; The modified instructions are located at odd addresses, so their bytes are not all in the same 2-byte word (an interpreter indexing its decoded instructions by word must also discard the previous words).
+; The number of each successful test is displayed on the first row, a 'E' is displayed on the second row when a test fails.
+; @author Adrien RICCIARDI
+
+; Private variables
+define Value V0
+define Offset V9
+define Digit VA
+define Column VB
+define Row VC
+
+	; Entry point
+	CLS
+	LD Column, 0
+	LD Row, 0
+
+	; Test 1 : modify the immediate value of a single instruction (its second byte)
+	CALL Instruction_1
+	LD I, Instruction_1
+	LD Offset, 1
+	ADD I, Offset
+	LD Value, #22
+	LD [I], Value
+	CALL Instruction_1
+	SE V1, #22
+	JP Test_Error
+	LD Digit, 1
+	CALL Display_Digit
+
+	; Test 2 : modify the immediate value of the second instruction of a pair (the pair fourth byte)
+	CALL Instructions_2
+	LD I, Instructions_2
+	LD Offset, 3
+	ADD I, Offset
+	LD Value, #44
+	LD [I], Value
+	CALL Instructions_2
+	SE V3, #44
+	JP Test_Error
+	LD Digit, 2
+	CALL Display_Digit
+
+	; Test 3 : modify the register of the second instruction of a pair (the pair third byte), the LD V5, #55 instruction becomes LD V6, #55
+	LD V6, 0
+	CALL Instructions_3
+	LD I, Instructions_3
+	LD Offset, 2
+	ADD I, Offset
+	LD Value, #66
+	LD [I], Value
+	CALL Instructions_3
+	SE V6, #55
+	JP Test_Error
+	LD Digit, 3
+	CALL Display_Digit
+
+	; Test 4 : write the 3 decimal digits of 123 from the second byte of a skip followed by a jump, the skip becomes SE V7, 1 and the jump becomes an instruction that must be skipped
+	LD V7, #55
+	CALL Instructions_4
+	LD I, Instructions_4
+	LD Offset, 1
+	ADD I, Offset
+	LD V8, 123
+	LD B, V8
+	LD V7, 1
+	CALL Instructions_4
+	LD Digit, 4
+	CALL Display_Digit
+
+Infinite_Loop:
+	JP Infinite_Loop
+
+	; Display a 'E' on the second row
+Test_Error:
+	LD Row, 8
+	LD Digit, #0E
+	CALL Display_Digit
+	JP Infinite_Loop
+
+	; Draw the digit stored in Digit at the next column of the current row
+Display_Digit:
+	LD F, Digit
+	DRW Column, Row, 5
+	ADD Column, 6
+	RET
+
+	; The instructions modified by the tests, starting at an odd address
+db #00
+Instruction_1:
+	LD V1, #11
+	RET
+
+Instructions_2:
+	LD V2, #11
+	LD V3, #33
+	RET
+
+Instructions_3:
+	LD V4, #11
+	LD V5, #55
+	RET
+
+Instructions_4:
+	SE V7, #55
+	JP Test_Error
+	RET
@@ -0,0 +1,564 @@
+/** @file Display_Test.c
+ * Check on the host that the display conversion kernels send the same pixels than the previous bit by bit kernels, then compare their speed. The display controller is emulated from the SPI bytes the kernels send, so the page kernels are also checked with partial transfers.
+ * @author Adrien RICCIARDI
+ */
+#include <Display.h>
+#include <EEPROM.h>
+#include <SPI.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+//-------------------------------------------------------------------------------------------------
+// Private constants
+//-------------------------------------------------------------------------------------------------
+/** How many random frames are compared for each kernel. */
+#define DISPLAY_TEST_RANDOM_FRAMES_COUNT 2000
+/** How many frames each kernel draws during the benchmark. */
+#define DISPLAY_TEST_BENCHMARK_FRAMES_COUNT 20000
+/** How many different random frames the benchmark cycles through. */
+#define DISPLAY_TEST_BENCHMARK_DIFFERENT_FRAMES_COUNT 16
+
+/** The size in bytes of a picture covering the whole display. */
+#define DISPLAY_TEST_BUFFER_SIZE (DISPLAY_COLUMNS_COUNT * DISPLAY_ROWS_COUNT / 8)
+
+/** The pixels of a dithered buffer row that were displayed by the reference kernels, the pattern is shifted by one pixel on each row (this is the same checkerboard than the column pattern of the page kernels).
+ * @param Row The row index, only its parity is used.
+ */
+#define DISPLAY_TEST_REFERENCE_DITHERING_PATTERN(Row) (((Row) & 1) ? 0x55 : 0xAA)
+
+//-------------------------------------------------------------------------------------------------
+// Public variables
+//-------------------------------------------------------------------------------------------------
+THostLATBbits LATBbits;
+THostLATCbits LATCbits;
+THostSPI1CON2bits SPI1CON2bits;
+unsigned char ANSELB;
+unsigned char TRISB;
+
+//-------------------------------------------------------------------------------------------------
+// Private variables
+//-------------------------------------------------------------------------------------------------
+/** The emulated display controller memory, it uses the page layout. */
+static unsigned char Display_Test_Memory[DISPLAY_ROWS_COUNT / 8][DISPLAY_COLUMNS_COUNT];
+/** The address window set by the "Set Column Address" and "Set Page Address" commands. */
+static unsigned char Display_Test_Window_First_Column, Display_Test_Window_Last_Column, Display_Test_Window_First_Page, Display_Test_Window_Last_Page;
+/** The display memory location written by the next data byte. */
+static unsigned char Display_Test_Column, Display_Test_Page;
+
+/** The command waiting for its parameters, its first byte is the command code. */
+static unsigned char Display_Test_Command_Bytes[3];
+/** How many bytes of the pending command have been received. */
+static unsigned char Display_Test_Command_Bytes_Count;
+
+/** Set to 1 to discard the sent bytes instead of emulating the display controller, so the benchmark measures the kernels only. */
+static unsigned char Display_Test_Is_Benchmark_Running;
+/** The last byte sent during the benchmark, it is volatile so the compiler can't remove the kernels computations. */
+static volatile unsigned char Display_Test_Benchmark_Last_Byte;
+
+//-------------------------------------------------------------------------------------------------
+// Private functions
+//-------------------------------------------------------------------------------------------------
+/** Tell how many parameter bytes follow a display controller command.
+ * @param Command The command code.
+ * @return The parameters count.
+ */
+static unsigned char DisplayTestGetCommandParametersCount(unsigned char Command)
+{
+	switch (Command)
+	{
+		// Set Memory Addressing Mode, Set Contrast Control
+		case 0x20:
+		case 0x81:
+			return 1;
+
+		// Set Column Address, Set Page Address
+		case 0x21:
+		case 0x22:
+			return 2;
+
+		default:
+			return 0;
+	}
+}
+
+/** Emulate the display controller reception of a byte, according to the D/C pin.
+ * @param Byte The received byte.
+ */
+static void DisplayTestReceiveByte(unsigned char Byte)
+{
+	if (Display_Test_Is_Benchmark_Running)
+	{
+		Display_Test_Benchmark_Last_Byte = Byte;
+		return;
+	}
+
+	// Write the data bytes to the memory with the horizontal addressing mode, the address wraps around the window
+	if (LATBbits.LATB2)
+	{
+		Display_Test_Memory[Display_Test_Page][Display_Test_Column] = Byte;
+		if (Display_Test_Column < Display_Test_Window_Last_Column) Display_Test_Column++;
+		else
+		{
+			Display_Test_Column = Display_Test_Window_First_Column;
+			if (Display_Test_Page < Display_Test_Window_Last_Page) Display_Test_Page++;
+			else Display_Test_Page = Display_Test_Window_First_Page;
+		}
+		return;
+	}
+
+	// Wait for all the command parameters
+	Display_Test_Command_Bytes[Display_Test_Command_Bytes_Count] = Byte;
+	Display_Test_Command_Bytes_Count++;
+	if (Display_Test_Command_Bytes_Count <= DisplayTestGetCommandParametersCount(Display_Test_Command_Bytes[0])) return;
+	Display_Test_Command_Bytes_Count = 0;
+
+	// Only the addressing commands change the memory content, the other commands are ignored
+	if (Display_Test_Command_Bytes[0] == 0x21)
+	{
+		Display_Test_Window_First_Column = Display_Test_Command_Bytes[1];
+		Display_Test_Window_Last_Column = Display_Test_Command_Bytes[2];
+		Display_Test_Column = Display_Test_Window_First_Column;
+	}
+	else if (Display_Test_Command_Bytes[0] == 0x22)
+	{
+		Display_Test_Window_First_Page = Display_Test_Command_Bytes[1];
+		Display_Test_Window_Last_Page = Display_Test_Command_Bytes[2];
+		Display_Test_Page = Display_Test_Window_First_Page;
+	}
+}
+
+/** Select the whole display memory and write from its beginning, as the reference kernels expected. */
+static void DisplayTestResetAddressWindow(void)
+{
+	Display_Test_Window_First_Column = 0;
+	Display_Test_Window_Last_Column = DISPLAY_COLUMNS_COUNT - 1;
+	Display_Test_Window_First_Page = 0;
+	Display_Test_Window_Last_Page = (DISPLAY_ROWS_COUNT / 8) - 1;
+	Display_Test_Column = 0;
+	Display_Test_Page = 0;
+}
+
+/** The previous Chip-8 frame buffer kernel, it converted a row by row buffer pixel by pixel.
+ * @param Pointer_Buffer The Chip-8 frame buffer (64x32 pixels), each byte holding 8 horizontal pixels.
+ * @param Pointer_Dithered_Buffer An optional second frame buffer with the same layout, set to NULL to display only the first buffer.
+ */
+static void DisplayTestDrawReferenceHalfSizeBuffer(void *Pointer_Buffer, void *Pointer_Dithered_Buffer)
+{
+	unsigned char Row, Column, *Pointer_Buffer_Bytes = Pointer_Buffer, *Pointer_Dithered_Buffer_Bytes = Pointer_Dithered_Buffer, Display_Byte, i, j, Frame_Buffer_Chunk[4], *Pointer_Frame_Buffer_Chunk;
+
+	SPI_SELECT_DISPLAY();
+
+	// Convert a chunk of 32 pixels (8x4 pixels) at a time, outputting 64 pixels (8x8 pixels)
+	for (Row = 0; Row < DISPLAY_ROWS_COUNT / 2; Row += 4) // Load a chunk of 4 vertical bytes, so increment the row per 4
+	{
+		for (Column = 0; Column < (DISPLAY_COLUMNS_COUNT / 2) / 8; Column++) // There are 8 horizontal pixels per byte in the local frame buffer
+		{
+			// Load the 8 frame buffer horizontal bytes needed to create 16 vertical display buffer bytes (pixels are doubled)
+			Pointer_Frame_Buffer_Chunk = Pointer_Buffer_Bytes;
+			for (i = 0; i < 4; i++)
+			{
+				Frame_Buffer_Chunk[i] = *Pointer_Frame_Buffer_Chunk;
+				Pointer_Frame_Buffer_Chunk += (DISPLAY_COLUMNS_COUNT / 2) / 8; // Go to the next bytes row
+			}
+			// Merge the dithered buffer pixels, the pattern is shifted by one pixel on each row to make a checkerboard
+			if (Pointer_Dithered_Buffer_Bytes != NULL)
+			{
+				Pointer_Frame_Buffer_Chunk = Pointer_Dithered_Buffer_Bytes;
+				for (i = 0; i < 4; i++)
+				{
+					Frame_Buffer_Chunk[i] |= *Pointer_Frame_Buffer_Chunk & DISPLAY_TEST_REFERENCE_DITHERING_PATTERN(i);
+					Pointer_Frame_Buffer_Chunk += (DISPLAY_COLUMNS_COUNT / 2) / 8;
+				}
+			}
+			// When the end of the row is reached, go to the next 8-byte chunk
+			if (Column == ((DISPLAY_COLUMNS_COUNT / 2) / 8) - 1)
+			{
+				Pointer_Buffer_Bytes += (3 * ((DISPLAY_COLUMNS_COUNT / 2) / 8)) + 1; // Add 1 to terminate the row, then add 3 more rows to finally reach the 4 next rows
+				if (Pointer_Dithered_Buffer_Bytes != NULL) Pointer_Dithered_Buffer_Bytes += (3 * ((DISPLAY_COLUMNS_COUNT / 2) / 8)) + 1;
+			}
+			else
+			{
+				Pointer_Buffer_Bytes++;
+				if (Pointer_Dithered_Buffer_Bytes != NULL) Pointer_Dithered_Buffer_Bytes++;
+			}
+
+			// Convert the frame buffer horizontal pixels to display controller expected vertical ones, also double the output pixels by a simple 2x scaling
+			for (j = 0; j < 8; j++)
+			{
+				Display_Byte = 0;
+				for (i = 0; i < 4; i++)
+				{
+					// The most significant bit of the display buffer is displayed starting from the display bottom
+					if (Frame_Buffer_Chunk[i] & 0x80) Display_Byte |= 0xC0; // Double the pixel vertically if the pixel is lit
+					if (i < 3) Display_Byte >>= 2; // Append each pixel the to most significant bit of the byte, and do not shift the last time or the initial bit would be lost
+
+					// Put the next buffer pixel bit to check to the most significant location
+					Frame_Buffer_Chunk[i] <<= 1;
+				}
+
+				// The horizontal 8 pixels are ready to be displayed, write the byte twice to double the pixels horizontally
+				SPIWriteByte(Display_Byte);
+				SPIWriteByte(Display_Byte);
+			}
+		}
+	}
+
+	SPI_DESELECT_DISPLAY();
+}
+
+/** The previous SuperChip-8 frame buffer and row by row picture kernel, it converted a row by row buffer pixel by pixel.
+ * @param Pointer_Buffer The SuperChip-8 frame buffer or the picture (128x64 pixels), each byte holding 8 horizontal pixels.
+ * @param Pointer_Dithered_Buffer An optional second frame buffer with the same layout, set to NULL to display only the first buffer.
+ */
+static void DisplayTestDrawReferenceFullSizeBuffer(void *Pointer_Buffer, void *Pointer_Dithered_Buffer)
+{
+	unsigned char Row, Column, *Pointer_Buffer_Bytes = Pointer_Buffer, *Pointer_Dithered_Buffer_Bytes = Pointer_Dithered_Buffer, Display_Byte, i, j, Frame_Buffer_Chunk[8], *Pointer_Frame_Buffer_Chunk;
+
+	SPI_SELECT_DISPLAY();
+
+	// Convert and display a chunk of 64 pixels (8x8 pixels) at a time
+	for (Row = 0; Row < DISPLAY_ROWS_COUNT; Row += 8) // Load a chunk of 8 vertical bytes, so increment the row per 8
+	{
+		for (Column = 0; Column < DISPLAY_COLUMNS_COUNT / 8; Column++) // There are 8 horizontal pixels per byte in the local frame buffer
+		{
+			// Load the 8 frame buffer horizontal bytes needed to create 8 vertical display buffer bytes
+			Pointer_Frame_Buffer_Chunk = Pointer_Buffer_Bytes;
+			for (i = 0; i < 8; i++)
+			{
+				Frame_Buffer_Chunk[i] = *Pointer_Frame_Buffer_Chunk;
+				Pointer_Frame_Buffer_Chunk += DISPLAY_COLUMNS_COUNT / 8; // Go to the next bytes row
+			}
+			// Merge the dithered buffer pixels, the pattern is shifted by one pixel on each row to make a checkerboard
+			if (Pointer_Dithered_Buffer_Bytes != NULL)
+			{
+				Pointer_Frame_Buffer_Chunk = Pointer_Dithered_Buffer_Bytes;
+				for (i = 0; i < 8; i++)
+				{
+					Frame_Buffer_Chunk[i] |= *Pointer_Frame_Buffer_Chunk & DISPLAY_TEST_REFERENCE_DITHERING_PATTERN(i);
+					Pointer_Frame_Buffer_Chunk += DISPLAY_COLUMNS_COUNT / 8;
+				}
+			}
+			// When the end of the row is reached, go to the next 8-byte chunk
+			if (Column == (DISPLAY_COLUMNS_COUNT / 8) - 1)
+			{
+				Pointer_Buffer_Bytes += (7 * (DISPLAY_COLUMNS_COUNT / 8)) + 1; // Add 1 to terminate the row, then add 7 more rows to finally reach the 8 next rows
+				if (Pointer_Dithered_Buffer_Bytes != NULL) Pointer_Dithered_Buffer_Bytes += (7 * (DISPLAY_COLUMNS_COUNT / 8)) + 1;
+			}
+			else
+			{
+				Pointer_Buffer_Bytes++;
+				if (Pointer_Dithered_Buffer_Bytes != NULL) Pointer_Dithered_Buffer_Bytes++;
+			}
+
+			// Convert the frame buffer horizontal pixels to display controller expected vertical ones
+			for (j = 0; j < 8; j++)
+			{
+				Display_Byte = 0;
+				for (i = 0; i < 8; i++)
+				{
+					if (Frame_Buffer_Chunk[i] & 0x80) Display_Byte |= 0x80; // The most significant bit of the display buffer is displayed starting from the display bottom
+					if (i < 7) Display_Byte >>= 1; // Append each pixel the to most significant bit of the byte, and do not shift the last time or the initial bit would be lost
+
+					// Put the next pixel bit to check to the most significant location
+					Frame_Buffer_Chunk[i] <<= 1;
+				}
+
+				// The horizontal 8 pixels are ready to be displayed
+				SPIWriteByte(Display_Byte);
+			}
+		}
+	}
+
+	SPI_DESELECT_DISPLAY();
+}
+
+/** Convert a page layout frame buffer to the row by row layout the reference kernels use.
+ * @param Pointer_Page_Buffer The frame buffer with 8 vertical pixels per byte (the top one in the least significant bit).
+ * @param Pointer_Row_Buffer On output, the frame buffer with 8 horizontal pixels per byte (the leftmost one in the most significant bit).
+ * @param Columns_Count The frame buffer width in pixels.
+ * @param Rows_Count The frame buffer height in pixels.
+ */
+static void DisplayTestConvertPagesToRows(const unsigned char *Pointer_Page_Buffer, unsigned char *Pointer_Row_Buffer, unsigned char Columns_Count, unsigned char Rows_Count)
+{
+	unsigned char Row, Column;
+
+	memset(Pointer_Row_Buffer, 0, Columns_Count * Rows_Count / 8);
+	for (Row = 0; Row < Rows_Count; Row++)
+	{
+		for (Column = 0; Column < Columns_Count; Column++)
+		{
+			if (Pointer_Page_Buffer[(Row / 8) * Columns_Count + Column] & (1 << (Row % 8))) Pointer_Row_Buffer[Row * (Columns_Count / 8) + Column / 8] |= 0x80 >> (Column % 8);
+		}
+	}
+}
+
+/** Fill a buffer with random pixels.
+ * @param Pointer_Buffer The buffer.
+ * @param Size The buffer size in bytes.
+ */
+static void DisplayTestFillRandomBuffer(unsigned char *Pointer_Buffer, unsigned short Size)
+{
+	unsigned short i;
+
+	for (i = 0; i < Size; i++) Pointer_Buffer[i] = (unsigned char) rand();
+}
+
+/** Tell where the display memory differs from a previously saved content.
+ * @param Pointer_Saved_Memory The saved display memory.
+ * @param Pointer_String_Kernel_Name The tested kernel name, it is displayed on mismatch.
+ * @param Frame_Index The tested frame, it is displayed on mismatch.
+ * @return 0 if the memories are identical,
+ * @return 1 if they differ.
+ */
+static unsigned char DisplayTestCompareMemory(unsigned char Pointer_Saved_Memory[][DISPLAY_COLUMNS_COUNT], const char *Pointer_String_Kernel_Name, unsigned short Frame_Index)
+{
+	unsigned char Page, Column;
+
+	for (Page = 0; Page < DISPLAY_ROWS_COUNT / 8; Page++)
+	{
+		for (Column = 0; Column < DISPLAY_COLUMNS_COUNT; Column++)
+		{
+			if (Pointer_Saved_Memory[Page][Column] != Display_Test_Memory[Page][Column])
+			{
+				printf("FAIL %s : frame %u differs at page %u column %u (got 0x%02X instead of 0x%02X)\n", Pointer_String_Kernel_Name, Frame_Index, Page, Column, Pointer_Saved_Memory[Page][Column], Display_Test_Memory[Page][Column]);
+				return 1;
+			}
+		}
+	}
+	return 0;
+}
+
+/** Draw random row by row pictures with DisplayDrawFullSizeBuffer() and with the reference kernel, then compare the display memory.
+ * @return 0 if the kernels always displayed the same pixels,
+ * @return 1 if a picture was displayed differently.
+ */
+static unsigned char DisplayTestCheckRowBufferKernel(void)
+{
+	static unsigned char Buffer[DISPLAY_TEST_BUFFER_SIZE], Saved_Memory[DISPLAY_ROWS_COUNT / 8][DISPLAY_COLUMNS_COUNT];
+	unsigned short Frame_Index;
+
+	for (Frame_Index = 0; Frame_Index < DISPLAY_TEST_RANDOM_FRAMES_COUNT; Frame_Index++)
+	{
+		// Also check a fully lit picture
+		if (Frame_Index == 0) memset(Buffer, 0xFF, sizeof(Buffer));
+		else DisplayTestFillRandomBuffer(Buffer, sizeof(Buffer));
+
+		// The kernel must write the whole display memory
+		DisplayTestFillRandomBuffer(&Display_Test_Memory[0][0], sizeof(Display_Test_Memory));
+		DisplayDrawFullSizeBuffer(Buffer);
+		memcpy(Saved_Memory, Display_Test_Memory, sizeof(Saved_Memory));
+
+		DisplayTestResetAddressWindow();
+		DisplayTestDrawReferenceFullSizeBuffer(Buffer, NULL);
+		if (DisplayTestCompareMemory(Saved_Memory, "row by row picture", Frame_Index) != 0) return 1;
+	}
+
+	printf("PASS row by row picture (%u frames)\n", DISPLAY_TEST_RANDOM_FRAMES_COUNT);
+	return 0;
+}
+
+/** Change random columns of a page buffer and of its dithered buffer, and tell which columns changed.
+ * @param Pointer_Buffer The frame buffer.
+ * @param Pointer_Dithered_Buffer The dithered frame buffer, or NULL if there is none.
+ * @param Pointer_Dirty_Pages On output, the changed columns of each page.
+ * @param Columns_Count The frame buffer width in pixels.
+ * @param Pages_Count The frame buffer height in pages.
+ * @param Is_Whole_Buffer_Changed Set to 1 to change all columns, set to 0 to change random columns.
+ */
+static void DisplayTestChangePageBuffer(unsigned char *Pointer_Buffer, unsigned char *Pointer_Dithered_Buffer, TDisplayDirtyColumns *Pointer_Dirty_Pages, unsigned char Columns_Count, unsigned char Pages_Count, unsigned char Is_Whole_Buffer_Changed)
+{
+	unsigned char Page, First_Column, Last_Column, Column;
+
+	for (Page = 0; Page < Pages_Count; Page++)
+	{
+		if (Is_Whole_Buffer_Changed)
+		{
+			First_Column = 0;
+			Last_Column = Columns_Count - 1;
+		}
+		// Leave about one page out of three unchanged, so the kernels also skip pages and group the consecutive pages having the same changed columns
+		else if ((rand() % 3) == 0)
+		{
+			Pointer_Dirty_Pages[Page].First_Column = 0xFF;
+			Pointer_Dirty_Pages[Page].Last_Column = 0;
+			continue;
+		}
+		else if ((Page > 0) && (Pointer_Dirty_Pages[Page - 1].First_Column <= Pointer_Dirty_Pages[Page - 1].Last_Column) && ((rand() % 2) == 0))
+		{
+			First_Column = Pointer_Dirty_Pages[Page - 1].First_Column;
+			Last_Column = Pointer_Dirty_Pages[Page - 1].Last_Column;
+		}
+		else
+		{
+			First_Column = rand() % Columns_Count;
+			Last_Column = First_Column + rand() % (Columns_Count - First_Column);
+		}
+
+		Pointer_Dirty_Pages[Page].First_Column = First_Column;
+		Pointer_Dirty_Pages[Page].Last_Column = Last_Column;
+		for (Column = First_Column; Column <= Last_Column; Column++)
+		{
+			Pointer_Buffer[Page * Columns_Count + Column] = (unsigned char) rand();
+			if (Pointer_Dithered_Buffer != NULL) Pointer_Dithered_Buffer[Page * Columns_Count + Column] = (unsigned char) rand();
+		}
+	}
+}
+
+/** Draw random frame buffer changes with a page kernel and the whole frame buffer with its reference kernel, then compare the display memory.
+ * @param Is_Half_Size Set to 1 to check DisplayDrawHalfSizePageBuffer(), set to 0 to check DisplayDrawFullSizePageBuffer().
+ * @param Is_Dithered Set to 1 to display a dithered second frame buffer, set to 0 to display only the first frame buffer.
+ * @return 0 if the kernels always displayed the same pixels,
+ * @return 1 if a frame was displayed differently.
+ */
+static unsigned char DisplayTestCheckPageBufferKernel(unsigned char Is_Half_Size, unsigned char Is_Dithered)
+{
+	static unsigned char Buffer[DISPLAY_TEST_BUFFER_SIZE], Dithered_Buffer[DISPLAY_TEST_BUFFER_SIZE], Row_Buffer[DISPLAY_TEST_BUFFER_SIZE], Dithered_Row_Buffer[DISPLAY_TEST_BUFFER_SIZE], Saved_Memory[DISPLAY_ROWS_COUNT / 8][DISPLAY_COLUMNS_COUNT];
+	TDisplayDirtyColumns Dirty_Pages[DISPLAY_ROWS_COUNT / 8];
+	unsigned char Columns_Count, Rows_Count, *Pointer_Dithered_Buffer, *Pointer_Dithered_Row_Buffer;
+	unsigned short Frame_Index;
+	char String_Kernel_Name[64];
+
+	Columns_Count = Is_Half_Size ? DISPLAY_COLUMNS_COUNT / 2 : DISPLAY_COLUMNS_COUNT;
+	Rows_Count = Is_Half_Size ? DISPLAY_ROWS_COUNT / 2 : DISPLAY_ROWS_COUNT;
+	Pointer_Dithered_Buffer = Is_Dithered ? Dithered_Buffer : NULL;
+	Pointer_Dithered_Row_Buffer = Is_Dithered ? Dithered_Row_Buffer : NULL;
+	snprintf(String_Kernel_Name, sizeof(String_Kernel_Name), "%s page buffer%s", Is_Half_Size ? "half size" : "full size", Is_Dithered ? " with dithered plane" : "");
+
+	for (Frame_Index = 0; Frame_Index < DISPLAY_TEST_RANDOM_FRAMES_COUNT; Frame_Index++)
+	{
+		// The first frame is entirely sent, the next ones only send their changes over the previous frame
+		DisplayTestChangePageBuffer(Buffer, Pointer_Dithered_Buffer, Dirty_Pages, Columns_Count, Rows_Count / 8, Frame_Index == 0);
+		if (Frame_Index == 0) DisplayTestFillRandomBuffer(&Display_Test_Memory[0][0], sizeof(Display_Test_Memory));
+		if (Is_Half_Size) DisplayDrawHalfSizePageBuffer(Buffer, Pointer_Dithered_Buffer, Dirty_Pages);
+		else DisplayDrawFullSizePageBuffer(Buffer, Pointer_Dithered_Buffer, Dirty_Pages);
+		memcpy(Saved_Memory, Display_Test_Memory, sizeof(Saved_Memory));
+
+		// The reference kernels always send the whole frame buffer
+		DisplayTestConvertPagesToRows(Buffer, Row_Buffer, Columns_Count, Rows_Count);
+		if (Is_Dithered) DisplayTestConvertPagesToRows(Dithered_Buffer, Dithered_Row_Buffer, Columns_Count, Rows_Count);
+		DisplayTestResetAddressWindow();
+		if (Is_Half_Size) DisplayTestDrawReferenceHalfSizeBuffer(Row_Buffer, Pointer_Dithered_Row_Buffer);
+		else DisplayTestDrawReferenceFullSizeBuffer(Row_Buffer, Pointer_Dithered_Row_Buffer);
+		if (DisplayTestCompareMemory(Saved_Memory, String_Kernel_Name, Frame_Index) != 0) return 1;
+	}
+
+	printf("PASS %s (%u frames)\n", String_Kernel_Name, DISPLAY_TEST_RANDOM_FRAMES_COUNT);
+	return 0;
+}
+
+/** Get the monotonic time.
+ * @return The time in nanoseconds.
+ */
+static unsigned long long DisplayTestReadTime(void)
+{
+	struct timespec Time;
+
+	clock_gettime(CLOCK_MONOTONIC, &Time);
+	return (unsigned long long) Time.tv_sec * 1000000000ULL + Time.tv_nsec;
+}
+
+/** Measure how long a kernel and its reference kernel take to draw random whole frames, the sent bytes are discarded.
+ * @param Kernel_Index 0 for the row by row picture kernel, 1 for the half size page kernel, 2 for the full size page kernel (both page kernels display a dithered plane).
+ */
+static void DisplayTestBenchmarkKernel(unsigned char Kernel_Index)
+{
+	static const char *Pointer_String_Kernel_Names[] = { "row by row picture", "half size page buffer with dithered plane", "full size page buffer with dithered plane" };
+	static unsigned char Buffers[DISPLAY_TEST_BENCHMARK_DIFFERENT_FRAMES_COUNT][2][DISPLAY_TEST_BUFFER_SIZE];
+	TDisplayDirtyColumns Dirty_Pages[DISPLAY_ROWS_COUNT / 8];
+	unsigned long long Start_Time, Kernel_Time, Reference_Time;
+	unsigned short i;
+	unsigned char *Pointer_Buffer, *Pointer_Dithered_Buffer, Columns_Count;
+
+	DisplayTestFillRandomBuffer(&Buffers[0][0][0], sizeof(Buffers));
+	Columns_Count = (Kernel_Index == 1) ? DISPLAY_COLUMNS_COUNT / 2 : DISPLAY_COLUMNS_COUNT;
+	for (i = 0; i < DISPLAY_ROWS_COUNT / 8; i++)
+	{
+		Dirty_Pages[i].First_Column = 0;
+		Dirty_Pages[i].Last_Column = Columns_Count - 1;
+	}
+
+	Display_Test_Is_Benchmark_Running = 1;
+
+	Start_Time = DisplayTestReadTime();
+	for (i = 0; i < DISPLAY_TEST_BENCHMARK_FRAMES_COUNT; i++)
+	{
+		Pointer_Buffer = Buffers[i % DISPLAY_TEST_BENCHMARK_DIFFERENT_FRAMES_COUNT][0];
+		Pointer_Dithered_Buffer = Buffers[i % DISPLAY_TEST_BENCHMARK_DIFFERENT_FRAMES_COUNT][1];
+		if (Kernel_Index == 0) DisplayDrawFullSizeBuffer(Pointer_Buffer);
+		else if (Kernel_Index == 1) DisplayDrawHalfSizePageBuffer(Pointer_Buffer, Pointer_Dithered_Buffer, Dirty_Pages);
+		else DisplayDrawFullSizePageBuffer(Pointer_Buffer, Pointer_Dithered_Buffer, Dirty_Pages);
+	}
+	Kernel_Time = DisplayTestReadTime() - Start_Time;
+
+	// The reference kernels read the same random bytes, only their layout interpretation differs
+	Start_Time = DisplayTestReadTime();
+	for (i = 0; i < DISPLAY_TEST_BENCHMARK_FRAMES_COUNT; i++)
+	{
+		Pointer_Buffer = Buffers[i % DISPLAY_TEST_BENCHMARK_DIFFERENT_FRAMES_COUNT][0];
+		Pointer_Dithered_Buffer = Buffers[i % DISPLAY_TEST_BENCHMARK_DIFFERENT_FRAMES_COUNT][1];
+		if (Kernel_Index == 0) DisplayTestDrawReferenceFullSizeBuffer(Pointer_Buffer, NULL);
+		else if (Kernel_Index == 1) DisplayTestDrawReferenceHalfSizeBuffer(Pointer_Buffer, Pointer_Dithered_Buffer);
+		else DisplayTestDrawReferenceFullSizeBuffer(Pointer_Buffer, Pointer_Dithered_Buffer);
+	}
+	Reference_Time = DisplayTestReadTime() - Start_Time;
+
+	Display_Test_Is_Benchmark_Running = 0;
+
+	printf("Benchmark %s : %.2f us per frame, reference %.2f us per frame (%.1f times faster)\n", Pointer_String_Kernel_Names[Kernel_Index], Kernel_Time / 1000.0 / DISPLAY_TEST_BENCHMARK_FRAMES_COUNT, Reference_Time / 1000.0 / DISPLAY_TEST_BENCHMARK_FRAMES_COUNT, Kernel_Time > 0 ? (double) Reference_Time / Kernel_Time : 0.0);
+}
+
+//-------------------------------------------------------------------------------------------------
+// Public functions
+//-------------------------------------------------------------------------------------------------
+unsigned char SPITransferByte(unsigned char Byte)
+{
+	DisplayTestReceiveByte(Byte);
+	return 0;
+}
+
+void SPIWriteByte(unsigned char Byte)
+{
+	DisplayTestReceiveByte(Byte);
+}
+
+unsigned char EEPROMReadByte(unsigned short __attribute__((unused)) Address)
+{
+	return 0x7F;
+}
+
+void EEPROMWriteByte(unsigned short __attribute__((unused)) Address, unsigned char __attribute__((unused)) Value)
+{
+}
+
+//-------------------------------------------------------------------------------------------------
+// Entry point
+//-------------------------------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+	unsigned char Failures_Count = 0, Is_Half_Size, Is_Dithered, Kernel_Index;
+
+	// Allow to reproduce a run with another random seed
+	if (argc > 2)
+	{
+		printf("Usage : %s [Random_Seed]\n", argv[0]);
+		return EXIT_FAILURE;
+	}
+	if (argc == 2) srand((unsigned int) strtoul(argv[1], NULL, 0));
+	else srand(1);
+
+	// The data bytes are sent with the D/C pin in data mode
+	LATBbits.LATB2 = 1;
+
+	Failures_Count += DisplayTestCheckRowBufferKernel();
+	for (Is_Half_Size = 0; Is_Half_Size < 2; Is_Half_Size++)
+	{
+		for (Is_Dithered = 0; Is_Dithered < 2; Is_Dithered++) Failures_Count += DisplayTestCheckPageBufferKernel(Is_Half_Size, Is_Dithered);
+	}
+
+	for (Kernel_Index = 0; Kernel_Index < 3; Kernel_Index++) DisplayTestBenchmarkKernel(Kernel_Index);
+
+	if (Failures_Count > 0) return EXIT_FAILURE;
+	return EXIT_SUCCESS;
+}
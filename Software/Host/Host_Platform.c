@@ -0,0 +1,475 @@
+/** @file Host_Platform.c
+ * See Interpreter_Platform.h and Host_Platform.h for description.
+ * @author Adrien RICCIARDI
+ */
+#include <Host_Platform.h>
+#include <Interpreter.h>
+#include <Interpreter_Platform.h>
+#include <Shared_Buffer.h>
+#include <stdio.h>
+#include <time.h>
+
+//-------------------------------------------------------------------------------------------------
+// Public variables
+//-------------------------------------------------------------------------------------------------
+unsigned short Host_Platform_Menu_Key_Polls_Per_Tick = 16;
+unsigned long Host_Platform_Maximum_Ticks_Count = 3600;
+unsigned char Host_Platform_Random_Seed;
+
+THostPlatformKeyEvent Host_Platform_Key_Events[HOST_PLATFORM_MAXIMUM_KEY_EVENTS_COUNT];
+unsigned short Host_Platform_Key_Events_Count;
+
+unsigned long Host_Platform_Frame_Hash_Ticks[HOST_PLATFORM_MAXIMUM_FRAME_HASHES_COUNT];
+unsigned short Host_Platform_Frame_Hash_Ticks_Count;
+
+unsigned char Host_Platform_Is_Cost_Model_Enabled;
+unsigned long Host_Platform_Cost_Model_Display_Cycles[2];
+unsigned long Host_Platform_Cost_Model_Frames_Count;
+unsigned long Host_Platform_Cost_Model_Overrun_Frames_Count;
+
+char *Host_Platform_Pointer_String_Input_Stream_File;
+
+unsigned long Host_Platform_Ticks_Count;
+unsigned long Host_Platform_Frames_Count;
+unsigned long Host_Platform_Display_Bytes_Count;
+unsigned char Host_Platform_Is_High_Resolution_Enabled;
+unsigned char Host_Platform_Is_Second_Plane_Enabled;
+
+unsigned long Host_Platform_Trace_Hash = 2166136261UL;
+unsigned long Host_Platform_Traced_Instructions_Count;
+
+//-------------------------------------------------------------------------------------------------
+// Private variables
+//-------------------------------------------------------------------------------------------------
+/** Set to 1 when a tick elapses, like the NCO interrupt does on the console. */
+static unsigned char Host_Platform_Is_Tick_Elapsed;
+/** How many menu key checks remain before the next tick. */
+static unsigned short Host_Platform_Remaining_Menu_Key_Polls_Count;
+
+/** The virtual machine delay timer. */
+static unsigned char Host_Platform_Delay_Timer;
+
+/** The keys currently held. */
+static unsigned char Host_Platform_Keys_Mask;
+/** The next key script event to apply. */
+static unsigned short Host_Platform_Key_Event_Index;
+/** The next frame buffer hash to compute. */
+static unsigned short Host_Platform_Frame_Hash_Index;
+
+/** How many modelled cycles elapsed since the beginning of the current tick. */
+static unsigned long Host_Platform_Cost_Model_Tick_Cycles;
+/** How many modelled cycles the program used since the beginning of the current frame, the cycles spent waiting for the tick are not included. */
+static unsigned long Host_Platform_Cost_Model_Frame_Cycles;
+
+/** The opened input stream file. */
+static FILE *Host_Platform_Pointer_Input_Stream_File;
+
+/** The Super-Chip flag registers, they are not kept across runs. */
+static unsigned char Host_Platform_Flag_Registers[INTERPRETER_FLAG_REGISTERS_COUNT];
+
+//-------------------------------------------------------------------------------------------------
+// Private functions
+//-------------------------------------------------------------------------------------------------
+/** Build a byte of a plane as if the plane was stored row by row with 8 horizontal pixels per byte, the layout the frame buffer used before it followed the display controller one.
+ * @param Pointer_Plane The plane frame buffer.
+ * @param Index The byte index in the row by row layout.
+ * @return The byte value, the most significant bit being the leftmost pixel.
+ */
+static unsigned char HostPlatformGetRowMajorByte(unsigned char *Pointer_Plane, unsigned short Index)
+{
+	unsigned char Columns_Count, Row, Column, Byte = 0, i;
+
+	// The bytes past the end of a 64x32 picture still contain the last 128x64 picture bottom part, which is stored at the same location in both layouts
+	Row = InterpreterGetDisplayRowOffset();
+	if ((!Host_Platform_Is_High_Resolution_Enabled) && (Index < 64 * 32 / 8)) Columns_Count = 64;
+	else
+	{
+		Columns_Count = 128;
+		if (!Host_Platform_Is_High_Resolution_Enabled) Row = 0; // The bottom part was not scrolled by the 64x32 picture
+	}
+
+	// Hash the rows in their displayed order, so the hashes do not depend on the vertical scrolling implementation
+	Row = (Row + Index / (Columns_Count / 8)) & (Columns_Count / 2 - 1);
+	Column = (Index % (Columns_Count / 8)) * 8;
+	for (i = 0; i < 8; i++)
+	{
+		Byte <<= 1;
+		Byte |= HostPlatformIsPixelLit(Pointer_Plane, Columns_Count, Column + i, Row);
+	}
+	return Byte;
+}
+
+/** Compute the 32-bit FNV-1a hash of the whole frame buffer, followed by the XO-CHIP second plane if it is displayed. The bytes are hashed in the row by row layout, so the hashes do not depend on the frame buffer memory layout.
+ * @return The hash value.
+ */
+static unsigned long HostPlatformHashFrameBuffer(void)
+{
+	unsigned long Hash = 2166136261UL;
+	unsigned short i;
+
+	for (i = 0; i < sizeof(Shared_Buffer_Display); i++)
+	{
+		Hash ^= HostPlatformGetRowMajorByte(Shared_Buffer_Display, i);
+		Hash = (Hash * 16777619UL) & 0xFFFFFFFFUL;
+	}
+
+	// The hashes of the programs using a single plane do not depend on the second plane content
+	if (Host_Platform_Is_Second_Plane_Enabled)
+	{
+		for (i = 0; i < sizeof(Shared_Buffers.Interpreter_Display_Second_Plane); i++)
+		{
+			Hash ^= HostPlatformGetRowMajorByte(Shared_Buffers.Interpreter_Display_Second_Plane, i);
+			Hash = (Hash * 16777619UL) & 0xFFFFFFFFUL;
+		}
+	}
+	return Hash;
+}
+
+#if INTERPRETER_IS_EXECUTION_TRACE_ENABLED == 1
+	/** Add some bytes to the 32-bit FNV-1a execution trace hash.
+	 * @param Pointer_Buffer The bytes to hash.
+	 * @param Size How many bytes to hash.
+	 */
+	static void HostPlatformHashTraceBytes(const unsigned char *Pointer_Buffer, unsigned short Size)
+	{
+		unsigned long Hash = Host_Platform_Trace_Hash;
+
+		while (Size > 0)
+		{
+			Hash ^= *Pointer_Buffer;
+			Hash = (Hash * 16777619UL) & 0xFFFFFFFFUL;
+			Pointer_Buffer++;
+			Size--;
+		}
+		Host_Platform_Trace_Hash = Hash;
+	}
+#endif
+
+/** Press the keys the script tells to press at the current tick. */
+static void HostPlatformUpdateKeys(void)
+{
+	while ((Host_Platform_Key_Event_Index < Host_Platform_Key_Events_Count) && (Host_Platform_Key_Events[Host_Platform_Key_Event_Index].Tick <= Host_Platform_Ticks_Count))
+	{
+		Host_Platform_Keys_Mask = Host_Platform_Key_Events[Host_Platform_Key_Event_Index].Keys_Mask;
+		Host_Platform_Key_Event_Index++;
+	}
+}
+
+/** Do what the console NCO interrupt and the timers clocked by it do at each tick. */
+static void HostPlatformTick(void)
+{
+	Host_Platform_Ticks_Count++;
+	Host_Platform_Is_Tick_Elapsed = 1;
+	Host_Platform_Remaining_Menu_Key_Polls_Count = Host_Platform_Menu_Key_Polls_Per_Tick;
+
+	if (Host_Platform_Delay_Timer > 0) Host_Platform_Delay_Timer--;
+
+	HostPlatformUpdateKeys();
+
+	// Take a snapshot of the frame buffer when requested
+	while ((Host_Platform_Frame_Hash_Index < Host_Platform_Frame_Hash_Ticks_Count) && (Host_Platform_Frame_Hash_Ticks[Host_Platform_Frame_Hash_Index] <= Host_Platform_Ticks_Count))
+	{
+		printf("Frame hash at tick %lu : %08lX\n", Host_Platform_Frame_Hash_Ticks[Host_Platform_Frame_Hash_Index], HostPlatformHashFrameBuffer());
+		Host_Platform_Frame_Hash_Index++;
+	}
+
+	#if INTERPRETER_IS_PC_SAMPLING_ENABLED == 1
+		InterpreterSampleProgramCounter();
+	#endif
+}
+
+/** Make the time progress with the cycles the interpreter has executed since the last call. */
+static void HostPlatformCostModelUpdateTime(void)
+{
+	unsigned long Cycles;
+
+	Cycles = Interpreter_Cost_Model_Cycles_Count;
+	Interpreter_Cost_Model_Cycles_Count = 0;
+	Host_Platform_Cost_Model_Frame_Cycles += Cycles;
+	Host_Platform_Cost_Model_Tick_Cycles += Cycles;
+
+	while (Host_Platform_Cost_Model_Tick_Cycles >= HOST_PLATFORM_COST_MODEL_CYCLES_PER_TICK)
+	{
+		Host_Platform_Cost_Model_Tick_Cycles -= HOST_PLATFORM_COST_MODEL_CYCLES_PER_TICK;
+		HostPlatformTick();
+	}
+}
+
+/** Skip the remaining cycles of the current tick, like the console does when it waits in Idle mode. */
+static void HostPlatformCostModelSkipToNextTick(void)
+{
+	Host_Platform_Cost_Model_Tick_Cycles = 0;
+	HostPlatformTick();
+}
+
+//-------------------------------------------------------------------------------------------------
+// Public functions
+//-------------------------------------------------------------------------------------------------
+unsigned char HostPlatformIsPixelLit(unsigned char *Pointer_Plane, unsigned char Columns_Count, unsigned char Column, unsigned char Row)
+{
+	// A page is a band of 8 rows, each byte holds a column of the band with the top pixel in the least significant bit
+	if (Pointer_Plane[(Row / 8) * Columns_Count + Column] & (1 << (Row % 8))) return 1;
+	return 0;
+}
+
+void InterpreterPlatformInitialize(void)
+{
+	Host_Platform_Ticks_Count = 0;
+	Host_Platform_Frames_Count = 0;
+	Host_Platform_Display_Bytes_Count = 0;
+	Host_Platform_Is_High_Resolution_Enabled = 0;
+	Host_Platform_Is_Second_Plane_Enabled = 0;
+	Host_Platform_Is_Tick_Elapsed = 0;
+	Host_Platform_Remaining_Menu_Key_Polls_Count = Host_Platform_Menu_Key_Polls_Per_Tick;
+	Host_Platform_Delay_Timer = 0;
+	Host_Platform_Keys_Mask = 0;
+	Host_Platform_Key_Event_Index = 0;
+	Host_Platform_Frame_Hash_Index = 0;
+	Host_Platform_Cost_Model_Frames_Count = 0;
+	Host_Platform_Cost_Model_Overrun_Frames_Count = 0;
+	Host_Platform_Cost_Model_Tick_Cycles = 0;
+	Host_Platform_Cost_Model_Frame_Cycles = 0;
+	Interpreter_Cost_Model_Cycles_Count = 0;
+	HostPlatformUpdateKeys();
+}
+
+unsigned char InterpreterPlatformIsTickElapsed(void)
+{
+	if (Host_Platform_Is_Cost_Model_Enabled) HostPlatformCostModelUpdateTime();
+	return Host_Platform_Is_Tick_Elapsed;
+}
+
+void InterpreterPlatformClearTick(void)
+{
+	// The frame is over when an elapsed tick is consumed, check whether the console could have executed it in time
+	if (Host_Platform_Is_Cost_Model_Enabled)
+	{
+		HostPlatformCostModelUpdateTime();
+		if (!Host_Platform_Is_Tick_Elapsed) return; // The interpreter is only discarding a tick flag that is not set
+
+		Host_Platform_Cost_Model_Frames_Count++;
+		if (Host_Platform_Cost_Model_Frame_Cycles > HOST_PLATFORM_COST_MODEL_CYCLES_PER_TICK)
+		{
+			printf("Frame overrun at tick %lu : %lu cycles\n", Host_Platform_Ticks_Count, Host_Platform_Cost_Model_Frame_Cycles);
+			Host_Platform_Cost_Model_Overrun_Frames_Count++;
+		}
+		Host_Platform_Cost_Model_Frame_Cycles = 0;
+	}
+
+	Host_Platform_Is_Tick_Elapsed = 0;
+}
+
+void InterpreterPlatformWaitForTick(void)
+{
+	// Time is virtual, so there is no need to really wait
+	if (Host_Platform_Is_Cost_Model_Enabled)
+	{
+		HostPlatformCostModelUpdateTime();
+		if (!Host_Platform_Is_Tick_Elapsed) HostPlatformCostModelSkipToNextTick();
+	}
+	else if (!Host_Platform_Is_Tick_Elapsed) HostPlatformTick();
+}
+
+#if INTERPRETER_IS_EXECUTION_TRACE_ENABLED == 1
+	void InterpreterPlatformTraceInstruction(unsigned short Register_PC, unsigned short Register_I, unsigned char Register_SP, const unsigned char *Pointer_Registers_V, unsigned char Display_Row_Offset)
+	{
+		unsigned char State[2 + 2 + 1 + 1];
+
+		// The frame buffers are hashed as they are stored, both compared builds use the same layout
+		State[0] = (unsigned char) Register_PC;
+		State[1] = Register_PC >> 8;
+		State[2] = (unsigned char) Register_I;
+		State[3] = Register_I >> 8;
+		State[4] = Register_SP;
+		State[5] = Display_Row_Offset;
+		HostPlatformHashTraceBytes(State, sizeof(State));
+		HostPlatformHashTraceBytes(Pointer_Registers_V, 16);
+		HostPlatformHashTraceBytes(Shared_Buffer_Display, sizeof(Shared_Buffer_Display));
+		HostPlatformHashTraceBytes(Shared_Buffers.Interpreter_Display_Second_Plane, sizeof(Shared_Buffers.Interpreter_Display_Second_Plane));
+
+		Host_Platform_Traced_Instructions_Count++;
+		if ((Host_Platform_Traced_Instructions_Count % HOST_PLATFORM_TRACE_HASH_PERIOD) == 0) printf("Trace hash at instruction %lu : %08lX\n", Host_Platform_Traced_Instructions_Count, Host_Platform_Trace_Hash);
+	}
+#endif
+
+#if INTERPRETER_IS_BENCHMARK_ENABLED == 1
+	unsigned short InterpreterPlatformReadTimeCounter(void)
+	{
+		struct timespec Time;
+
+		// Unlike the emulated time, this is the real host time
+		clock_gettime(CLOCK_MONOTONIC, &Time);
+		return (unsigned short) (Time.tv_sec * 1000000UL + Time.tv_nsec / 1000);
+	}
+#endif
+
+void InterpreterPlatformSetTickSpeedFactor(unsigned char __attribute__((unused)) Speed_Factor)
+{
+	// The menu key is never held, so the turbo mode can't be entered
+}
+
+void InterpreterPlatformWaitMilliseconds(unsigned char Milliseconds)
+{
+	// Run at full speed, but account for the time the console would be busy waiting
+	Interpreter_Cost_Model_Cycles_Count += Milliseconds * (HOST_PLATFORM_COST_MODEL_CYCLES_PER_TICK * 60 / 1000);
+}
+
+void InterpreterPlatformSetDelayTimer(unsigned char Delay)
+{
+	Host_Platform_Delay_Timer = Delay;
+}
+
+unsigned char InterpreterPlatformGetDelayTimer(void)
+{
+	return Host_Platform_Delay_Timer;
+}
+
+void InterpreterPlatformPlaySound(unsigned char __attribute__((unused)) Duration)
+{
+	// The runner is headless
+}
+
+void InterpreterPlatformStopSound(void)
+{
+	// The runner is headless
+}
+
+unsigned char InterpreterPlatformGetRandomSeed(void)
+{
+	return Host_Platform_Random_Seed;
+}
+
+unsigned char InterpreterPlatformReadKeysMask(void)
+{
+	return Host_Platform_Keys_Mask;
+}
+
+unsigned char InterpreterPlatformIsMenuKeyPressed(void)
+{
+	if (Host_Platform_Is_Cost_Model_Enabled)
+	{
+		// No cycles have been executed since the last check when the interpreter is polling the keys in a loop, consider that it waits for the next tick
+		if (Interpreter_Cost_Model_Cycles_Count == 0) HostPlatformCostModelSkipToNextTick();
+		else HostPlatformCostModelUpdateTime();
+	}
+	else
+	{
+		// The interpreter checks the menu key after each slice of instructions, use this to make the time progress when the program is not waiting for the tick
+		Host_Platform_Remaining_Menu_Key_Polls_Count--;
+		if (Host_Platform_Remaining_Menu_Key_Polls_Count == 0) HostPlatformTick();
+	}
+
+	if (Host_Platform_Ticks_Count >= Host_Platform_Maximum_Ticks_Count) return 1;
+	return 0;
+}
+
+unsigned char InterpreterPlatformIsMenuKeyHeld(void)
+{
+	return 0;
+}
+
+void InterpreterPlatformWaitForMenuKeyRelease(void)
+{
+}
+
+void InterpreterPlatformDrawFrameBuffer(unsigned char Is_High_Resolution_Enabled, unsigned char Is_Second_Plane_Enabled, const TDisplayDirtyColumns *Pointer_Dirty_Pages, unsigned char __attribute__((unused)) Row_Offset)
+{
+	unsigned char Pages_Count, Columns_Count, i;
+	unsigned short Bytes_Count = 0;
+
+	Host_Platform_Frames_Count++;
+	Host_Platform_Is_High_Resolution_Enabled = Is_High_Resolution_Enabled;
+	Host_Platform_Is_Second_Plane_Enabled = Is_Second_Plane_Enabled;
+
+	// Only the changed columns are sent to the display, a 64x32 picture byte is sent as 4 display bytes
+	if (Is_High_Resolution_Enabled) Pages_Count = DISPLAY_ROWS_COUNT / 8;
+	else Pages_Count = DISPLAY_ROWS_COUNT / 16;
+	for (i = 0; i < Pages_Count; i++)
+	{
+		if (Pointer_Dirty_Pages[i].First_Column > Pointer_Dirty_Pages[i].Last_Column) continue;
+		Columns_Count = Pointer_Dirty_Pages[i].Last_Column - Pointer_Dirty_Pages[i].First_Column + 1;
+		if (Is_High_Resolution_Enabled) Bytes_Count += Columns_Count;
+		else Bytes_Count += Columns_Count * 4;
+	}
+	Host_Platform_Display_Bytes_Count += Bytes_Count;
+
+	// The cost table tells how long the whole picture takes to be sent
+	Interpreter_Cost_Model_Cycles_Count += Host_Platform_Cost_Model_Display_Cycles[Is_High_Resolution_Enabled] * Bytes_Count / (DISPLAY_COLUMNS_COUNT * DISPLAY_ROWS_COUNT / 8);
+}
+
+void InterpreterPlatformDisplayErrorMessage(const char *Pointer_String_Message)
+{
+	fprintf(stderr, "Interpreter error :\n%s\n", Pointer_String_Message);
+}
+
+unsigned char InterpreterPlatformReadFlagRegister(unsigned char Index)
+{
+	return Host_Platform_Flag_Registers[Index];
+}
+
+void InterpreterPlatformWriteFlagRegister(unsigned char Index, unsigned char Value)
+{
+	Host_Platform_Flag_Registers[Index] = Value;
+}
+
+unsigned char InterpreterPlatformLoadProgramFile(char *Pointer_String_File_Name, unsigned char *Pointer_Buffer, unsigned short Maximum_Size, unsigned short *Pointer_Loaded_Size)
+{
+	FILE *Pointer_File;
+	unsigned char Return_Value = 0;
+
+	// The file name is a path on the host
+	Pointer_File = fopen(Pointer_String_File_Name, "rb");
+	if (Pointer_File == NULL)
+	{
+		fprintf(stderr, "Error : could not open the program file \"%s\".\n", Pointer_String_File_Name);
+		return 1;
+	}
+
+	// Like on the console, the file content exceeding the memory size is ignored
+	*Pointer_Loaded_Size = (unsigned short) fread(Pointer_Buffer, 1, Maximum_Size, Pointer_File);
+	if (ferror(Pointer_File))
+	{
+		fprintf(stderr, "Error : failed to read the program file.\n");
+		Return_Value = 1;
+	}
+
+	fclose(Pointer_File);
+	return Return_Value;
+}
+
+unsigned char InterpreterPlatformOpenInputStream(unsigned char Is_Replay_Enabled)
+{
+	if (Host_Platform_Pointer_String_Input_Stream_File == NULL)
+	{
+		fprintf(stderr, "Error : the game configuration enables the input stream but no input stream file has been provided.\n");
+		return 1;
+	}
+
+	Host_Platform_Pointer_Input_Stream_File = fopen(Host_Platform_Pointer_String_Input_Stream_File, Is_Replay_Enabled ? "rb" : "wb");
+	if (Host_Platform_Pointer_Input_Stream_File == NULL)
+	{
+		fprintf(stderr, "Error : could not open the input stream file \"%s\".\n", Host_Platform_Pointer_String_Input_Stream_File);
+		return 1;
+	}
+	return 0;
+}
+
+void InterpreterPlatformWriteInputStreamByte(unsigned char Data)
+{
+	fputc(Data, Host_Platform_Pointer_Input_Stream_File);
+}
+
+unsigned char InterpreterPlatformReadInputStreamByte(void)
+{
+	int Character;
+
+	// A truncated stream is ended like a complete one
+	Character = fgetc(Host_Platform_Pointer_Input_Stream_File);
+	if (Character == EOF) return 0xFF;
+	return (unsigned char) Character;
+}
+
+void InterpreterPlatformCloseInputStream(void)
+{
+	fclose(Host_Platform_Pointer_Input_Stream_File);
+}
@@ -0,0 +1,92 @@
+/** @file Host_Platform.h
+ * Emulate the console platform on a Linux host. The emulation is headless and deterministic : time is virtual and progresses with the executed instructions, the keys are pressed according to a script and the frame buffer is never displayed.
+ * @author Adrien RICCIARDI
+ */
+#ifndef H_HOST_PLATFORM_H
+#define H_HOST_PLATFORM_H
+
+//-------------------------------------------------------------------------------------------------
+// Constants
+//-------------------------------------------------------------------------------------------------
+/** How many key events a script can contain. */
+#define HOST_PLATFORM_MAXIMUM_KEY_EVENTS_COUNT 256
+/** At how many ticks the frame buffer hash can be computed. */
+#define HOST_PLATFORM_MAXIMUM_FRAME_HASHES_COUNT 64
+
+/** The execution trace hash is printed each time this amount of instructions has been traced, so the first differing instructions of two traces can be found. */
+#define HOST_PLATFORM_TRACE_HASH_PERIOD 4096
+
+/** How many console CPU cycles are executed during a 60Hz tick (the CPU executes 16 MIPS). */
+#define HOST_PLATFORM_COST_MODEL_CYCLES_PER_TICK 266667UL
+
+//-------------------------------------------------------------------------------------------------
+// Types
+//-------------------------------------------------------------------------------------------------
+/** Change the pressed keys at a given time. */
+typedef struct
+{
+	unsigned long Tick; //!< The event takes effect when this amount of ticks has elapsed.
+	unsigned char Keys_Mask; //!< The keys that are held from this tick, built with the TKeyboardKey values.
+} THostPlatformKeyEvent;
+
+//-------------------------------------------------------------------------------------------------
+// Variables
+//-------------------------------------------------------------------------------------------------
+/** How many times the interpreter checks the menu key (it does it after each slice of instructions) before a tick elapses. This sets the emulated speed of the games that do not regulate their speed. */
+extern unsigned short Host_Platform_Menu_Key_Polls_Per_Tick;
+/** The menu key is reported as pressed when this amount of ticks has elapsed, stopping the program. */
+extern unsigned long Host_Platform_Maximum_Ticks_Count;
+/** The value returned to initialize the random number generator. */
+extern unsigned char Host_Platform_Random_Seed;
+
+/** The key script, the events must be sorted by increasing tick. No key is pressed before the first event. */
+extern THostPlatformKeyEvent Host_Platform_Key_Events[HOST_PLATFORM_MAXIMUM_KEY_EVENTS_COUNT];
+/** How many events the key script contains. */
+extern unsigned short Host_Platform_Key_Events_Count;
+
+/** The ticks at which a hash of the frame buffer content is printed, sorted by increasing tick. */
+extern unsigned long Host_Platform_Frame_Hash_Ticks[HOST_PLATFORM_MAXIMUM_FRAME_HASHES_COUNT];
+/** How many frame buffer hashes are computed. */
+extern unsigned short Host_Platform_Frame_Hash_Ticks_Count;
+
+/** Set to 1 to make the time progress with the modelled console cycles of the executed instructions (see Interpreter_Cost_Model_Instruction_Cycles) instead of with the menu key checks. */
+extern unsigned char Host_Platform_Is_Cost_Model_Enabled;
+/** How many console CPU cycles a whole frame buffer transfer takes (a partial transfer takes a proportional amount), index 0 is for the 64x32 picture and index 1 is for the 128x64 picture. */
+extern unsigned long Host_Platform_Cost_Model_Display_Cycles[2];
+/** How many frames the program has completed, a frame ends each time the tick flag is cleared. */
+extern unsigned long Host_Platform_Cost_Model_Frames_Count;
+/** How many frames needed more cycles than a tick provides, they would have slowed the game down on the console. */
+extern unsigned long Host_Platform_Cost_Model_Overrun_Frames_Count;
+
+/** The file the input stream is recorded to or replayed from, when the game configuration enables the input stream. */
+extern char *Host_Platform_Pointer_String_Input_Stream_File;
+
+/** How many ticks elapsed since the program started. */
+extern unsigned long Host_Platform_Ticks_Count;
+/** How many times the frame buffer has been transferred to the display. */
+extern unsigned long Host_Platform_Frames_Count;
+/** How many picture bytes have been sent to the display, only the changed parts of the frame buffer are sent. */
+extern unsigned long Host_Platform_Display_Bytes_Count;
+/** Set to 1 when the frame buffer of the last transferred frame was in high resolution. */
+extern unsigned char Host_Platform_Is_High_Resolution_Enabled;
+/** Set to 1 when the last transferred frame combined the XO-CHIP second plane with the frame buffer. */
+extern unsigned char Host_Platform_Is_Second_Plane_Enabled;
+
+/** The hash of the virtual machine states reported after each instruction, each state being chained to the previous ones (only a runner built with INTERPRETER_IS_EXECUTION_TRACE_ENABLED computes it). */
+extern unsigned long Host_Platform_Trace_Hash;
+/** How many instructions have been traced. */
+extern unsigned long Host_Platform_Traced_Instructions_Count;
+
+//-------------------------------------------------------------------------------------------------
+// Functions
+//-------------------------------------------------------------------------------------------------
+/** Tell whether a pixel of an interpreter display plane is lit, the planes use the display controller page layout.
+ * @param Pointer_Plane The plane frame buffer.
+ * @param Columns_Count The plane width in pixels (64 or 128), it is also the size of a page in bytes.
+ * @param Column The pixel column.
+ * @param Row The pixel row.
+ * @return 1 if the pixel is lit, 0 if it is off.
+ */
+unsigned char HostPlatformIsPixelLit(unsigned char *Pointer_Plane, unsigned char Columns_Count, unsigned char Column, unsigned char Row);
+
+#endif
@@ -0,0 +1,460 @@
+/** @file Main.c
+ * Run a Chip-8 or Super Chip-8 program on a Linux host with the console interpreter core, without display nor keyboard, as fast as the host can.
+ * @author Adrien RICCIARDI
+ */
+#include <Host_Platform.h>
+#include <INI_Parser.h>
+#include <Interpreter.h>
+#include <Keyboard.h>
+#include <libgen.h>
+#include <Shared_Buffer.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+//-------------------------------------------------------------------------------------------------
+// Private constants
+//-------------------------------------------------------------------------------------------------
+/** The maximum size of the game INI section built by the runner, the console configuration file can't be bigger either. */
+#define MAIN_INI_BUFFER_SIZE INTERPRETER_MEMORY_SIZE
+
+/** The key prefix of the game ROM file name in the configuration file. */
+#define MAIN_INI_ROM_FILE_KEY "ROMFile="
+
+//-------------------------------------------------------------------------------------------------
+// Private variables
+//-------------------------------------------------------------------------------------------------
+/** The game INI section provided to the interpreter. */
+static char Main_INI_Buffer[MAIN_INI_BUFFER_SIZE];
+/** How many characters are stored in the INI buffer. */
+static size_t Main_INI_Buffer_Length;
+
+//-------------------------------------------------------------------------------------------------
+// Private functions
+//-------------------------------------------------------------------------------------------------
+/** Display the program usage. */
+static void MainDisplayUsage(char *Pointer_String_Program_Name)
+{
+	printf("Usage : %s [options] ROM_File\n"
+		"Options :\n"
+		"  -c Configuration_File  Read the game settings from this INI file (by default, the CONFIG.INI file located in the ROM directory is used if it exists).\n"
+		"  -o Key=Value           Override a game setting, this option can be repeated (for instance -o InstructionsPerFrame=15).\n"
+		"  -t Ticks               Stop the program after this amount of 60Hz ticks (default is %lu).\n"
+		"  -p Polls               How many slices of instructions are executed during a tick when the game speed is not regulated (default is %u).\n"
+		"  -r Seed                The random number generator seed (default is %u).\n"
+		"  -k Key_Script          Press keys at given ticks, the script is a comma-separated list of Tick:Keys events where Keys is a '+'-separated list of UP, DOWN, LEFT, RIGHT, A, B, C and D, or is empty to release all keys (for instance -k 60:A,66:,120:LEFT+B).\n"
+		"  -f Ticks               Print a hash of the frame buffer content at each of these comma-separated ticks.\n"
+		"  -i Instructions        Stop the program after this amount of executed instructions, 0 means no limit (default is %lu).\n"
+		"  -m Cost_Table          Predict the program speed on the console with this cycles table (made by Tools/Cost_Model.py), the time then progresses with the modelled cycles and the -p option is ignored.\n"
+		"  -R Stream_File         Record the keys pressed at each frame and the random seed to this input stream file (the key script can provide the keys).\n"
+		"  -P Stream_File         Replay the keys and the random seed from this input stream file, recorded by the runner or by the console (see Tools/Input_Stream.py), the program is stopped at the stream end.\n"
+		"  -d                     Dump the frame buffer content when the program ends.\n"
+		"The interpreter speed report is printed to the error stream when the program ends.\n",
+		Pointer_String_Program_Name, Host_Platform_Maximum_Ticks_Count, Host_Platform_Menu_Key_Polls_Per_Tick, Host_Platform_Random_Seed, Interpreter_Benchmark_Maximum_Instructions_Count);
+}
+
+/** Append a string to the INI buffer.
+ * @param Pointer_String The string to append.
+ * @param Length How many characters to append.
+ * @return 0 on success,
+ * @return 1 if the buffer is full.
+ */
+static unsigned char MainAppendToINIBuffer(const char *Pointer_String, size_t Length)
+{
+	// Keep room for the two INI end characters
+	if (Main_INI_Buffer_Length + Length + 2 > sizeof(Main_INI_Buffer))
+	{
+		fprintf(stderr, "Error : the game settings are too big.\n");
+		return 1;
+	}
+
+	memcpy(&Main_INI_Buffer[Main_INI_Buffer_Length], Pointer_String, Length);
+	Main_INI_Buffer_Length += Length;
+	return 0;
+}
+
+/** Append the keys of the configuration file section describing the ROM to the INI buffer. Nothing is appended if the configuration file does not describe this ROM.
+ * @param Pointer_String_Configuration_File The configuration file path.
+ * @param Pointer_String_ROM_File_Name The ROM file name, without directory.
+ * @param Is_Missing_File_Allowed Set to 1 to ignore a missing configuration file.
+ * @return 0 on success,
+ * @return 1 if an error occurred.
+ */
+static unsigned char MainAppendGameSection(char *Pointer_String_Configuration_File, char *Pointer_String_ROM_File_Name, unsigned char Is_Missing_File_Allowed)
+{
+	static char String_Configuration[MAIN_INI_BUFFER_SIZE + 1];
+	FILE *Pointer_File;
+	size_t Size, ROM_File_Name_Length;
+	char *Pointer_String_Line, *Pointer_String_Line_End, *Pointer_String_Section = NULL;
+
+	// Load the whole configuration file
+	Pointer_File = fopen(Pointer_String_Configuration_File, "r");
+	if (Pointer_File == NULL)
+	{
+		if (Is_Missing_File_Allowed) return 0;
+		fprintf(stderr, "Error : could not open the configuration file \"%s\".\n", Pointer_String_Configuration_File);
+		return 1;
+	}
+	Size = fread(String_Configuration, 1, sizeof(String_Configuration) - 1, Pointer_File);
+	fclose(Pointer_File);
+	String_Configuration[Size] = 0;
+
+	// Find the section containing the ROM file name, then append its keys up to the next section
+	ROM_File_Name_Length = strlen(Pointer_String_ROM_File_Name);
+	for (Pointer_String_Line = String_Configuration; *Pointer_String_Line != 0; Pointer_String_Line = Pointer_String_Line_End)
+	{
+		Pointer_String_Line_End = strchr(Pointer_String_Line, '\n');
+		if (Pointer_String_Line_End == NULL) Pointer_String_Line_End = Pointer_String_Line + strlen(Pointer_String_Line);
+		else Pointer_String_Line_End++;
+
+		// Remember where the current section keys begin
+		if (*Pointer_String_Line == '[')
+		{
+			Pointer_String_Section = Pointer_String_Line_End;
+			continue;
+		}
+
+		// Is this the searched section ?
+		if ((Pointer_String_Section != NULL) && (strncmp(Pointer_String_Line, MAIN_INI_ROM_FILE_KEY, sizeof(MAIN_INI_ROM_FILE_KEY) - 1) == 0) && (strncmp(&Pointer_String_Line[sizeof(MAIN_INI_ROM_FILE_KEY) - 1], Pointer_String_ROM_File_Name, ROM_File_Name_Length) == 0) && (strchr("\r\n", Pointer_String_Line[sizeof(MAIN_INI_ROM_FILE_KEY) - 1 + ROM_File_Name_Length]) != NULL))
+		{
+			// Keep only the lines following the section name, the ROM file name is already present in the INI buffer
+			for (Pointer_String_Line = Pointer_String_Section; (*Pointer_String_Line != 0) && (*Pointer_String_Line != '['); Pointer_String_Line = Pointer_String_Line_End)
+			{
+				Pointer_String_Line_End = strchr(Pointer_String_Line, '\n');
+				if (Pointer_String_Line_End == NULL) Pointer_String_Line_End = Pointer_String_Line + strlen(Pointer_String_Line);
+				else Pointer_String_Line_End++;
+
+				if (strncmp(Pointer_String_Line, MAIN_INI_ROM_FILE_KEY, sizeof(MAIN_INI_ROM_FILE_KEY) - 1) == 0) continue;
+				if (MainAppendToINIBuffer(Pointer_String_Line, Pointer_String_Line_End - Pointer_String_Line) != 0) return 1;
+			}
+			return 0;
+		}
+	}
+
+	return 0;
+}
+
+/** Print the frame buffer as text.
+ * @param Is_High_Resolution_Enabled Set to 1 if the frame buffer contains a 128x64 picture, set to 0 if it contains a 64x32 picture.
+ * @param Is_Second_Plane_Enabled Set to 1 to also print the XO-CHIP second plane pixels ('+' when only the second plane pixel is lit, '@' when both planes pixels are lit), set to 0 to print only the frame buffer.
+ */
+static void MainDumpFrameBuffer(unsigned char Is_High_Resolution_Enabled, unsigned char Is_Second_Plane_Enabled)
+{
+	unsigned char Columns_Count, Rows_Count, Row, Frame_Buffer_Row, Column, Color;
+
+	if (Is_High_Resolution_Enabled)
+	{
+		Columns_Count = 128;
+		Rows_Count = 64;
+	}
+	else
+	{
+		Columns_Count = 64;
+		Rows_Count = 32;
+	}
+
+	for (Row = 0; Row < Rows_Count; Row++)
+	{
+		// The vertical scrolling moves the frame buffer row displayed at the display top
+		Frame_Buffer_Row = (Row + InterpreterGetDisplayRowOffset()) & (Rows_Count - 1);
+		for (Column = 0; Column < Columns_Count; Column++)
+		{
+			Color = HostPlatformIsPixelLit(Shared_Buffer_Display, Columns_Count, Column, Frame_Buffer_Row);
+			if (Is_Second_Plane_Enabled) Color |= HostPlatformIsPixelLit(Shared_Buffers.Interpreter_Display_Second_Plane, Columns_Count, Column, Frame_Buffer_Row) << 1;
+			putchar(".#+@"[Color]);
+		}
+		putchar('\n');
+	}
+}
+
+/** Parse the key script provided on the command line.
+ * @param Pointer_String_Script The script.
+ * @return 0 on success,
+ * @return 1 if the script is invalid.
+ */
+static unsigned char MainParseKeyScript(char *Pointer_String_Script)
+{
+	static const struct
+	{
+		const char *Pointer_String_Name;
+		TKeyboardKey Key;
+	} Keys[] =
+	{
+		{ "UP", KEYBOARD_KEY_UP },
+		{ "DOWN", KEYBOARD_KEY_DOWN },
+		{ "LEFT", KEYBOARD_KEY_LEFT },
+		{ "RIGHT", KEYBOARD_KEY_RIGHT },
+		{ "A", KEYBOARD_KEY_A },
+		{ "B", KEYBOARD_KEY_B },
+		{ "C", KEYBOARD_KEY_C },
+		{ "D", KEYBOARD_KEY_D }
+	};
+	char *Pointer_String_Event, *Pointer_String_Key, *Pointer_String_Event_Context, *Pointer_String_Key_Context;
+	THostPlatformKeyEvent *Pointer_Event;
+	unsigned char i;
+
+	for (Pointer_String_Event = strtok_r(Pointer_String_Script, ",", &Pointer_String_Event_Context); Pointer_String_Event != NULL; Pointer_String_Event = strtok_r(NULL, ",", &Pointer_String_Event_Context))
+	{
+		if (Host_Platform_Key_Events_Count >= HOST_PLATFORM_MAXIMUM_KEY_EVENTS_COUNT)
+		{
+			fprintf(stderr, "Error : the key script can't contain more than %d events.\n", HOST_PLATFORM_MAXIMUM_KEY_EVENTS_COUNT);
+			return 1;
+		}
+		Pointer_Event = &Host_Platform_Key_Events[Host_Platform_Key_Events_Count];
+
+		// Retrieve the tick
+		Pointer_Event->Tick = strtoul(Pointer_String_Event, &Pointer_String_Key, 10);
+		if ((Pointer_String_Key == Pointer_String_Event) || (*Pointer_String_Key != ':') || ((Host_Platform_Key_Events_Count > 0) && (Pointer_Event->Tick < Host_Platform_Key_Events[Host_Platform_Key_Events_Count - 1].Tick)))
+		{
+			fprintf(stderr, "Error : the key script event \"%s\" has not a valid increasing tick.\n", Pointer_String_Event);
+			return 1;
+		}
+
+		// Build the keys mask
+		Pointer_Event->Keys_Mask = 0;
+		for (Pointer_String_Key = strtok_r(Pointer_String_Key + 1, "+", &Pointer_String_Key_Context); Pointer_String_Key != NULL; Pointer_String_Key = strtok_r(NULL, "+", &Pointer_String_Key_Context))
+		{
+			for (i = 0; i < sizeof(Keys) / sizeof(Keys[0]); i++)
+			{
+				if (strcmp(Pointer_String_Key, Keys[i].Pointer_String_Name) == 0) break;
+			}
+			if (i == sizeof(Keys) / sizeof(Keys[0]))
+			{
+				fprintf(stderr, "Error : unknown key \"%s\" in the key script.\n", Pointer_String_Key);
+				return 1;
+			}
+			Pointer_Event->Keys_Mask |= (unsigned char) Keys[i].Key;
+		}
+		Host_Platform_Key_Events_Count++;
+	}
+
+	return 0;
+}
+
+/** Parse the list of ticks at which the frame buffer hash must be computed.
+ * @param Pointer_String_Ticks The comma-separated ticks.
+ * @return 0 on success,
+ * @return 1 if the list is invalid.
+ */
+static unsigned char MainParseFrameHashTicks(char *Pointer_String_Ticks)
+{
+	char *Pointer_String_End;
+	unsigned long Tick;
+
+	while (*Pointer_String_Ticks != 0)
+	{
+		Tick = strtoul(Pointer_String_Ticks, &Pointer_String_End, 10);
+		if ((Pointer_String_End == Pointer_String_Ticks) || ((*Pointer_String_End != ',') && (*Pointer_String_End != 0)) || (Host_Platform_Frame_Hash_Ticks_Count >= HOST_PLATFORM_MAXIMUM_FRAME_HASHES_COUNT) || ((Host_Platform_Frame_Hash_Ticks_Count > 0) && (Tick <= Host_Platform_Frame_Hash_Ticks[Host_Platform_Frame_Hash_Ticks_Count - 1])))
+		{
+			fprintf(stderr, "Error : the frame hash ticks must be at most %d increasing numbers separated by commas.\n", HOST_PLATFORM_MAXIMUM_FRAME_HASHES_COUNT);
+			return 1;
+		}
+		Host_Platform_Frame_Hash_Ticks[Host_Platform_Frame_Hash_Ticks_Count] = Tick;
+		Host_Platform_Frame_Hash_Ticks_Count++;
+
+		Pointer_String_Ticks = Pointer_String_End;
+		if (*Pointer_String_Ticks == ',') Pointer_String_Ticks++;
+	}
+
+	return 0;
+}
+
+/** Load the console cycles table used by the cost model. Each line contains an entry name and its cycles count, the name is an instruction ID or DISPLAY_HALF_SIZE or DISPLAY_FULL_SIZE for the frame buffer transfers. The text following a '#' is ignored.
+ * @param Pointer_String_File_Name The table file.
+ * @return 0 on success,
+ * @return 1 if an error occurred.
+ */
+static unsigned char MainLoadCostTable(char *Pointer_String_File_Name)
+{
+	FILE *Pointer_File;
+	char String_Line[256], String_Name[64], *Pointer_String_End;
+	unsigned long Cycles, Instruction_ID;
+	unsigned int Line_Number = 0;
+
+	Pointer_File = fopen(Pointer_String_File_Name, "r");
+	if (Pointer_File == NULL)
+	{
+		fprintf(stderr, "Error : could not open the cost table file \"%s\".\n", Pointer_String_File_Name);
+		return 1;
+	}
+
+	while (fgets(String_Line, sizeof(String_Line), Pointer_File) != NULL)
+	{
+		Line_Number++;
+
+		// Bypass the comments and the empty lines
+		Pointer_String_End = strchr(String_Line, '#');
+		if (Pointer_String_End != NULL) *Pointer_String_End = 0;
+		if (sscanf(String_Line, "%63s", String_Name) != 1) continue;
+		if (sscanf(String_Line, "%*s %lu", &Cycles) != 1) goto Invalid_Line;
+
+		if (strcmp(String_Name, "DISPLAY_HALF_SIZE") == 0) Host_Platform_Cost_Model_Display_Cycles[0] = Cycles;
+		else if (strcmp(String_Name, "DISPLAY_FULL_SIZE") == 0) Host_Platform_Cost_Model_Display_Cycles[1] = Cycles;
+		else
+		{
+			Instruction_ID = strtoul(String_Name, &Pointer_String_End, 10);
+			if ((*Pointer_String_End != 0) || (Instruction_ID >= INTERPRETER_COST_MODEL_MAXIMUM_INSTRUCTION_IDS_COUNT) || (Cycles > 0xFFFF)) goto Invalid_Line;
+			Interpreter_Cost_Model_Instruction_Cycles[Instruction_ID] = (unsigned short) Cycles;
+		}
+	}
+
+	fclose(Pointer_File);
+	Host_Platform_Is_Cost_Model_Enabled = 1;
+	return 0;
+
+Invalid_Line:
+	fprintf(stderr, "Error : invalid entry at line %u of the cost table file.\n", Line_Number);
+	fclose(Pointer_File);
+	return 1;
+}
+
+//-------------------------------------------------------------------------------------------------
+// Entry point
+//-------------------------------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+	int Option;
+	char *Pointer_String_Configuration_File = NULL, *Pointer_String_ROM_File, String_Temporary[256], String_Directory[256];
+	const char *Pointer_String_Result, *Pointer_String_Input_Stream_Setting;
+	unsigned char Is_Frame_Buffer_Dump_Enabled = 0, Return_Value;
+	struct timespec Start_Time, End_Time;
+	double Host_Duration;
+
+	// The programs are stopped after a given amount of ticks by default, the instructions limit is used by the benchmarks
+	Interpreter_Benchmark_Maximum_Instructions_Count = 0;
+
+	// Start the INI section describing the game
+	if (MainAppendToINIBuffer("[Host]\n", 7) != 0) return EXIT_FAILURE;
+
+	// Retrieve the command line options (the settings overrides are put first in the INI section, so they take precedence over the configuration file ones)
+	while ((Option = getopt(argc, argv, "c:o:t:p:r:k:f:i:m:R:P:d")) != -1)
+	{
+		switch (Option)
+		{
+			case 'c':
+				Pointer_String_Configuration_File = optarg;
+				break;
+
+			case 'o':
+				if (MainAppendToINIBuffer(optarg, strlen(optarg)) != 0) return EXIT_FAILURE;
+				if (MainAppendToINIBuffer("\n", 1) != 0) return EXIT_FAILURE;
+				break;
+
+			case 't':
+				Host_Platform_Maximum_Ticks_Count = strtoul(optarg, NULL, 0);
+				break;
+
+			case 'p':
+				Host_Platform_Menu_Key_Polls_Per_Tick = (unsigned short) strtoul(optarg, NULL, 0);
+				if (Host_Platform_Menu_Key_Polls_Per_Tick == 0) Host_Platform_Menu_Key_Polls_Per_Tick = 1;
+				break;
+
+			case 'r':
+				Host_Platform_Random_Seed = (unsigned char) strtoul(optarg, NULL, 0);
+				break;
+
+			case 'k':
+				if (MainParseKeyScript(optarg) != 0) return EXIT_FAILURE;
+				break;
+
+			case 'f':
+				if (MainParseFrameHashTicks(optarg) != 0) return EXIT_FAILURE;
+				break;
+
+			case 'i':
+				Interpreter_Benchmark_Maximum_Instructions_Count = strtoul(optarg, NULL, 0);
+				break;
+
+			case 'm':
+				// The translated blocks do not add the cycles of the instructions they execute
+				#if INTERPRETER_IS_RECOMPILER_ENABLED == 1
+					fprintf(stderr, "Error : the cost model can't be used by a runner built with a recompiled program.\n");
+					return EXIT_FAILURE;
+				#endif
+				if (MainLoadCostTable(optarg) != 0) return EXIT_FAILURE;
+				break;
+
+			case 'R':
+			case 'P':
+				// Select the mode like the console does, with the game configuration
+				Host_Platform_Pointer_String_Input_Stream_File = optarg;
+				if (Option == 'R') Pointer_String_Input_Stream_Setting = "InputStream=1\n";
+				else Pointer_String_Input_Stream_Setting = "InputStream=2\n";
+				if (MainAppendToINIBuffer(Pointer_String_Input_Stream_Setting, strlen(Pointer_String_Input_Stream_Setting)) != 0) return EXIT_FAILURE;
+				break;
+
+			case 'd':
+				Is_Frame_Buffer_Dump_Enabled = 1;
+				break;
+
+			default:
+				MainDisplayUsage(argv[0]);
+				return EXIT_FAILURE;
+		}
+	}
+	if (optind != argc - 1)
+	{
+		MainDisplayUsage(argv[0]);
+		return EXIT_FAILURE;
+	}
+	Pointer_String_ROM_File = argv[optind];
+
+	// The host platform loads the ROM file from its path
+	snprintf(String_Temporary, sizeof(String_Temporary), MAIN_INI_ROM_FILE_KEY "%s\n", Pointer_String_ROM_File);
+	if (MainAppendToINIBuffer(String_Temporary, strlen(String_Temporary)) != 0) return EXIT_FAILURE;
+
+	// Use the same game settings than the console (dirname() and basename() can modify their argument, so give them a copy)
+	if (Pointer_String_Configuration_File == NULL)
+	{
+		snprintf(String_Directory, sizeof(String_Directory), "%s", Pointer_String_ROM_File);
+		snprintf(String_Temporary, sizeof(String_Temporary), "%s/CONFIG.INI", dirname(String_Directory));
+		if (MainAppendGameSection(String_Temporary, basename(Pointer_String_ROM_File), 1) != 0) return EXIT_FAILURE;
+	}
+	else if (MainAppendGameSection(Pointer_String_Configuration_File, basename(Pointer_String_ROM_File), 0) != 0) return EXIT_FAILURE;
+
+	// Terminate the INI data
+	Main_INI_Buffer[Main_INI_Buffer_Length] = INI_PARSER_END_CHARACTER;
+	Main_INI_Buffer[Main_INI_Buffer_Length + 1] = INI_PARSER_END_CHARACTER;
+
+	InterpreterInitialize();
+	if (InterpreterLoadProgramFromFile(&Main_INI_Buffer[1]) != 0) // Point after the section opening bracket, like INIParserFindNextSection() does
+	{
+		fprintf(stderr, "Error : failed to load the program.\n");
+		return EXIT_FAILURE;
+	}
+
+	// Run the program as fast as possible
+	clock_gettime(CLOCK_MONOTONIC, &Start_Time);
+	Return_Value = InterpreterRunProgram();
+	clock_gettime(CLOCK_MONOTONIC, &End_Time);
+	Host_Duration = (End_Time.tv_sec - Start_Time.tv_sec) + (End_Time.tv_nsec - Start_Time.tv_nsec) / 1e9;
+
+	// Display the execution report
+	if (Return_Value != 0) Pointer_String_Result = "error";
+	else if (Host_Platform_Ticks_Count >= Host_Platform_Maximum_Ticks_Count) Pointer_String_Result = "ticks limit reached";
+	else if ((Interpreter_Benchmark_Maximum_Instructions_Count != 0) && (Interpreter_Benchmark_Instructions_Count >= Interpreter_Benchmark_Maximum_Instructions_Count)) Pointer_String_Result = "instructions limit reached";
+	else Pointer_String_Result = "program exited";
+	printf("Result : %s\n", Pointer_String_Result);
+	printf("Emulated time : %lu ticks (%.2f s)\n", Host_Platform_Ticks_Count, Host_Platform_Ticks_Count / 60.0);
+	printf("Executed instructions : %lu\n", Interpreter_Benchmark_Instructions_Count);
+	#if INTERPRETER_IS_EXECUTION_TRACE_ENABLED == 1
+		printf("Trace hash at instruction %lu : %08lX\n", Host_Platform_Traced_Instructions_Count, Host_Platform_Trace_Hash);
+	#endif
+	#if INTERPRETER_IS_RECOMPILER_ENABLED == 1
+		printf("Recompiled instructions : %lu (%.1f %%)\n", Interpreter_Recompiler_Instructions_Count, Interpreter_Benchmark_Instructions_Count > 0 ? 100.0 * Interpreter_Recompiler_Instructions_Count / Interpreter_Benchmark_Instructions_Count : 0.0);
+	#endif
+	printf("Displayed frames : %lu\n", Host_Platform_Frames_Count);
+	printf("Display bytes : %lu (%.1f per frame)\n", Host_Platform_Display_Bytes_Count, Host_Platform_Frames_Count > 0 ? (double) Host_Platform_Display_Bytes_Count / Host_Platform_Frames_Count : 0.0);
+	printf("Host time : %.3f s\n", Host_Duration);
+	if (Host_Platform_Is_Cost_Model_Enabled && (Host_Platform_Ticks_Count > 0))
+	{
+		printf("Modelled frames : %lu (%lu overrun)\n", Host_Platform_Cost_Model_Frames_Count, Host_Platform_Cost_Model_Overrun_Frames_Count);
+		printf("Modelled speed : %lu instructions per second, %.1f frames per second\n", Interpreter_Benchmark_Instructions_Count * 60 / Host_Platform_Ticks_Count, Host_Platform_Cost_Model_Frames_Count * 60.0 / Host_Platform_Ticks_Count);
+	}
+	if (Is_Frame_Buffer_Dump_Enabled) MainDumpFrameBuffer(Host_Platform_Is_High_Resolution_Enabled, Host_Platform_Is_Second_Plane_Enabled);
+
+	if (Return_Value != 0) return EXIT_FAILURE;
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,33 @@
+/** @file Serial_Port.c
+ * Redirect the serial port used by the interpreter diagnostic features (trace buffer, profilers, debugger) to the host standard streams. See Serial_Port.h for description.
+ * @author Adrien RICCIARDI
+ */
+#include <Serial_Port.h>
+#include <stdio.h>
+
+//-------------------------------------------------------------------------------------------------
+// Public functions
+//-------------------------------------------------------------------------------------------------
+void SerialPortInitialize(void)
+{
+}
+
+unsigned char SerialPortReadByte(void)
+{
+	int Character;
+
+	Character = getchar();
+	if (Character == EOF) return 0;
+	return (unsigned char) Character;
+}
+
+void SerialPortWriteByte(unsigned char Data)
+{
+	// Use the error stream, so the binary profiler dumps can be captured separately from the runner report
+	fputc(Data, stderr);
+}
+
+void SerialPortWriteString(const char *Pointer_String)
+{
+	fputs(Pointer_String, stderr);
+}
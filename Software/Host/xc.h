@@ -0,0 +1,46 @@
+/** @file xc.h
+ * Replace the XC8 device header for the firmware modules built on the host (see the "display_test" makefile target). The special function registers these modules use become plain variables, which the host program defines.
+ * @author Adrien RICCIARDI
+ */
+#ifndef H_XC_H
+#define H_XC_H
+
+//-------------------------------------------------------------------------------------------------
+// Constants and macros
+//-------------------------------------------------------------------------------------------------
+/** The host does not need to wait for the hardware. */
+#define __delay_ms(Milliseconds) do {} while (0)
+
+//-------------------------------------------------------------------------------------------------
+// Types
+//-------------------------------------------------------------------------------------------------
+/** The port B output latches used by the display driver. */
+typedef struct
+{
+	unsigned char LATB1; //!< The display controller reset pin.
+	unsigned char LATB2; //!< The display controller D/C pin.
+} THostLATBbits;
+
+/** The port C output latches used by the SPI chip select lines. */
+typedef struct
+{
+	unsigned char LATC0; //!< The SD card chip select.
+	unsigned char LATC1; //!< The display chip select.
+} THostLATCbits;
+
+/** The SPI module status bits. */
+typedef struct
+{
+	unsigned char BUSY; //!< Always 0, the host SPI transfers end immediately.
+} THostSPI1CON2bits;
+
+//-------------------------------------------------------------------------------------------------
+// Variables
+//-------------------------------------------------------------------------------------------------
+extern THostLATBbits LATBbits;
+extern THostLATCbits LATCbits;
+extern THostSPI1CON2bits SPI1CON2bits;
+extern unsigned char ANSELB;
+extern unsigned char TRISB;
+
+#endif
@@ -6,7 +6,7 @@
 #define H_DISPLAY_H
 
 //-------------------------------------------------------------------------------------------------
-// Constants
+// Constants and macros
 //-------------------------------------------------------------------------------------------------
 /** The amount of horizontal pixels in the display area. */
 #define DISPLAY_COLUMNS_COUNT 128
@@ -33,19 +33,69 @@
 /** The 'é' letter. */
 #define DISPLAY_CHARACTER_E_ACUTE "\037"
 
+/** Exchange the bits of a 8x8 bits matrix transposition step, the right blocks of the upper row swap with the left blocks of the lower row. This is made as macro to make sure that the content will be inlined.
+ * @param Upper_Byte The upper row, the bits selected by Mask are kept.
+ * @param Lower_Byte The lower row, the bits not selected by Mask are kept.
+ * @param Mask Select the left bits of each block (0xF0 for the 4x4 blocks, 0xCC for the 2x2 blocks, 0xAA for the single bits).
+ * @param Shift The block width in bits.
+ */
+#define DISPLAY_SWAP_BITS_BLOCKS(Upper_Byte, Lower_Byte, Mask, Shift) \
+	{ \
+		unsigned char Upper_Byte_Value, Lower_Byte_Value; \
+		Upper_Byte_Value = Upper_Byte; \
+		Lower_Byte_Value = Lower_Byte; \
+		Upper_Byte = (Upper_Byte_Value & (Mask)) | ((Lower_Byte_Value >> (Shift)) & (unsigned char) ~(Mask)); \
+		Lower_Byte = ((unsigned char) (Upper_Byte_Value << (Shift)) & (Mask)) | (Lower_Byte_Value & (unsigned char) ~(Mask)); \
+	}
+
+/** Transpose a 8x8 bits matrix by swapping its 4x4 blocks, then its 2x2 blocks, then the single bits that are not on the diagonal. When the rows are given from the bottom one to the top one and the leftmost pixel is the most significant bit, each byte becomes a column of 8 vertical pixels (the leftmost column first) with the top pixel in the least significant bit, as the display controller expects. This is made as macro to make sure that the content will be inlined.
+ * @param Matrix An array of 8 bytes, it is transposed in place.
+ */
+#define DISPLAY_TRANSPOSE_BITS_MATRIX(Matrix) \
+	{ \
+		unsigned char Transposition_Index; \
+		for (Transposition_Index = 0; Transposition_Index < 4; Transposition_Index++) DISPLAY_SWAP_BITS_BLOCKS((Matrix)[Transposition_Index], (Matrix)[Transposition_Index + 4], 0xF0, 4); \
+		for (Transposition_Index = 0; Transposition_Index < 8; Transposition_Index += 4) \
+		{ \
+			DISPLAY_SWAP_BITS_BLOCKS((Matrix)[Transposition_Index], (Matrix)[Transposition_Index + 2], 0xCC, 2); \
+			DISPLAY_SWAP_BITS_BLOCKS((Matrix)[Transposition_Index + 1], (Matrix)[Transposition_Index + 3], 0xCC, 2); \
+		} \
+		for (Transposition_Index = 0; Transposition_Index < 8; Transposition_Index += 2) DISPLAY_SWAP_BITS_BLOCKS((Matrix)[Transposition_Index], (Matrix)[Transposition_Index + 1], 0xAA, 1); \
+	}
+
+//-------------------------------------------------------------------------------------------------
+// Types
+//-------------------------------------------------------------------------------------------------
+/** The columns of a frame buffer page (a band of 8 rows) that changed since the last transfer to the display. */
+typedef struct
+{
+	unsigned char First_Column; //!< The leftmost changed column, it is greater than Last_Column when the page did not change.
+	unsigned char Last_Column; //!< The rightmost changed column.
+} TDisplayDirtyColumns;
+
 //-------------------------------------------------------------------------------------------------
 // Functions
 //-------------------------------------------------------------------------------------------------
 /** Configure the display controller, clear its data RAM and turn the display on. */
 void DisplayInitialize(void);
 
-/** Convert on-the-fly a Chip-8 frame buffer (with 8 horizontal consecutive pixels per byte) to the display 8 vertical pixels per byte format, scale it to the full display resolution, then send the picture to the display memory.
- * @param Pointer_Buffer The Chip-8 frame buffer (64x32 pixels).
+/** Scale the changed parts of a Chip-8 frame buffer to the full display resolution, then send them to the display memory.
+ * @param Pointer_Buffer The Chip-8 frame buffer (64x32 pixels), it uses the display controller page layout (4 pages of 64 bytes, each byte holding 8 vertical pixels with the top one in the least significant bit).
+ * @param Pointer_Dithered_Buffer An optional second frame buffer with the same layout, its lit pixels that are not lit in the first buffer are displayed half-lit with a checkerboard dithering. Set to NULL to display only the first buffer.
+ * @param Pointer_Dirty_Pages The changed columns of the 4 frame buffer pages, in frame buffer coordinates.
+ */
+void DisplayDrawHalfSizePageBuffer(void *Pointer_Buffer, void *Pointer_Dithered_Buffer, const TDisplayDirtyColumns *Pointer_Dirty_Pages);
+
+/** Send the changed parts of a SuperChip-8 frame buffer to the display memory without any conversion.
+ * @param Pointer_Buffer The SuperChip-8 frame buffer (128x64 pixels), it uses the display controller page layout (8 pages of 128 bytes, each byte holding 8 vertical pixels with the top one in the least significant bit).
+ * @param Pointer_Dithered_Buffer An optional second frame buffer with the same layout, its lit pixels that are not lit in the first buffer are displayed half-lit with a checkerboard dithering. Set to NULL to display only the first buffer.
+ * @param Pointer_Dirty_Pages The changed columns of the 8 frame buffer pages.
+ * @note The display memory areas that are not sent keep the previously sent picture, so the whole frame buffer must be marked as changed after the display has been used for something else.
  */
-void DisplayDrawHalfSizeBuffer(void *Pointer_Buffer);
+void DisplayDrawFullSizePageBuffer(void *Pointer_Buffer, void *Pointer_Dithered_Buffer, const TDisplayDirtyColumns *Pointer_Dirty_Pages);
 
-/** Convert on-the-fly a SuperChip-8 frame buffer (with 8 horizontal consecutive pixels per byte) to the display 8 vertical pixels per byte format, and send the picture to the display memory.
- * @param Pointer_Buffer The SuperChip-8 frame buffer (128x64 pixels).
+/** Convert on-the-fly a 128x64 picture (with 8 horizontal consecutive pixels per byte) to the display 8 vertical pixels per byte format, and send the picture to the display memory.
+ * @param Pointer_Buffer The picture, it is the splash screen or a video frame.
  */
 void DisplayDrawFullSizeBuffer(void *Pointer_Buffer);
 
@@ -85,4 +135,9 @@ void DisplayDrawTextMessage(void *Pointer_Buffer, const char *Pointer_String_Tit
  */
 void DisplaySetBrightness(unsigned char Brightness);
 
+/** Choose which display memory row is shown at the display top, the following rows wrap around the display memory end. This scrolls the whole picture vertically without moving any pixel in the display memory.
+ * @param Line The display memory row, it is in range 0 to DISPLAY_ROWS_COUNT - 1. The drawing functions using a row by row picture or the text mode reset it to 0.
+ */
+void DisplaySetStartLine(unsigned char Line);
+
 #endif
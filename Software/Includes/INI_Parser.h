@@ -48,4 +48,13 @@ char *INIParserReadString(char *Pointer_String_Section, const char *Pointer_Stri
  */
 unsigned char INIParserRead8BitInteger(char *Pointer_String_Section, const char *Pointer_String_Key_Name, unsigned char *Pointer_Output_Value);
 
+/** Retrieve an unsigned 16-bit value associated to a key in the specified section.
+ * @param Pointer_String_Section Pointer to the beginning of the section.
+ * @param Pointer_String_Key_Name The key name. It is case sensitive.
+ * @param Pointer_Output_Value If the key was found and everything went well, contain on output the read 16-bit integer converted to binary.
+ * @return 0 on success,
+ * @return 1 on error (the key was not found).
+ */
+unsigned char INIParserRead16BitInteger(char *Pointer_String_Section, const char *Pointer_String_Key_Name, unsigned short *Pointer_Output_Value);
+
 #endif
@@ -14,13 +14,65 @@
 /** The amount of non-volatile storage registers available in the Super-Chip architecture. */
 #define INTERPRETER_FLAG_REGISTERS_COUNT 8
 
+/** Set to 1 to sample the program counter at each tick and to send the resulting hotspots histogram to the serial port when the program exits (use the Tools/Profiler_Annotate_Disassembly.py script to display it), set to 0 to remove the sampling code. This setting is public because the sampling is triggered by the NCO interrupt handler. */
+#define INTERPRETER_IS_PC_SAMPLING_ENABLED 0
+
+/** Set to 1 to measure the interpreter speed and to send a benchmark report to the serial port when the program exits (use the Tools/Benchmark.py script to run the benchmark suite and to collect the reports), set to 0 to remove the measurement code. This setting is public because the platform must provide the time counter. It can also be set from the compiler command line, which is done by the "benchmark" and "host" makefile targets. */
+#ifndef INTERPRETER_IS_BENCHMARK_ENABLED
+	#define INTERPRETER_IS_BENCHMARK_ENABLED 0
+#endif
+
+/** Set to 1 to add the modelled console cycles of each executed instruction to a counter, so the host runner can predict the games speed on the console (see the Tools/Cost_Model.py script), set to 0 to remove the modelling code. Only the host runner enables it, from the "host" makefile target. */
+#ifndef INTERPRETER_IS_COST_MODEL_ENABLED
+	#define INTERPRETER_IS_COST_MODEL_ENABLED 0
+#endif
+/** How many entries the cost model cycles table has, this must be at least the amount of instruction IDs. */
+#define INTERPRETER_COST_MODEL_MAXIMUM_INSTRUCTION_IDS_COUNT 64
+
+/** Set to 1 to allow recording the keys pressed at each frame and the random seed to an input stream, and to replay such a stream instead of reading the keyboard, so a game session can be played again exactly the same way (the InputStream key of the game configuration selects the mode, see the Tools/Input_Stream.py script), set to 0 to remove the recording code. This setting is public because the platform must provide the stream. It can also be set from the compiler command line, which is done by the "benchmark" and "host" makefile targets. */
+#ifndef INTERPRETER_IS_INPUT_STREAM_ENABLED
+	#define INTERPRETER_IS_INPUT_STREAM_ENABLED 0
+#endif
+
+/** Set to 1 to give the virtual machine state to the platform after each interpreted instruction, so the host runner can hash the whole execution and compare two interpreter builds instruction by instruction (see the "-c" option of the Tools/Regression_Test.py script), set to 0 to remove the tracing code. Only the host runner enables it, from the "traced" makefile target. */
+#ifndef INTERPRETER_IS_EXECUTION_TRACE_ENABLED
+	#define INTERPRETER_IS_EXECUTION_TRACE_ENABLED 0
+#endif
+
+/** Set to 1 to build a program translated to C by the Tools/Recompiler.py script with the interpreter, the translated blocks are then run instead of being interpreted, set to 0 to remove the recompiled code support. The translated file is given by INTERPRETER_RECOMPILED_PROGRAM_FILE. Only the host runner can enable it, from the "recompiled" makefile target. */
+#ifndef INTERPRETER_IS_RECOMPILER_ENABLED
+	#define INTERPRETER_IS_RECOMPILER_ENABLED 0
+#endif
+
+//-------------------------------------------------------------------------------------------------
+// Variables
+//-------------------------------------------------------------------------------------------------
+#if INTERPRETER_IS_BENCHMARK_ENABLED == 1
+	/** The program is stopped when it has executed this amount of instructions, set to 0 to never stop it. */
+	extern unsigned long Interpreter_Benchmark_Maximum_Instructions_Count;
+	/** How many instructions the last run program executed (a fused instruction counts for two instructions). */
+	extern unsigned long Interpreter_Benchmark_Instructions_Count;
+#endif
+
+#if INTERPRETER_IS_RECOMPILER_ENABLED == 1
+	/** How many instructions the last run program executed in the recompiled blocks (a fused instruction counts for two instructions). */
+	extern unsigned long Interpreter_Recompiler_Instructions_Count;
+#endif
+
+#if INTERPRETER_IS_COST_MODEL_ENABLED == 1
+	/** How many console CPU cycles each instruction takes, indexed by the instruction ID (see Tools/Cost_Model.py for the IDs). */
+	extern unsigned short Interpreter_Cost_Model_Instruction_Cycles[INTERPRETER_COST_MODEL_MAXIMUM_INSTRUCTION_IDS_COUNT];
+	/** The modelled cycles of the executed instructions are added to this counter, the platform consumes it to make the time progress. */
+	extern unsigned long Interpreter_Cost_Model_Cycles_Count;
+#endif
+
 //-------------------------------------------------------------------------------------------------
 // Functions
 //-------------------------------------------------------------------------------------------------
 /** Configure the interpreter timers. */
 void InterpreterInitialize(void);
 
-/** Load a ROM file from the SD card and prepare the Chip-8 virtual machine.
+/** Load a ROM file (from the SD card on the console) and prepare the Chip-8 virtual machine.
  * @param Pointer_String_Game_INI_Section The configuration file INI section containing the game information.
  * @return 0 on success,
  * @return 1 if an error occurred.
@@ -33,4 +85,14 @@ unsigned char InterpreterLoadProgramFromFile(char *Pointer_String_Game_INI_Secti
  */
 unsigned char InterpreterRunProgram(void);
 
+/** Tell which frame buffer row is displayed at the display top. The vertical scrolling instructions move this row instead of the pixels, the display rows following it wrap around the frame buffer end.
+ * @return The frame buffer row of the display top, it is in range 0 to the current display height minus 1.
+ */
+unsigned char InterpreterGetDisplayRowOffset(void);
+
+#if INTERPRETER_IS_PC_SAMPLING_ENABLED == 1
+	/** Add the current program counter value to the hotspots histogram. This function is called from the NCO interrupt handler, it does nothing when no program is running. */
+	void InterpreterSampleProgramCounter(void);
+#endif
+
 #endif
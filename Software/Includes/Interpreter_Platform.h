@@ -0,0 +1,159 @@
+/** @file Interpreter_Platform.h
+ * The services the interpreter core needs from the machine it is running on (time, keys, sound, display, flag registers storage and program loading).
+ * The console firmware implements them with the microcontroller peripherals and drivers, the Linux host runner (see the Host directory) emulates them, so the same interpreter core can run on both.
+ * @author Adrien RICCIARDI
+ */
+#ifndef H_INTERPRETER_PLATFORM_H
+#define H_INTERPRETER_PLATFORM_H
+
+#include <Display.h>
+#include <Interpreter.h>
+
+//-------------------------------------------------------------------------------------------------
+// Functions
+//-------------------------------------------------------------------------------------------------
+/** Configure the resources needed to run the interpreter (the delay timer for instance). */
+void InterpreterPlatformInitialize(void);
+
+/** Tell whether the 60Hz tick has elapsed since the tick flag was last cleared.
+ * @return 1 if the tick has elapsed,
+ * @return 0 if the tick has not elapsed yet.
+ */
+unsigned char InterpreterPlatformIsTickElapsed(void);
+
+/** Clear the tick flag, it must be manually cleared each time the elapsed tick has been processed. */
+void InterpreterPlatformClearTick(void);
+
+/** Block until the next tick elapses, returning immediately if the tick flag is already set. The console enters the Idle mode to save power. */
+void InterpreterPlatformWaitForTick(void);
+
+#if INTERPRETER_IS_BENCHMARK_ENABLED == 1
+	/** Read a free-running counter incremented every microsecond, it is used to measure the interpreter speed.
+	 * @return The counter value, it wraps around after 65535 microseconds so only shorter durations can be measured.
+	 */
+	unsigned short InterpreterPlatformReadTimeCounter(void);
+#endif
+
+#if INTERPRETER_IS_EXECUTION_TRACE_ENABLED == 1
+	/** Receive the virtual machine state after an instruction has been executed (a fused instruction is reported once, after its second instruction). The frame buffer content is found in Shared_Buffer_Display and in Shared_Buffers.Interpreter_Display_Second_Plane.
+	 * @param Register_PC The program counter, it points to the next instruction to execute.
+	 * @param Register_I The I register.
+	 * @param Register_SP The stack pointer.
+	 * @param Pointer_Registers_V The V0 to VF registers.
+	 * @param Display_Row_Offset The frame buffer row displayed at the display top.
+	 */
+	void InterpreterPlatformTraceInstruction(unsigned short Register_PC, unsigned short Register_I, unsigned char Register_SP, const unsigned char *Pointer_Registers_V, unsigned char Display_Row_Offset);
+#endif
+
+/** Make the tick, and thus the delay and sound timers, run faster than real time.
+ * @param Speed_Factor How many times faster than 60Hz the tick runs, set to 1 to return to the normal speed.
+ */
+void InterpreterPlatformSetTickSpeedFactor(unsigned char Speed_Factor);
+
+/** Busy wait for the specified amount of time.
+ * @param Milliseconds The time to wait.
+ */
+void InterpreterPlatformWaitMilliseconds(unsigned char Milliseconds);
+
+/** Start decrementing the virtual machine delay timer at 60Hz from the specified value.
+ * @param Delay The initial timer value.
+ */
+void InterpreterPlatformSetDelayTimer(unsigned char Delay);
+
+/** Retrieve the current value of the virtual machine delay timer.
+ * @return The timer value, 0 if it has elapsed.
+ */
+unsigned char InterpreterPlatformGetDelayTimer(void);
+
+/** Start the buzzer for the specified amount of time (the virtual machine sound timer).
+ * @param Duration The sound duration in 60Hz ticks.
+ */
+void InterpreterPlatformPlaySound(unsigned char Duration);
+
+/** Immediately stop any playing sound. */
+void InterpreterPlatformStopSound(void);
+
+/** Get a value to initialize the random number generator with.
+ * @return The seed value.
+ */
+unsigned char InterpreterPlatformGetRandomSeed(void);
+
+/** Read the state of all game keys (excluding the menu key) without blocking.
+ * @return A bit mask of the pressed keys, built with the TKeyboardKey values.
+ */
+unsigned char InterpreterPlatformReadKeysMask(void);
+
+/** Tell whether the menu key has been pressed since the last call to this function.
+ * @return 1 if the menu key has been pressed,
+ * @return 0 if the menu key has not been pressed.
+ */
+unsigned char InterpreterPlatformIsMenuKeyPressed(void);
+
+/** Tell whether the menu key is currently held down, without altering the pressed status.
+ * @return 1 if the menu key is held down,
+ * @return 0 if the menu key is released.
+ */
+unsigned char InterpreterPlatformIsMenuKeyHeld(void);
+
+/** Wait for the menu key to be released, then discard any menu key press caused by the release bounces. */
+void InterpreterPlatformWaitForMenuKeyRelease(void);
+
+/** Transfer the changed parts of the Chip-8 frame buffer (stored in Shared_Buffer_Display) to the display.
+ * @param Is_High_Resolution_Enabled Set to 1 if the frame buffer contains a 128x64 picture, set to 0 if it contains a 64x32 picture.
+ * @param Is_Second_Plane_Enabled Set to 1 to combine the XO-CHIP second plane (stored in Shared_Buffers.Interpreter_Display_Second_Plane) with the frame buffer, set to 0 to display only the frame buffer.
+ * @param Pointer_Dirty_Pages The changed columns of each frame buffer page (4 pages for a 64x32 picture, 8 pages for a 128x64 picture).
+ * @param Row_Offset The frame buffer row displayed at the display top, the following rows wrap around the frame buffer end (the vertical scrolling instructions move this row instead of the pixels).
+ */
+void InterpreterPlatformDrawFrameBuffer(unsigned char Is_High_Resolution_Enabled, unsigned char Is_Second_Plane_Enabled, const TDisplayDirtyColumns *Pointer_Dirty_Pages, unsigned char Row_Offset);
+
+/** Show an error message to the user and wait for the user to acknowledge it.
+ * @param Pointer_String_Message The message content.
+ * @note The display frame buffer is overwritten.
+ */
+void InterpreterPlatformDisplayErrorMessage(const char *Pointer_String_Message);
+
+/** Read one of the Super-Chip flag registers from the non-volatile storage.
+ * @param Index The register index, from 0 to INTERPRETER_FLAG_REGISTERS_COUNT - 1.
+ * @return The register value.
+ */
+unsigned char InterpreterPlatformReadFlagRegister(unsigned char Index);
+
+/** Write one of the Super-Chip flag registers to the non-volatile storage.
+ * @param Index The register index, from 0 to INTERPRETER_FLAG_REGISTERS_COUNT - 1.
+ * @param Value The value to store.
+ */
+void InterpreterPlatformWriteFlagRegister(unsigned char Index, unsigned char Value);
+
+/** Load a program file to the provided buffer.
+ * @param Pointer_String_File_Name The file name, as found in the games configuration file. The string can be located in the destination buffer, so it can't be used anymore once the file content starts being stored.
+ * @param Pointer_Buffer On output, contain the file content.
+ * @param Maximum_Size How many bytes can be stored to the buffer. This value is a multiple of 512 bytes.
+ * @param Pointer_Loaded_Size On output, contain how many bytes of the file content have been stored to the buffer (the file content exceeding the buffer size is ignored).
+ * @return 0 on success,
+ * @return 1 if an error occurred.
+ */
+unsigned char InterpreterPlatformLoadProgramFile(char *Pointer_String_File_Name, unsigned char *Pointer_Buffer, unsigned short Maximum_Size, unsigned short *Pointer_Loaded_Size);
+
+#if INTERPRETER_IS_INPUT_STREAM_ENABLED == 1
+	/** Prepare the input stream the keys are recorded to or replayed from.
+	 * @param Is_Replay_Enabled Set to 1 to read the stream, set to 0 to write it.
+	 * @return 0 on success,
+	 * @return 1 if an error occurred.
+	 */
+	unsigned char InterpreterPlatformOpenInputStream(unsigned char Is_Replay_Enabled);
+
+	/** Append a byte to the recorded input stream.
+	 * @param Data The byte to write.
+	 */
+	void InterpreterPlatformWriteInputStreamByte(unsigned char Data);
+
+	/** Read the next byte of the replayed input stream.
+	 * @return The read byte, 0xFF if the stream end has been reached (the interpreter takes it for the stream end marker).
+	 */
+	unsigned char InterpreterPlatformReadInputStreamByte(void);
+
+	/** Release the input stream once the program has exited. */
+	void InterpreterPlatformCloseInputStream(void);
+#endif
+
+#endif
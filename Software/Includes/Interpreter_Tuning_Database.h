@@ -0,0 +1,53 @@
+/** @file Interpreter_Tuning_Database.h
+ * The known-good settings of the games, found by the hash of their ROM file. The interpreter applies them when a game is loaded, so the game configuration file only needs to contain the settings that differ.
+ * The database content (Interpreter_Tuning_Database.c) is generated from the games configuration files by the Tools/Tuning_Database.py script.
+ * @author Adrien RICCIARDI
+ */
+#ifndef H_INTERPRETER_TUNING_DATABASE_H
+#define H_INTERPRETER_TUNING_DATABASE_H
+
+//-------------------------------------------------------------------------------------------------
+// Constants
+//-------------------------------------------------------------------------------------------------
+/** The FastRendering setting flag. */
+#define INTERPRETER_TUNING_DATABASE_SETTING_FAST_RENDERING (1 << 0)
+/** The DisplayWrapping setting flag. */
+#define INTERPRETER_TUNING_DATABASE_SETTING_DISPLAY_WRAPPING (1 << 1)
+/** The MemoryLoadStoreIncrement setting flag. */
+#define INTERPRETER_TUNING_DATABASE_SETTING_MEMORY_LOAD_STORE_INCREMENT (1 << 2)
+/** The ShiftUsingVy setting flag. */
+#define INTERPRETER_TUNING_DATABASE_SETTING_SHIFT_USING_VY (1 << 3)
+/** The ResetVF setting flag. */
+#define INTERPRETER_TUNING_DATABASE_SETTING_VF_RESET (1 << 4)
+/** The RenderingDelay setting flag, it is only used to tell that the game configuration overrides the database value. */
+#define INTERPRETER_TUNING_DATABASE_SETTING_RENDERING_DELAY (1 << 5)
+/** The InstructionsPerFrame setting flag, it is only used to tell that the game configuration overrides the database value. */
+#define INTERPRETER_TUNING_DATABASE_SETTING_INSTRUCTIONS_PER_FRAME (1 << 6)
+
+/** The initial value of the ROM file hash (this is the 32-bit FNV-1a hash). */
+#define INTERPRETER_TUNING_DATABASE_HASH_OFFSET_BASIS 2166136261UL
+/** The value the ROM file hash is multiplied by after each byte. */
+#define INTERPRETER_TUNING_DATABASE_HASH_PRIME 16777619UL
+
+//-------------------------------------------------------------------------------------------------
+// Types
+//-------------------------------------------------------------------------------------------------
+/** The settings of a game. */
+typedef struct
+{
+	unsigned long ROM_Hash; //!< The FNV-1a hash of the ROM file content.
+	unsigned short ROM_Size; //!< The ROM file size in bytes, it is compared too to make hash collisions even less likely.
+	unsigned char Enabled_Settings_Mask; //!< The INTERPRETER_TUNING_DATABASE_SETTING_xxx flags of the enabled on/off settings.
+	unsigned char Rendering_Delay; //!< The RenderingDelay value in milliseconds.
+	unsigned short Instructions_Per_Frame; //!< The InstructionsPerFrame value, 0 to run the game as fast as possible.
+} TInterpreterTuningDatabaseEntry;
+
+//-------------------------------------------------------------------------------------------------
+// Variables
+//-------------------------------------------------------------------------------------------------
+/** All known games settings, they are stored in the program memory. */
+extern const TInterpreterTuningDatabaseEntry Interpreter_Tuning_Database[];
+/** How many entries the database contains. */
+extern const unsigned char Interpreter_Tuning_Database_Entries_Count;
+
+#endif
@@ -39,6 +39,11 @@ unsigned char KeyboardReadKeysMask(void);
  */
 unsigned char KeyboardIsMenuKeyPressed(void);
 
+/** Tell whether the menu key is currently held down. Unlike KeyboardIsMenuKeyPressed(), this function reads the key switch state and does not alter the pressed status.
+ * @return 1 if the menu key is held down, 0 otherwise.
+ */
+unsigned char KeyboardIsMenuKeyHeld(void);
+
 /** Block until one of the keys of the specified mask is pressed.
  * @param Keys_Mask A mask of the keys to wait for.
  * @return A mask of the pressed keys.
@@ -16,16 +16,22 @@
 /** The internal counter value to achieve a 60Hz frequency. */
 #define NCO_TICK_FREQUENCY_INTERPRETER 4027
 
-/** The NCO module is configured to generate a specific frequency. Its interrupt flag is then toggling twice faster at this frequency too. Use it as a rendering tick here. */
-#define NCO_IS_TICK_ELAPSED() (PIR4bits.NCO1IF == 1)
+/** The NCO module is configured to generate a specific frequency. Its interrupt is then firing twice faster at this frequency too. Use it as a rendering tick here. */
+#define NCO_IS_TICK_ELAPSED() (NCO_Is_Tick_Elapsed == 1)
 
-/** Clear the interrupt flag at an appropriate moment chosen by the user (the interrupt flag must be manually cleared). */
-#define NCO_CLEAR_TICK_INTERRUPT_FLAG() PIR4bits.NCO1IF = 0
+/** Clear the tick flag at an appropriate moment chosen by the user (the flag is set by the NCO interrupt, and it must be manually cleared). */
+#define NCO_CLEAR_TICK_INTERRUPT_FLAG() NCO_Is_Tick_Elapsed = 0
+
+//-------------------------------------------------------------------------------------------------
+// Variables
+//-------------------------------------------------------------------------------------------------
+/** Set to 1 by the NCO interrupt each time a tick elapses. Use the NCO_IS_TICK_ELAPSED() and NCO_CLEAR_TICK_INTERRUPT_FLAG() macros to access it. */
+extern volatile unsigned char NCO_Is_Tick_Elapsed;
 
 //-------------------------------------------------------------------------------------------------
 // Functions
 //-------------------------------------------------------------------------------------------------
-/** Enable the NCO module power and clocks. */
+/** Enable the NCO module power and clocks, also enable the tick interrupt (it can wake the CPU up from the Idle mode). */
 void NCOInitialize(void);
 
 /** Configure the NCO module to internally generate a square wave of the specified frequency. The NCO is stopped, reconfigured then started again.
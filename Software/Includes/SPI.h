@@ -12,11 +12,13 @@
 //-------------------------------------------------------------------------------------------------
 /** Assert the chip select line of the display. */
 #define SPI_SELECT_DISPLAY() LATCbits.LATC1 = 0
+/** Wait for the end of the transfer started by SPIWriteByte() (if any), so the display D/C pin can be changed without corrupting the byte being sent. */
+#define SPI_WAIT_DISPLAY_TRANSFER_END() while (SPI1CON2bits.BUSY)
 /** De-assert the chip select line of the display. */
 #define SPI_DESELECT_DISPLAY() \
 	{ \
 		/* End any ongoing transfer before deselecting the slave (note that only the display is using SPIWriteByte()) */ \
-		while (SPI1CON2bits.BUSY); \
+		SPI_WAIT_DISPLAY_TRANSFER_END(); \
 		LATCbits.LATC1 = 1; \
 	}
 
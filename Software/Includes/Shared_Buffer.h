@@ -8,29 +8,45 @@
 #include <Display.h>
 #include <Interpreter.h>
 
+//-------------------------------------------------------------------------------------------------
+// Constants
+//-------------------------------------------------------------------------------------------------
+/** The size in bytes of a FAT module sector buffer, it must be equal to SD_CARD_BLOCK_SIZE (the SD card header can't be included here because the host runner uses this file too). */
+#define SHARED_BUFFER_FAT_SECTOR_SIZE 512
+
 //-------------------------------------------------------------------------------------------------
 // Types
 //-------------------------------------------------------------------------------------------------
-/** Reuse the memory space for features that do not require the memory at the same time. */
-typedef union
+/** Reuse the memory space for features that do not require the memory at the same time. The first area is used by the modules in turn, the second area is used by the FAT module while the files are listed or read, then by the interpreter while a game is running. */
+typedef struct
 {
-	/** The Chip-8 / SuperChip-8 interpreter memory storing the loaded program. */
-	unsigned char Interpreter_Memory[INTERPRETER_MEMORY_SIZE];
-	/** The INI configuration loaded from the SD card. */
-	char Configuration_File[INTERPRETER_MEMORY_SIZE];
-	/** A temporary string with plenty of room. */
-	char String_Temporary[INTERPRETER_MEMORY_SIZE];
-	/** A temporary buffer with plenty of room. */
-	unsigned char Buffer[INTERPRETER_MEMORY_SIZE];
+	union
+	{
+		/** The Chip-8 / SuperChip-8 interpreter memory storing the loaded program. */
+		unsigned char Interpreter_Memory[INTERPRETER_MEMORY_SIZE];
+		/** The INI configuration loaded from the SD card. */
+		char Configuration_File[INTERPRETER_MEMORY_SIZE];
+		/** A temporary string with plenty of room. */
+		char String_Temporary[INTERPRETER_MEMORY_SIZE];
+		/** A temporary buffer with plenty of room. */
+		unsigned char Buffer[INTERPRETER_MEMORY_SIZE];
+	};
+	union
+	{
+		/** The sectors the FAT module reads the directory entries and the file allocation table to, their content is not needed anymore when the FAT function returns. */
+		unsigned char FAT_Sectors[2][SHARED_BUFFER_FAT_SECTOR_SIZE];
+		/** The XO-CHIP second display plane, it has the same layout than Shared_Buffer_Display. It is cleared when a game is loaded, after the game file has been read. */
+		unsigned char Interpreter_Display_Second_Plane[DISPLAY_COLUMNS_COUNT * DISPLAY_ROWS_COUNT / 8];
+	};
 } TSharedBuffers;
 
 //-------------------------------------------------------------------------------------------------
 // Variables
 //-------------------------------------------------------------------------------------------------
-/** The display frame buffer, it can contain incompatible data when used in text mode or in Chip-8/SuperChip-8 graphic mode. */
+/** The display frame buffer. The text mode and the Chip-8/SuperChip-8 graphic modes use the display controller page layout (each byte holds 8 vertical pixels, the top one in the least significant bit), the page size being the current picture width (64 or 128 bytes). The splash screen and the video frames are stored row by row with 8 horizontal pixels per byte. */
 extern unsigned char Shared_Buffer_Display[DISPLAY_COLUMNS_COUNT * DISPLAY_ROWS_COUNT / 8];
 
-/** The following buffers reuse the same memory space and must not be used at the same time. */
+/** The buffers of each area reuse the same memory space and must not be used at the same time. */
 extern TSharedBuffers Shared_Buffers;
 
 #endif
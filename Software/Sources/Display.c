@@ -29,6 +29,11 @@
 /** The non-standard special characters are stored before the standard ASCII "space" character with code 32. This offset tells where to find the first special character. */
 #define DISPLAY_FONT_SPRITES_STARTING_OFFSET 28
 
+/** The pixels of a dithered buffer column that are displayed, one pixel out of two is lit and the pattern is shifted on the next column.
+ * @param Column The column index, only its parity is used.
+ */
+#define DISPLAY_DITHERING_PATTERN(Column) (((Column) & 1) ? 0xAA : 0x55)
+
 //-------------------------------------------------------------------------------------------------
 // Private variables
 //-------------------------------------------------------------------------------------------------
@@ -36,6 +41,11 @@
 static unsigned char Display_Text_Cursor_X = 0;
 /** The vertical position of the cursor used for rendering text. */
 static unsigned char Display_Text_Cursor_Y = 0;
+/** The display memory row shown at the display top, it is not sent again when it does not change. */
+static unsigned char Display_Start_Line = 0;
+
+/** Each entry doubles the 4 vertical pixels of its index, so a half size buffer nibble becomes a full display byte. */
+static const unsigned char Display_Doubled_Nibbles[16] = { 0x00, 0x03, 0x0C, 0x0F, 0x30, 0x33, 0x3C, 0x3F, 0xC0, 0xC3, 0xCC, 0xCF, 0xF0, 0xF3, 0xFC, 0xFF };
 
 /** First 128 ASCII characters sprites. */
 static const unsigned char Display_Font_Sprites[][DISPLAY_TEXT_CHARACTER_WIDTH] =
@@ -142,6 +152,34 @@ static const unsigned char Display_Font_Sprites[][DISPLAY_TEXT_CHARACTER_WIDTH]
 	{ 0x7F, 0x41, 0x41, 0x41, 0x7F, 0x00 }, // ASCII code 127 (DEL), use its sprite to represent an unknown character
 };
 
+//-------------------------------------------------------------------------------------------------
+// Private functions
+//-------------------------------------------------------------------------------------------------
+/** Restrict the display memory area written by the next data bytes, the write address goes to the next page when the window last column is reached, and back to the window first column and page after the window last byte. The display must be selected.
+ * @param First_Column The window left column.
+ * @param Last_Column The window right column.
+ * @param First_Page The window top page.
+ * @param Last_Page The window bottom page.
+ */
+static void DisplaySetAddressWindow(unsigned char First_Column, unsigned char Last_Column, unsigned char First_Page, unsigned char Last_Page)
+{
+	// Do not corrupt the data byte that may still be sent
+	SPI_WAIT_DISPLAY_TRANSFER_END();
+	DISPLAY_PIN_DC = DISPLAY_DC_MODE_COMMAND;
+
+	// Send the "Set Column Address" command
+	SPITransferByte(0x21);
+	SPITransferByte(First_Column);
+	SPITransferByte(Last_Column);
+
+	// Send the "Set Page Address" command
+	SPITransferByte(0x22);
+	SPITransferByte(First_Page);
+	SPITransferByte(Last_Page);
+
+	DISPLAY_PIN_DC = DISPLAY_DC_MODE_DATA;
+}
+
 //-------------------------------------------------------------------------------------------------
 // Public functions
 //-------------------------------------------------------------------------------------------------
@@ -190,47 +228,101 @@ void DisplayInitialize(void)
 	SPI_DESELECT_DISPLAY();
 }
 
-void DisplayDrawHalfSizeBuffer(void *Pointer_Buffer)
+void DisplayDrawHalfSizePageBuffer(void *Pointer_Buffer, void *Pointer_Dithered_Buffer, const TDisplayDirtyColumns *Pointer_Dirty_Pages)
 {
-	unsigned char Row, Column, *Pointer_Buffer_Bytes = Pointer_Buffer, Display_Byte, i, j, Frame_Buffer_Chunk[4], *Pointer_Frame_Buffer_Chunk;
+	unsigned char Page, Last_Page, Display_Page, Column, First_Column, Last_Column, *Pointer_Page_Bytes, *Pointer_Dithered_Page_Bytes = NULL, Source_Byte, Display_Byte;
 
 	SPI_SELECT_DISPLAY();
 
-	// Convert a chunk of 32 pixels (8x4 pixels) at a time, outputting 64 pixels (8x8 pixels)
-	for (Row = 0; Row < DISPLAY_ROWS_COUNT / 2; Row += 4) // Load a chunk of 4 vertical bytes, so increment the row per 4
+	Page = 0;
+	while (Page < DISPLAY_ROWS_COUNT / 16)
 	{
-		for (Column = 0; Column < (DISPLAY_COLUMNS_COUNT / 2) / 8; Column++) // There are 8 horizontal pixels per byte in the local frame buffer
+		// Skip the pages that did not change since the previous transfer
+		First_Column = Pointer_Dirty_Pages[Page].First_Column;
+		Last_Column = Pointer_Dirty_Pages[Page].Last_Column;
+		if (First_Column > Last_Column)
 		{
-			// Load the 8 frame buffer horizontal bytes needed to create 16 vertical display buffer bytes (pixels are doubled)
-			Pointer_Frame_Buffer_Chunk = Pointer_Buffer_Bytes;
-			for (i = 0; i < 4; i++)
-			{
-				Frame_Buffer_Chunk[i] = *Pointer_Frame_Buffer_Chunk;
-				Pointer_Frame_Buffer_Chunk += (DISPLAY_COLUMNS_COUNT / 2) / 8; // Go to the next bytes row
-			}
-			// When the end of the row is reached, go to the next 8-byte chunk
-			if (Column == ((DISPLAY_COLUMNS_COUNT / 2) / 8) - 1) Pointer_Buffer_Bytes += (3 * ((DISPLAY_COLUMNS_COUNT / 2) / 8)) + 1; // Add 1 to terminate the row, then add 3 more rows to finally reach the 4 next rows
-			else Pointer_Buffer_Bytes++;
+			Page++;
+			continue;
+		}
+
+		// Send the following pages having the same changed columns in the same window, a 64x32 buffer page (8 rows) covers two display pages
+		Last_Page = Page;
+		while ((Last_Page < (DISPLAY_ROWS_COUNT / 16) - 1) && (Pointer_Dirty_Pages[Last_Page + 1].First_Column == First_Column) && (Pointer_Dirty_Pages[Last_Page + 1].Last_Column == Last_Column)) Last_Page++;
+		DisplaySetAddressWindow(First_Column * 2, (Last_Column * 2) + 1, Page * 2, (Last_Page * 2) + 1);
 
-			// Convert the frame buffer horizontal pixels to display controller expected vertical ones, also double the output pixels by a simple 2x scaling
-			for (j = 0; j < 8; j++)
+		// The upper display page is made of the source page 4 top rows and the lower one of the 4 bottom rows
+		for (Display_Page = Page * 2; Display_Page <= (Last_Page * 2) + 1; Display_Page++)
+		{
+			Pointer_Page_Bytes = (unsigned char *) Pointer_Buffer + (Display_Page / 2) * (DISPLAY_COLUMNS_COUNT / 2) + First_Column;
+			if (Pointer_Dithered_Buffer != NULL) Pointer_Dithered_Page_Bytes = (unsigned char *) Pointer_Dithered_Buffer + (Display_Page / 2) * (DISPLAY_COLUMNS_COUNT / 2) + First_Column;
+
+			for (Column = First_Column; Column <= Last_Column; Column++)
 			{
-				Display_Byte = 0;
-				for (i = 0; i < 4; i++)
+				Source_Byte = *Pointer_Page_Bytes;
+				Pointer_Page_Bytes++;
+				// Merge the dithered buffer pixels, the pattern is shifted by one pixel on each column to make a checkerboard
+				if (Pointer_Dithered_Page_Bytes != NULL)
 				{
-					// The most significant bit of the display buffer is displayed starting from the display bottom
-					if (Frame_Buffer_Chunk[i] & 0x80) Display_Byte |= 0xC0; // Double the pixel vertically if the pixel is lit
-					if (i < 3) Display_Byte >>= 2; // Append each pixel the to most significant bit of the byte, and do not shift the last time or the initial bit would be lost
-
-					// Put the next buffer pixel bit to check to the most significant location
-					Frame_Buffer_Chunk[i] <<= 1;
+					Source_Byte |= *Pointer_Dithered_Page_Bytes & DISPLAY_DITHERING_PATTERN(Column);
+					Pointer_Dithered_Page_Bytes++;
 				}
 
-				// The horizontal 8 pixels are ready to be displayed, write the byte twice to double the pixels horizontally
+				// Double the 4 pixels vertically with a table lookup, then write the byte twice to double the pixels horizontally
+				if (Display_Page & 1) Source_Byte >>= 4;
+				Display_Byte = Display_Doubled_Nibbles[Source_Byte & 0x0F];
 				SPIWriteByte(Display_Byte);
 				SPIWriteByte(Display_Byte); // Save time by not waiting for this transfer to terminate
 			}
 		}
+		Page = Last_Page + 1;
+	}
+
+	SPI_DESELECT_DISPLAY();
+}
+
+void DisplayDrawFullSizePageBuffer(void *Pointer_Buffer, void *Pointer_Dithered_Buffer, const TDisplayDirtyColumns *Pointer_Dirty_Pages)
+{
+	unsigned char Page, Last_Page, Column, First_Column, Last_Column, *Pointer_Buffer_Bytes, *Pointer_Dithered_Buffer_Bytes = NULL, Display_Byte;
+
+	SPI_SELECT_DISPLAY();
+
+	Page = 0;
+	while (Page < DISPLAY_ROWS_COUNT / 8)
+	{
+		// Skip the pages that did not change since the previous transfer
+		First_Column = Pointer_Dirty_Pages[Page].First_Column;
+		Last_Column = Pointer_Dirty_Pages[Page].Last_Column;
+		if (First_Column > Last_Column)
+		{
+			Page++;
+			continue;
+		}
+
+		// Send the following pages having the same changed columns in the same window
+		Last_Page = Page;
+		while ((Last_Page < (DISPLAY_ROWS_COUNT / 8) - 1) && (Pointer_Dirty_Pages[Last_Page + 1].First_Column == First_Column) && (Pointer_Dirty_Pages[Last_Page + 1].Last_Column == Last_Column)) Last_Page++;
+		DisplaySetAddressWindow(First_Column, Last_Column, Page, Last_Page);
+
+		// The buffer already uses the display controller hardware order, so the changed columns can be streamed as is
+		for (; Page <= Last_Page; Page++)
+		{
+			Pointer_Buffer_Bytes = (unsigned char *) Pointer_Buffer + Page * DISPLAY_COLUMNS_COUNT + First_Column;
+			if (Pointer_Dithered_Buffer != NULL) Pointer_Dithered_Buffer_Bytes = (unsigned char *) Pointer_Dithered_Buffer + Page * DISPLAY_COLUMNS_COUNT + First_Column;
+
+			for (Column = First_Column; Column <= Last_Column; Column++)
+			{
+				Display_Byte = *Pointer_Buffer_Bytes;
+				Pointer_Buffer_Bytes++;
+				// Merge the dithered buffer pixels, the pattern is shifted by one pixel on each column to make a checkerboard
+				if (Pointer_Dithered_Buffer_Bytes != NULL)
+				{
+					Display_Byte |= *Pointer_Dithered_Buffer_Bytes & DISPLAY_DITHERING_PATTERN(Column);
+					Pointer_Dithered_Buffer_Bytes++;
+				}
+				SPIWriteByte(Display_Byte);
+			}
+		}
 	}
 
 	SPI_DESELECT_DISPLAY();
@@ -238,42 +330,37 @@ void DisplayDrawHalfSizeBuffer(void *Pointer_Buffer)
 
 void DisplayDrawFullSizeBuffer(void *Pointer_Buffer)
 {
-	unsigned char Row, Column, *Pointer_Buffer_Bytes = Pointer_Buffer, Display_Byte, i, j, Frame_Buffer_Chunk[8], *Pointer_Frame_Buffer_Chunk;
+	unsigned char Row, Column, *Pointer_Buffer_Bytes = Pointer_Buffer, i, Frame_Buffer_Chunk[8], *Pointer_Frame_Buffer_Chunk;
+
+	// The interpreter may have scrolled the display memory
+	DisplaySetStartLine(0);
 
 	SPI_SELECT_DISPLAY();
 
+	// Write the whole display memory, a partial update of the interpreter frame buffer may have restricted the written area
+	DisplaySetAddressWindow(0, DISPLAY_COLUMNS_COUNT - 1, 0, (DISPLAY_ROWS_COUNT / 8) - 1);
+
 	// Convert and display a chunk of 64 pixels (8x8 pixels) at a time
 	for (Row = 0; Row < DISPLAY_ROWS_COUNT; Row += 8) // Load a chunk of 8 vertical bytes, so increment the row per 8
 	{
 		for (Column = 0; Column < DISPLAY_COLUMNS_COUNT / 8; Column++) // There are 8 horizontal pixels per byte in the local frame buffer
 		{
-			// Load the 8 frame buffer horizontal bytes needed to create 8 vertical display buffer bytes
-			Pointer_Frame_Buffer_Chunk = Pointer_Buffer_Bytes;
+			// Load the 8 frame buffer horizontal bytes needed to create 8 vertical display buffer bytes, the bottom row first so the transposed top pixel lands in the least significant bit as the display controller expects
+			Pointer_Frame_Buffer_Chunk = Pointer_Buffer_Bytes + 7 * (DISPLAY_COLUMNS_COUNT / 8);
 			for (i = 0; i < 8; i++)
 			{
 				Frame_Buffer_Chunk[i] = *Pointer_Frame_Buffer_Chunk;
-				Pointer_Frame_Buffer_Chunk += DISPLAY_COLUMNS_COUNT / 8; // Go to the next bytes row
+				Pointer_Frame_Buffer_Chunk -= DISPLAY_COLUMNS_COUNT / 8; // Go to the previous bytes row
 			}
 			// When the end of the row is reached, go to the next 8-byte chunk
 			if (Column == (DISPLAY_COLUMNS_COUNT / 8) - 1) Pointer_Buffer_Bytes += (7 * (DISPLAY_COLUMNS_COUNT / 8)) + 1; // Add 1 to terminate the row, then add 7 more rows to finally reach the 8 next rows
 			else Pointer_Buffer_Bytes++;
 
 			// Convert the frame buffer horizontal pixels to display controller expected vertical ones
-			for (j = 0; j < 8; j++)
-			{
-				Display_Byte = 0;
-				for (i = 0; i < 8; i++)
-				{
-					if (Frame_Buffer_Chunk[i] & 0x80) Display_Byte |= 0x80; // The most significant bit of the display buffer is displayed starting from the display bottom
-					if (i < 7) Display_Byte >>= 1; // Append each pixel the to most significant bit of the byte, and do not shift the last time or the initial bit would be lost
+			DISPLAY_TRANSPOSE_BITS_MATRIX(Frame_Buffer_Chunk);
 
-					// Put the next pixel bit to check to the most significant location
-					Frame_Buffer_Chunk[i] <<= 1;
-				}
-
-				// The horizontal 8 pixels are ready to be displayed
-				SPIWriteByte(Display_Byte);
-			}
+			// Each byte now holds a column of 8 vertical pixels, starting from the leftmost column
+			for (i = 0; i < 8; i++) SPIWriteByte(Frame_Buffer_Chunk[i]);
 		}
 	}
 
@@ -339,8 +426,14 @@ void DisplayDrawTextBuffer(void *Pointer_Buffer)
 {
 	unsigned char Row, Column, *Pointer_Buffer_Bytes = Pointer_Buffer;
 
+	// The interpreter may have scrolled the display memory
+	DisplaySetStartLine(0);
+
 	SPI_SELECT_DISPLAY();
 
+	// Write the whole display memory, a partial update of the interpreter frame buffer may have restricted the written area
+	DisplaySetAddressWindow(0, DISPLAY_COLUMNS_COUNT - 1, 0, (DISPLAY_ROWS_COUNT / 8) - 1);
+
 	// Use the native display controller hardware order (1 byte represents 8 vertical pixels), so it is easy to adjust characters starting column
 	for (Row = 0; Row < DISPLAY_ROWS_COUNT; Row += 8)
 	{
@@ -402,3 +495,19 @@ void DisplaySetBrightness(unsigned char Brightness)
 
 	SPI_DESELECT_DISPLAY();
 }
+
+void DisplaySetStartLine(unsigned char Line)
+{
+	if (Line == Display_Start_Line) return;
+	Display_Start_Line = Line;
+
+	SPI_SELECT_DISPLAY();
+
+	// Send the "Set Display Start Line" command
+	SPI_WAIT_DISPLAY_TRANSFER_END();
+	DISPLAY_PIN_DC = DISPLAY_DC_MODE_COMMAND;
+	SPITransferByte(0x40 | Line);
+	DISPLAY_PIN_DC = DISPLAY_DC_MODE_DATA;
+
+	SPI_DESELECT_DISPLAY();
+}
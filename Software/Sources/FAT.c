@@ -5,6 +5,7 @@
 #include <FAT.h>
 #include <Log.h>
 #include <SD_Card.h>
+#include <Shared_Buffer.h>
 #include <string.h>
 
 //-------------------------------------------------------------------------------------------------
@@ -18,6 +19,10 @@
 /** The amount of FAT entries stored into one sector. Only FAT32 is currently supported, so each entry is 4-byte long. */
 #define FAT_ENTRIES_PER_SECTOR (SD_CARD_BLOCK_SIZE / 4)
 
+#if SHARED_BUFFER_FAT_SECTOR_SIZE != SD_CARD_BLOCK_SIZE
+	#error "The shared FAT sector buffers must have the size of a SD card block."
+#endif
+
 // All FAT file attributes
 /** The file can't be written. */
 #define FAT_FILE_ATTRIBUTE_READ_ONLY 0x01
@@ -386,10 +391,9 @@ unsigned char FATListStart(char *Pointer_String_Absolute_Path)
 
 unsigned char FATListNext(TFATFileInformation *Pointer_File_Information)
 {
-	static TFATDirectory FAT_Directories[FAT_DIRECTORY_ENTRIES_PER_SECTOR]; // This buffer has the size of a sector
 	static unsigned char Current_Directory_Entry_Index_In_Sector, Is_Cluster_Fully_Read;
 	static TFATClusterAccessInformation Cluster_Access_Information;
-	TFATDirectory *Pointer_FAT_Directory;
+	TFATDirectory *FAT_Directories = (TFATDirectory *) Shared_Buffers.FAT_Sectors[0], *Pointer_FAT_Directory; // This buffer has the size of a sector, it is shared with the interpreter that runs only when no listing is in progress
 	unsigned char Result, *Pointer_Buffer_Sector = (unsigned char *) FAT_Directories; // Recycle the FAT_Directories buffer storage area, both buffers are never used at the same time
 
 	// Parse all directory entries until a valid one is found or the last one is reached
@@ -513,7 +517,7 @@ void FATReadSectorsStart(TFATFileInformation *Pointer_File_Information, TFATFile
 
 unsigned char FATReadSectorsNext(TFATFileDescriptor *Pointer_File_Descriptor, unsigned char Sectors_Count, void *Pointer_Destination_Buffer)
 {
-	static unsigned char Buffer_FAT_Sector[SD_CARD_BLOCK_SIZE];
+	unsigned char *Buffer_FAT_Sector = Shared_Buffers.FAT_Sectors[1]; // The sector content is only needed while looking for the next cluster
 	unsigned char Result, *Pointer_Destination_Buffer_Bytes = Pointer_Destination_Buffer;
 	unsigned long Next_Cluster_Number;
 
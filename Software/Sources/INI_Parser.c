@@ -212,3 +212,20 @@ unsigned char INIParserRead8BitInteger(char *Pointer_String_Section, const char
 	*Pointer_Output_Value = (unsigned char) atoi(Pointer_String_Value);
 	return 0;
 }
+
+unsigned char INIParserRead16BitInteger(char *Pointer_String_Section, const char *Pointer_String_Key_Name, unsigned short *Pointer_Output_Value)
+{
+	char *Pointer_String_Value;
+
+	// Find the string containing the key data
+	Pointer_String_Value = INIParserReadString(Pointer_String_Section, Pointer_String_Key_Name);
+	if (Pointer_String_Value == NULL)
+	{
+		LOG(INI_PARSER_IS_LOGGING_ENABLED, "Could not find the key named \"%s\".", Pointer_String_Key_Name);
+		return 1;
+	}
+
+	// Convert the data value to binary (atoi() returns a signed 16-bit value on this architecture, so use the 32-bit variant to access the whole unsigned range)
+	*Pointer_Output_Value = (unsigned short) atol(Pointer_String_Value);
+	return 0;
+}
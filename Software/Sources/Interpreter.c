@@ -3,19 +3,16 @@
  * @author Adrien RICCIARDI
  */
 #include <Display.h>
-#include <EEPROM.h>
-#include <FAT.h>
 #include <INI_Parser.h>
 #include <Interpreter.h>
+#include <Interpreter_Platform.h>
+#include <Interpreter_Tuning_Database.h>
 #include <Keyboard.h>
 #include <Localized_String.h>
 #include <Log.h>
-#include <NCO.h>
-#include <SD_Card.h>
+#include <Serial_Port.h>
 #include <Shared_Buffer.h>
-#include <Sound.h>
 #include <string.h>
-#include <xc.h>
 
 //-------------------------------------------------------------------------------------------------
 // Private constants and macros
@@ -24,6 +21,34 @@
 #define INTERPRETER_IS_LOGGING_ENABLED 1
 /** Set to 1 to enable the interpreter debugger facility. */
 #define INTERPRETER_IS_DEBUGGER_ENABLED 0
+/** Set to 1 to keep the decoded instructions in a cache, set to 0 to decode each instruction every time it is executed. It can also be set from the compiler command line, which is done by the "traced" makefile target to check that the cache does not change the programs behavior. */
+#ifndef INTERPRETER_IS_DECODE_CACHE_ENABLED
+	#define INTERPRETER_IS_DECODE_CACHE_ENABLED 1
+#endif
+/** Set to 1 to execute the most frequent instruction pairs (found with the Tools/Count_Instruction_Pairs.py script) as a single instruction, set to 0 to always execute the instructions one by one. This needs the decode cache, so it follows the decode cache setting by default, also disable it when using the debugger to be able to step each instruction. It can also be set from the compiler command line. */
+#ifndef INTERPRETER_IS_INSTRUCTION_FUSION_ENABLED
+	#define INTERPRETER_IS_INSTRUCTION_FUSION_ENABLED INTERPRETER_IS_DECODE_CACHE_ENABLED
+#endif
+/** Set to 1 to put the CPU in Idle mode when the program is waiting for the delay timer or is stuck in an infinite loop, set to 0 to keep executing these loops. */
+#define INTERPRETER_IS_IDLE_LOOP_DETECTION_ENABLED 1
+/** Set to 1 to display on the serial port how much time was spent in Idle mode when the program exits. This needs the debug build (for the serial port), so the statistics are displayed each time the log messages are enabled. */
+#ifdef LOG_IS_ENABLED
+	#define INTERPRETER_IS_IDLE_STATISTICS_ENABLED 1
+#else
+	#define INTERPRETER_IS_IDLE_STATISTICS_ENABLED 0
+#endif
+/** Set to 1 to generate a copy of the quirk-dependent instruction handlers for each quirk value and to select the right copies when the game is loaded (this removes the quirk tests from the instructions execution, at the cost of some program memory and of a handlers table stored in RAM), set to 0 to test the quirk variables each time such an instruction is executed. */
+#define INTERPRETER_IS_QUIRK_SPECIALIZATION_ENABLED 1
+/** Set to 1 to keep the address and the opcode of the last executed instructions, and to send them to the serial port when the program stops on an error. Recording an instruction is a few byte copies without any branch, so this is left enabled in the release builds. */
+#define INTERPRETER_IS_TRACE_BUFFER_ENABLED 1
+/** Set to 1 to count how many times each instruction is executed and to send the counters to the serial port when the program exits (use the Tools/Profiler_Display_Histogram.py script to display them), set to 0 to remove the profiler code. */
+#define INTERPRETER_IS_PROFILER_ENABLED 0
+/** Set to 1 to measure the execution time of each instruction handler and of the frame buffer transfers, and to send the accumulated times to the serial port when the program exits (use the Tools/Cost_Model.py script to turn them into the cycles table used by the host runner), set to 0 to remove the measurement code. This needs INTERPRETER_IS_BENCHMARK_ENABLED for the time counter. */
+#define INTERPRETER_IS_COST_MEASUREMENT_ENABLED 0
+/** Set to 1 to look the loaded ROM up in the tuning database (see Interpreter_Tuning_Database.h) and to apply the settings found there that the game configuration does not provide, set to 0 to only use the game configuration. */
+#define INTERPRETER_IS_TUNING_DATABASE_ENABLED 1
+/** Set to 1 to execute the XO-CHIP instructions (00Dn, 5xy2, 5xy3, F000 nnnn and Fn01) and to provide the second display plane, set to 0 to only support the Chip-8 and SuperChip-8 instructions. */
+#define INTERPRETER_IS_XO_CHIP_ENABLED 1
 
 /** The amount of general purpose registers (V0 to VF). */
 #define INTERPRETER_REGISTERS_V_COUNT 16
@@ -49,21 +74,466 @@
 /** The total amount of hardware keys supported by this console. */
 #define INTERPRETER_KEYS_COUNT_CONSOLE 8
 
+/** How many decoded instructions the decode cache can hold. This must be a power of two. Each entry uses 7 bytes of RAM. */
+#define INTERPRETER_DECODE_CACHE_ENTRIES_COUNT 64
+/** The address value telling that a decode cache entry does not hold any instruction (the program counter is always masked to 12 bits, so it can never match this value). */
+#define INTERPRETER_DECODE_CACHE_INVALID_ADDRESS 0xFFFF
+
+/** The benchmark stops the program after this amount of instructions by default. */
+#define INTERPRETER_BENCHMARK_DEFAULT_MAXIMUM_INSTRUCTIONS_COUNT 1000000UL
+/** How many characters of the ROM file name are kept for the benchmark report (a 8.3 file name and the terminating zero). */
+#define INTERPRETER_BENCHMARK_ROM_FILE_NAME_SIZE 13
+
+/** The key that must be held with the menu key to enable the turbo mode. The turbo mode lasts as long as both keys are held (the game does not see this key while the menu key is held). */
+#define INTERPRETER_TURBO_CHORD_KEY KEYBOARD_KEY_RIGHT
+/** How many times faster than real time the timers and the game logic run in turbo mode. Only one frame out of this value is displayed. */
+#define INTERPRETER_TURBO_SPEED_FACTOR 4
+
+/** How many executed instructions the trace buffer remembers. This must be a power of two. */
+#define INTERPRETER_TRACE_BUFFER_ENTRIES_COUNT 32
+/** The address value telling that a trace buffer entry has not been written yet. */
+#define INTERPRETER_TRACE_BUFFER_INVALID_ADDRESS 0xFFFF
+
+/** The bytes starting the profiler binary dump, they allow the host script to find the dump among the log messages. */
+#define INTERPRETER_PROFILER_DUMP_MAGIC_NUMBER "C8PH"
+
+/** How many program bytes are gathered in a single program counter sampling histogram entry. This must be a power of two. */
+#define INTERPRETER_PC_SAMPLING_BUCKET_SIZE 16
+/** How many histogram entries are needed to cover the program memory (the memory before the program entry point, containing the fonts, is not sampled). */
+#define INTERPRETER_PC_SAMPLING_BUCKETS_COUNT ((INTERPRETER_MEMORY_SIZE - INTERPRETER_PROGRAM_ENTRY_POINT) / INTERPRETER_PC_SAMPLING_BUCKET_SIZE)
+/** The bytes starting the program counter sampling binary dump. */
+#define INTERPRETER_PC_SAMPLING_DUMP_MAGIC_NUMBER "C8PS"
+
+/** How many cost measurement entries there are : one per instruction ID, then the half-size and the full-size frame buffer transfers. */
+#define INTERPRETER_COST_MEASUREMENT_ENTRIES_COUNT (INTERPRETER_INSTRUCTION_IDS_COUNT + 2)
+/** The bytes starting the cost measurement binary dump. */
+#define INTERPRETER_COST_MEASUREMENT_DUMP_MAGIC_NUMBER "C8CM"
+
+/** The bytes starting an input stream, they allow the host script to find the recorded stream among the log messages. */
+#define INTERPRETER_INPUT_STREAM_MAGIC_NUMBER "C8IS"
+/** The frames count value marking the end of the input stream (an event can thus be delayed by 254 frames at most). */
+#define INTERPRETER_INPUT_STREAM_END_MARKER 0xFF
+
+/** How many instructions the body of a loop waiting for the delay timer can contain at most (the body is checked each time the loop jumps back, so it must stay short). */
+#define INTERPRETER_IDLE_LOOP_MAXIMUM_INSTRUCTIONS_COUNT 8
+
+/** How many instruction cycles are executed in one microsecond (the CPU executes 16 MIPS). */
+#define INTERPRETER_INSTRUCTION_CYCLES_PER_MICROSECOND 16
+
+/** The size in bytes of the biggest sprite (a 16x16 pixels sprite). */
+#define INTERPRETER_SPRITE_MAXIMUM_SIZE 32
+/** The widest sprite is 16 pixels. */
+#define INTERPRETER_SPRITE_MAXIMUM_COLUMNS_COUNT 16
+/** A 16-pixel high sprite that is not aligned on a frame buffer page covers 3 pages. */
+#define INTERPRETER_SPRITE_MAXIMUM_PAGES_COUNT 3
+/** The sprites having up to this amount of rows (the particles, the bullets...) are transposed pixel by pixel, moving their few lit pixels costs less than a 8x8 bits matrix transposition. */
+#define INTERPRETER_SPRITE_SMALL_MAXIMUM_ROWS_COUNT 3
+
+/** How many display planes the programs can draw to, the XO-CHIP adds a second plane to the Chip-8 frame buffer. */
+#if INTERPRETER_IS_XO_CHIP_ENABLED == 1
+	#define INTERPRETER_DISPLAY_PLANES_COUNT 2
+#else
+	#define INTERPRETER_DISPLAY_PLANES_COUNT 1
+#endif
+
+/** How many instructions to execute between two menu key and rendering checks when the game does not regulate its speed. */
+#define INTERPRETER_UNTHROTTLED_SLICE_INSTRUCTIONS_COUNT 64
+
+/** Discard the decoded instructions containing the specified memory byte (this compiles to nothing when the decode cache is disabled).
+ * @param Address The address of the modified byte.
+ */
+#if INTERPRETER_IS_DECODE_CACHE_ENABLED == 1
+	#define INTERPRETER_DECODE_CACHE_INVALIDATE(Address) InterpreterDecodeCacheInvalidate(Address)
+#else
+	#define INTERPRETER_DECODE_CACHE_INVALIDATE(Address)
+#endif
+
+/** Find the decode cache entry that can hold the instruction located at the specified address.
+ * @param Address The instruction address.
+ */
+#define INTERPRETER_DECODE_CACHE_GET_ENTRY(Address) (&Interpreter_Decode_Cache[((Address) >> 1) & (INTERPRETER_DECODE_CACHE_ENTRIES_COUNT - 1)])
+
+/** Tell whether an instruction draws a sprite, the benchmark measures the time spent in these instructions.
+ * @param ID The instruction ID.
+ */
+#if INTERPRETER_IS_INSTRUCTION_FUSION_ENABLED == 1
+	#define INTERPRETER_IS_DRW_INSTRUCTION(ID) (((ID) == INTERPRETER_INSTRUCTION_ID_DRW_VX_VY_NIBBLE) || ((ID) == INTERPRETER_INSTRUCTION_ID_LD_I_ADDRESS_DRW_VX_VY_NIBBLE))
+#else
+	#define INTERPRETER_IS_DRW_INSTRUCTION(ID) ((ID) == INTERPRETER_INSTRUCTION_ID_DRW_VX_VY_NIBBLE)
+#endif
+
+/** Make the program counter skip the instruction it points to. The XO-CHIP LD I, long address instruction (F000 nnnn) is 4-byte long, so it is entirely skipped. */
+#if INTERPRETER_IS_XO_CHIP_ENABLED == 1
+	#define INTERPRETER_SKIP_NEXT_INSTRUCTION() Interpreter_Register_PC += ((Shared_Buffers.Interpreter_Memory[Interpreter_Register_PC & 0x0FFF] == 0xF0) && (Shared_Buffers.Interpreter_Memory[(Interpreter_Register_PC + 1) & 0x0FFF] == 0x00)) ? 4 : 2
+#else
+	#define INTERPRETER_SKIP_NEXT_INSTRUCTION() Interpreter_Register_PC += 2
+#endif
+
 /** Display a sprite byte to the specified display location, XORing with what is already displayed. This is made as macro to make sure that the content will be inlined.
  * @param Pointer_Display The display location in the frame buffer.
  * @param Sprite_Byte The sprite data to render.
- * @param Is_Collision_Detected On output, set to 1 if a collision was detected (i.e. if an already lighted pixel was cleared). The variable is not modified if no collision was detected, so make sure it is set to 0 before calling the macro.
+ * @param Collision_Bits On output, the pixels turned off by the sprite are ORed to this variable, so a single test after the whole sprite has been drawn tells whether a collision occurred.
  */
-#define INTERPRETER_RENDER_SPRITE_BYTE(Pointer_Display, Sprite_Byte, Is_Collision_Detected) \
+#define INTERPRETER_RENDER_SPRITE_BYTE(Pointer_Display, Sprite_Byte, Collision_Bits) \
 	{ \
-		unsigned char Previous_Byte_Value, Rendered_Byte_Value; \
+		unsigned char Previous_Byte_Value, Rendered_Sprite_Byte; \
 		Previous_Byte_Value = *(Pointer_Display); \
-		Rendered_Byte_Value = Previous_Byte_Value ^ ((unsigned char) (Sprite_Byte)); \
-		*(Pointer_Display) = Rendered_Byte_Value; \
-		/* A collision occurred if any lighted pixel was turned off */ \
-		if ((Rendered_Byte_Value & Previous_Byte_Value) != Previous_Byte_Value) (Is_Collision_Detected) = 1; \
+		Rendered_Sprite_Byte = (unsigned char) (Sprite_Byte); \
+		*(Pointer_Display) = Previous_Byte_Value ^ Rendered_Sprite_Byte; \
+		/* A lighted pixel is turned off where both the display and the sprite pixels are lighted */ \
+		(Collision_Bits) |= Previous_Byte_Value & Rendered_Sprite_Byte; \
+	}
+
+/** Generate the handler of a bitwise operation between two registers (OR, AND, XOR).
+ * @param Function_Name The handler name.
+ * @param String_Mnemonic The instruction name displayed in the log messages.
+ * @param Operator The compound assignment operator doing the operation.
+ * @param Is_VF_Reset_Enabled Set to 1 to reset VF after the operation, set to 0 to keep it unchanged. Provide a variable to choose at runtime.
+ */
+#define INTERPRETER_GENERATE_BITWISE_OPERATION_HANDLER(Function_Name, String_Mnemonic, Operator, Is_VF_Reset_Enabled) \
+	static void Function_Name(unsigned char Register_Index_X, unsigned char Register_Index_Y, unsigned short Operand) \
+	{ \
+		LOG(INTERPRETER_IS_LOGGING_ENABLED, String_Mnemonic " V%01X (= 0x%02X), V%01X (= 0x%02X).", Register_Index_X, Interpreter_Registers_V[Register_Index_X], Register_Index_Y, Interpreter_Registers_V[Register_Index_Y]); \
+		Interpreter_Registers_V[Register_Index_X] Operator Interpreter_Registers_V[Register_Index_Y]; \
+		\
+		/* Apply the reset VF quirk if enabled */ \
+		if (Is_VF_Reset_Enabled) Interpreter_Registers_V[15] = 0; \
+	}
+
+/** Generate the handler of a shift instruction (SHR, SHL).
+ * @param Function_Name The handler name.
+ * @param String_Mnemonic The instruction name displayed in the log messages.
+ * @param Shifted_Out_Bit_Mask The mask of the bit that is lost by the shift operation.
+ * @param Operator The compound assignment operator shifting the value by one bit.
+ * @param Is_Shift_Using_Vy_Enabled Set to 1 to shift the Vy value, set to 0 to shift the Vx value. Provide a variable to choose at runtime.
+ */
+#define INTERPRETER_GENERATE_SHIFT_HANDLER(Function_Name, String_Mnemonic, Shifted_Out_Bit_Mask, Operator, Is_Shift_Using_Vy_Enabled) \
+	static void Function_Name(unsigned char Register_Index_X, unsigned char Register_Index_Y, unsigned short Operand) \
+	{ \
+		unsigned char Value, Is_Bit_Shifted_Out; \
+		\
+		/* Use the value provided by Vy if asked to */ \
+		if (Is_Shift_Using_Vy_Enabled) \
+		{ \
+			Value = Interpreter_Registers_V[Register_Index_Y]; \
+			LOG(INTERPRETER_IS_LOGGING_ENABLED, String_Mnemonic " V%01X (= 0x%02X), V%01X = (0x%02X).", Register_Index_X, Interpreter_Registers_V[Register_Index_X], Register_Index_Y, Value); \
+		} \
+		else \
+		{ \
+			/* Retrieve the Vx value */ \
+			Value = Interpreter_Registers_V[Register_Index_X]; \
+			LOG(INTERPRETER_IS_LOGGING_ENABLED, String_Mnemonic " V%01X (= 0x%02X).", Register_Index_X, Value); \
+		} \
+		\
+		if (Value & (Shifted_Out_Bit_Mask)) Is_Bit_Shifted_Out = 1; /* Set VF if the bit that is shifted out is set */ \
+		else Is_Bit_Shifted_Out = 0; \
+		Value Operator 1; \
+		Interpreter_Registers_V[Register_Index_X] = Value; \
+		\
+		/* Set VF at the end, in case VF was the output register just before */ \
+		Interpreter_Registers_V[15] = Is_Bit_Shifted_Out; \
+	}
+
+/** Generate the handler of the LD [I], Vx instruction.
+ * @param Function_Name The handler name.
+ * @param Is_Memory_Load_Store_Increment_Enabled Set to 1 to leave the I register pointing after the last stored register, set to 0 to keep it unchanged. Provide a variable to choose at runtime.
+ */
+#define INTERPRETER_GENERATE_STORE_REGISTERS_HANDLER(Function_Name, Is_Memory_Load_Store_Increment_Enabled) \
+	static void Function_Name(unsigned char Register_Index_X, unsigned char Register_Index_Y, unsigned short Operand) \
+	{ \
+		unsigned char i; \
+		unsigned short Temporary_Register_I; \
+	\
+		LOG(INTERPRETER_IS_LOGGING_ENABLED, "LD [I] (= 0x%03X), V%01X.", Interpreter_Register_I, Register_Index_X); \
+	\
+		/* Store the requested amount of registers to the address pointed by the I register */ \
+		Temporary_Register_I = Interpreter_Register_I; \
+		for (i = 0; i <= Register_Index_X; i++) \
+		{ \
+			Shared_Buffers.Interpreter_Memory[Temporary_Register_I] = Interpreter_Registers_V[i]; \
+			INTERPRETER_DECODE_CACHE_INVALIDATE(Temporary_Register_I); /* The program may be modifying its own code */ \
+			Temporary_Register_I = (Temporary_Register_I + 1) & 0x0FFF; /* Avoid overflowing the interpreter memory buffer */ \
+		} \
+	\
+		/* Increment the I register only for required games */ \
+		if (Is_Memory_Load_Store_Increment_Enabled) Interpreter_Register_I = Temporary_Register_I; \
+	}
+
+/** Generate the handler of the LD Vx, [I] instruction.
+ * @param Function_Name The handler name.
+ * @param Is_Memory_Load_Store_Increment_Enabled Set to 1 to leave the I register pointing after the last loaded register, set to 0 to keep it unchanged. Provide a variable to choose at runtime.
+ */
+#define INTERPRETER_GENERATE_LOAD_REGISTERS_HANDLER(Function_Name, Is_Memory_Load_Store_Increment_Enabled) \
+	static void Function_Name(unsigned char Register_Index_X, unsigned char Register_Index_Y, unsigned short Operand) \
+	{ \
+		unsigned char i; \
+		unsigned short Temporary_Register_I; \
+	\
+		LOG(INTERPRETER_IS_LOGGING_ENABLED, "LD V%01X, [I] (= 0x%03X).", Register_Index_X, Interpreter_Register_I); \
+	\
+		/* Store the requested amount of registers to the address pointed by the I register */ \
+		Temporary_Register_I = Interpreter_Register_I; \
+		for (i = 0; i <= Register_Index_X; i++) \
+		{ \
+			Interpreter_Registers_V[i] = Shared_Buffers.Interpreter_Memory[Temporary_Register_I]; \
+			Temporary_Register_I = (Temporary_Register_I + 1) & 0x0FFF; /* Avoid overflowing the interpreter memory buffer */ \
+		} \
+	\
+		/* Increment the I register only for required games */ \
+		if (Is_Memory_Load_Store_Increment_Enabled) Interpreter_Register_I = Temporary_Register_I; \
+	}
+
+/** Generate the handler of the DRW Vx, Vy, nibble instruction.
+ * @param Function_Name The handler name.
+ * @param Is_Display_Wrapping_Enabled Set to 1 to make the sprites wrap around the display edges, set to 0 to clip them. Provide a variable to choose at runtime.
+ * @param Is_Fast_Rendering_Enabled Set to 1 to transfer the frame buffer to the display at the next tick, set to 0 to transfer it immediately. Provide a variable to choose at runtime.
+ */
+#define INTERPRETER_GENERATE_DRW_HANDLER(Function_Name, Is_Display_Wrapping_Enabled, Is_Fast_Rendering_Enabled) \
+	static void Function_Name(unsigned char Register_Index_X, unsigned char Register_Index_Y, unsigned short Operand) \
+	{ \
+		unsigned char *Pointer_Sprite, Sprite_Size, Sprite_Visible_Size, Sprite_Row, Sprite_Column, Sprite_Bytes_Per_Row, Sprite_Data_Size, Collision_Bits, Plane, Plane_Mask, Sprite_Buffer[INTERPRETER_SPRITE_MAXIMUM_SIZE], Sprite_Columns[INTERPRETER_SPRITE_MAXIMUM_PAGES_COUNT * INTERPRETER_SPRITE_MAXIMUM_COLUMNS_COUNT]; \
+		unsigned short Sprite_Address; \
+		TInterpreterSpriteLayout Layout; \
+	\
+		/* Extract the operands */ \
+		Sprite_Size = (unsigned char) Operand; \
+		LOG(INTERPRETER_IS_LOGGING_ENABLED, "DRW V%01X (= 0x%02X), V%01X (= 0x%02X), %d with I = 0x%03X.", Register_Index_X, Interpreter_Registers_V[Register_Index_X], Register_Index_Y, Interpreter_Registers_V[Register_Index_Y], Sprite_Size, Interpreter_Register_I); \
+	\
+		/* Retrieve the sprite displaying coordinates, the starting coordinates always wrap around the display */ \
+		Sprite_Column = Interpreter_Registers_V[Register_Index_X] & (Interpreter_Display_Columns_Count - 1); \
+		Sprite_Row = Interpreter_Registers_V[Register_Index_Y] & (Interpreter_Display_Rows_Count - 1); \
+	\
+		/* Handle the special case of a 16x16 pixels sprite */ \
+		if (Sprite_Size == 0) \
+		{ \
+			Sprite_Size = 16; \
+			Sprite_Bytes_Per_Row = 2; \
+		} \
+		else Sprite_Bytes_Per_Row = 1; \
+		Sprite_Data_Size = Sprite_Size * Sprite_Bytes_Per_Row; \
+	\
+		/* The clipping mode discards the rows crossing the display bottom edge */ \
+		Sprite_Visible_Size = Sprite_Size; \
+		if ((!(Is_Display_Wrapping_Enabled)) && (Sprite_Row + Sprite_Size > Interpreter_Display_Rows_Count)) Sprite_Visible_Size = Interpreter_Display_Rows_Count - Sprite_Row; \
+		/* The vertical scrolling moved the display top row, the frame buffer rows are a ring so the remaining sprite rows always wrap around the frame buffer end */ \
+		Sprite_Row = (Sprite_Row + Interpreter_Display_Row_Offset) & (Interpreter_Display_Rows_Count - 1); \
+	\
+		/* Find the covered pages and columns once for all planes */ \
+		InterpreterPrepareSpriteLayout(Sprite_Column, Sprite_Row, Sprite_Bytes_Per_Row * 8, Sprite_Visible_Size, Is_Display_Wrapping_Enabled, &Layout); \
+	\
+		/* Draw the sprite to each selected plane, when several planes are selected the sprite data of a plane follows the previous plane one */ \
+		Collision_Bits = 0; \
+		Sprite_Address = Interpreter_Register_I; \
+		for (Plane = 0, Plane_Mask = 1; Plane < INTERPRETER_DISPLAY_PLANES_COUNT; Plane++, Plane_Mask <<= 1) \
+		{ \
+			if (!(Interpreter_Selected_Planes_Mask & Plane_Mask)) continue; \
+			Pointer_Sprite = InterpreterGetSpriteData(Sprite_Address, Sprite_Data_Size, Sprite_Buffer); \
+	\
+			/* The frame buffer stores vertical bytes, so turn the sprite rows into columns before XORing them to the plane pages */ \
+			InterpreterTransposeSprite(Pointer_Sprite, Sprite_Visible_Size, Sprite_Bytes_Per_Row, Layout.Row_Shift, Sprite_Columns); \
+			Collision_Bits |= InterpreterDrawSpriteColumns(&Layout, Interpreter_Display_Planes[Plane], Sprite_Columns); \
+			Sprite_Address += Sprite_Data_Size; \
+		} \
+	\
+		/* The frame buffer must be transferred to the display at 60Hz */ \
+		if (Is_Fast_Rendering_Enabled) Interpreter_Is_Rendering_Needed = 1; \
+		/* Transfer the frame buffer at each DRW call because some games use this as a delay */ \
+		else \
+		{ \
+			InterpreterDrawFrameBuffer(); \
+			Interpreter_Is_Rendering_Needed = 0; /* A previous CLS instruction is displayed too */ \
+		} \
+	\
+		/* Set register VF if at least one already lighted pixel has been turned off */ \
+		if (Collision_Bits != 0) Interpreter_Registers_V[15] = 1; \
+		else Interpreter_Registers_V[15] = 0; \
 	}
 
+#if (INTERPRETER_IS_INSTRUCTION_FUSION_ENABLED == 1) && (INTERPRETER_IS_DECODE_CACHE_ENABLED == 0)
+	#error "The instruction fusion needs the decode cache."
+#endif
+#if (INTERPRETER_IS_COST_MEASUREMENT_ENABLED == 1) && (INTERPRETER_IS_BENCHMARK_ENABLED == 0)
+	#error "The cost measurement needs the benchmark time counter."
+#endif
+#if (INTERPRETER_IS_RECOMPILER_ENABLED == 1) && (INTERPRETER_IS_DECODE_CACHE_ENABLED == 0)
+	#error "The recompiled code is disabled by the decode cache invalidation, so it needs the decode cache."
+#endif
+
+//-------------------------------------------------------------------------------------------------
+// Private types
+//-------------------------------------------------------------------------------------------------
+/** All instructions the interpreter can execute, the values are contiguous to allow them to be used as array indexes. */
+typedef enum : unsigned char
+{
+	INTERPRETER_INSTRUCTION_ID_INVALID, //!< Any unsupported encoding, it is the value 0 so the decoding tables entries that are not explicitly initialized are invalid
+	INTERPRETER_INSTRUCTION_ID_SCROLL_DOWN, //!< 00Cn
+	INTERPRETER_INSTRUCTION_ID_SCROLL_UP, //!< 00Dn
+	INTERPRETER_INSTRUCTION_ID_CLS, //!< 00E0
+	INTERPRETER_INSTRUCTION_ID_RET, //!< 00EE
+	INTERPRETER_INSTRUCTION_ID_SCROLL_RIGHT, //!< 00FB
+	INTERPRETER_INSTRUCTION_ID_SCROLL_LEFT, //!< 00FC
+	INTERPRETER_INSTRUCTION_ID_EXIT, //!< 00FD
+	INTERPRETER_INSTRUCTION_ID_LOW, //!< 00FE
+	INTERPRETER_INSTRUCTION_ID_HIGH, //!< 00FF
+	INTERPRETER_INSTRUCTION_ID_JP_ADDRESS, //!< 1nnn
+	INTERPRETER_INSTRUCTION_ID_CALL_ADDRESS, //!< 2nnn
+	INTERPRETER_INSTRUCTION_ID_SE_VX_BYTE, //!< 3xkk
+	INTERPRETER_INSTRUCTION_ID_SNE_VX_BYTE, //!< 4xkk
+	INTERPRETER_INSTRUCTION_ID_SE_VX_VY, //!< 5xy0
+	INTERPRETER_INSTRUCTION_ID_SAVE_VX_VY, //!< 5xy2
+	INTERPRETER_INSTRUCTION_ID_LOAD_VX_VY, //!< 5xy3
+	INTERPRETER_INSTRUCTION_ID_LD_VX_BYTE, //!< 6xkk
+	INTERPRETER_INSTRUCTION_ID_ADD_VX_BYTE, //!< 7xkk
+	INTERPRETER_INSTRUCTION_ID_LD_VX_VY, //!< 8xy0
+	INTERPRETER_INSTRUCTION_ID_OR_VX_VY, //!< 8xy1
+	INTERPRETER_INSTRUCTION_ID_AND_VX_VY, //!< 8xy2
+	INTERPRETER_INSTRUCTION_ID_XOR_VX_VY, //!< 8xy3
+	INTERPRETER_INSTRUCTION_ID_ADD_VX_VY, //!< 8xy4
+	INTERPRETER_INSTRUCTION_ID_SUB_VX_VY, //!< 8xy5
+	INTERPRETER_INSTRUCTION_ID_SHR_VX_VY, //!< 8xy6
+	INTERPRETER_INSTRUCTION_ID_SUBN_VX_VY, //!< 8xy7
+	INTERPRETER_INSTRUCTION_ID_SHL_VX_VY, //!< 8xyE
+	INTERPRETER_INSTRUCTION_ID_SNE_VX_VY, //!< 9xy0
+	INTERPRETER_INSTRUCTION_ID_LD_I_ADDRESS, //!< Annn
+	INTERPRETER_INSTRUCTION_ID_JP_V0_ADDRESS, //!< Bnnn
+	INTERPRETER_INSTRUCTION_ID_RND_VX_BYTE, //!< Cxkk
+	INTERPRETER_INSTRUCTION_ID_DRW_VX_VY_NIBBLE, //!< Dxyn
+	INTERPRETER_INSTRUCTION_ID_SKP_VX, //!< Ex9E
+	INTERPRETER_INSTRUCTION_ID_SKNP_VX, //!< ExA1
+	INTERPRETER_INSTRUCTION_ID_LD_I_LONG_ADDRESS, //!< F000 nnnn, the operand contains nnnn
+	INTERPRETER_INSTRUCTION_ID_PLANE, //!< Fn01, x contains n
+	INTERPRETER_INSTRUCTION_ID_LD_VX_DT, //!< Fx07
+	INTERPRETER_INSTRUCTION_ID_LD_VX_K, //!< Fx0A
+	INTERPRETER_INSTRUCTION_ID_LD_DT_VX, //!< Fx15
+	INTERPRETER_INSTRUCTION_ID_LD_ST_VX, //!< Fx18
+	INTERPRETER_INSTRUCTION_ID_ADD_I_VX, //!< Fx1E
+	INTERPRETER_INSTRUCTION_ID_LD_F_VX, //!< Fx29
+	INTERPRETER_INSTRUCTION_ID_LD_HF_VX, //!< Fx30
+	INTERPRETER_INSTRUCTION_ID_LD_B_VX, //!< Fx33
+	INTERPRETER_INSTRUCTION_ID_LD_MEMORY_I_VX, //!< Fx55
+	INTERPRETER_INSTRUCTION_ID_LD_VX_MEMORY_I, //!< Fx65
+	INTERPRETER_INSTRUCTION_ID_LD_R_VX, //!< Fx75
+	INTERPRETER_INSTRUCTION_ID_LD_VX_R, //!< Fx85
+	#if INTERPRETER_IS_INSTRUCTION_FUSION_ENABLED == 1
+		// The fused instructions must be located after all other instructions
+		INTERPRETER_INSTRUCTION_ID_SE_VX_BYTE_JP_ADDRESS, //!< 3xkk 1nnn, y contains kk and the operand contains nnn
+		INTERPRETER_INSTRUCTION_ID_SNE_VX_BYTE_JP_ADDRESS, //!< 4xkk 1nnn, y contains kk and the operand contains nnn
+		INTERPRETER_INSTRUCTION_ID_LD_VX_BYTE_LD_VY_BYTE, //!< 6xkk 6ykk, the operand low byte contains the first kk and the operand high byte contains the second kk
+		INTERPRETER_INSTRUCTION_ID_LD_I_ADDRESS_DRW_VX_VY_NIBBLE, //!< Annn Dxyn, the operand contains nnn in its 12 lower bits and n in its 4 upper bits
+		INTERPRETER_INSTRUCTION_ID_LD_I_ADDRESS_ADD_I_VX, //!< Annn Fx1E
+	#endif
+	INTERPRETER_INSTRUCTION_IDS_COUNT,
+	#if INTERPRETER_IS_INSTRUCTION_FUSION_ENABLED == 1
+		INTERPRETER_INSTRUCTION_ID_FIRST_FUSED = INTERPRETER_INSTRUCTION_ID_SE_VX_BYTE_JP_ADDRESS //!< All IDs starting from this one execute two instructions
+	#endif
+} TInterpreterInstructionID;
+
+/** Find the instruction of an opcode class from the opcode low byte with a single table access. */
+typedef struct
+{
+	const TInterpreterInstructionID *Pointer_Instruction_IDs; //!< The instructions of the class, indexed by the masked opcode low byte.
+	unsigned char Low_Byte_Mask; //!< The opcode low byte bits telling the class instructions apart, it is 0 for the classes made of a single instruction.
+} TInterpreterInstructionClass;
+
+/** An instruction with all its operands already extracted, so it can be executed without decoding it again. */
+typedef struct
+{
+	unsigned short Address; //!< The address the instruction was fetched from, it is used as the decode cache tag.
+	TInterpreterInstructionID ID; //!< What instruction to execute.
+	unsigned char Register_Index_X; //!< The x nibble of the instruction.
+	unsigned char Register_Index_Y; //!< The y nibble of the instruction.
+	unsigned short Operand; //!< The nnn address, the kk byte or the n nibble (its meaning depends on the instruction).
+} TInterpreterDecodedInstruction;
+
+/** An executed instruction remembered by the trace buffer. */
+typedef struct
+{
+	unsigned short Address; //!< The address the instruction was fetched from.
+	unsigned char Opcode_High_Byte; //!< The instruction first byte.
+	unsigned char Opcode_Low_Byte; //!< The instruction second byte.
+} TInterpreterTraceBufferEntry;
+
+/** Tell whether the program can continue running. */
+typedef enum : unsigned char
+{
+	INTERPRETER_EXECUTION_STATE_RUNNING,
+	INTERPRETER_EXECUTION_STATE_EXIT, //!< The program terminated or the user asked to leave it.
+	INTERPRETER_EXECUTION_STATE_ERROR, //!< The program did something forbidden, the error has already been displayed.
+	INTERPRETER_EXECUTION_STATE_IDLE //!< The program can't do anything useful until the next tick, the current slice can be stopped.
+} TInterpreterExecutionState;
+
+/** Where the keys seen by the program come from. */
+typedef enum : unsigned char
+{
+	INTERPRETER_INPUT_STREAM_MODE_DISABLED, //!< The keys are read from the keyboard.
+	INTERPRETER_INPUT_STREAM_MODE_RECORD, //!< The keys are read from the keyboard, and each change is written to the input stream.
+	INTERPRETER_INPUT_STREAM_MODE_REPLAY //!< The keys and the random seed are read from the input stream, the keyboard is ignored (except for the menu key).
+} TInterpreterInputStreamMode;
+
+/** Where the sprite columns are drawn in the frame buffer, this is computed once for all planes of a sprite. */
+typedef struct
+{
+	unsigned char Columns_Count; //!< How many bytes a frame buffer page is made of (it is the display width).
+	unsigned char Pages_Count; //!< How many pages the frame buffer is made of.
+	unsigned char Column; //!< The frame buffer column receiving the sprite leftmost pixels.
+	unsigned char Page; //!< The frame buffer page receiving the sprite top pixels.
+	unsigned char Row_Shift; //!< How many pixels the sprite top is below the page top.
+	unsigned char Sprite_Pages_Count; //!< How many frame buffer pages are covered by the sprite, the pages following the last one wrap around to the first one.
+	unsigned char Right_Columns_Count; //!< How many sprite columns are drawn from the sprite column to the display right edge.
+	unsigned char Left_Columns_Count; //!< How many sprite columns wrap around the display right edge to the display left side (it is always 0 if the clipping mode is enabled).
+} TInterpreterSpriteLayout;
+
+/** All instructions are executed by a function with this prototype.
+ * @param Register_Index_X The x nibble of the instruction.
+ * @param Register_Index_Y The y nibble of the instruction.
+ * @param Operand The nnn address, the kk byte or the n nibble (its meaning depends on the instruction).
+ * @note The program counter is already pointing to the next instruction when the function is called.
+ */
+typedef void (*TInterpreterInstructionHandler)(unsigned char Register_Index_X, unsigned char Register_Index_Y, unsigned short Operand);
+
+#if INTERPRETER_IS_RECOMPILER_ENABLED == 1
+	/** The function running a block of the translated program.
+	 * @param Remaining_Instructions_Count How many instructions can still be executed in the current slice, it is never 0. The block stops when they have all been executed, so the slices stay the same than when the program is interpreted.
+	 * @return How many instructions can still be executed in the slice, counting the instruction that left the block.
+	 * @note The program counter points to the next instruction to execute when the function returns.
+	 */
+	typedef unsigned short (*TInterpreterRecompiledBlockFunction)(unsigned short Remaining_Instructions_Count);
+
+	/** A block of the translated program, it starts at the only instruction the block can be entered from. */
+	typedef struct
+	{
+		unsigned short Address; //!< The block entry point.
+		TInterpreterRecompiledBlockFunction Function; //!< The translated block code.
+	} TInterpreterRecompiledBlock;
+
+	/** Some consecutive program bytes a translated block has been built from, the block must be disabled if the program writes to them. */
+	typedef struct
+	{
+		unsigned short Block_Index; //!< The block in the translated blocks table.
+		unsigned short Start_Address; //!< The first byte address.
+		unsigned short End_Address; //!< The address following the last byte.
+	} TInterpreterRecompiledCodeRange;
+#endif
+
+//-------------------------------------------------------------------------------------------------
+// Public variables
+//-------------------------------------------------------------------------------------------------
+#if INTERPRETER_IS_BENCHMARK_ENABLED == 1
+	unsigned long Interpreter_Benchmark_Maximum_Instructions_Count = INTERPRETER_BENCHMARK_DEFAULT_MAXIMUM_INSTRUCTIONS_COUNT;
+	unsigned long Interpreter_Benchmark_Instructions_Count;
+#endif
+
+#if INTERPRETER_IS_RECOMPILER_ENABLED == 1
+	unsigned long Interpreter_Recompiler_Instructions_Count;
+#endif
+
+#if INTERPRETER_IS_COST_MODEL_ENABLED == 1
+	unsigned short Interpreter_Cost_Model_Instruction_Cycles[INTERPRETER_COST_MODEL_MAXIMUM_INSTRUCTION_IDS_COUNT];
+	unsigned long Interpreter_Cost_Model_Cycles_Count;
+
+	_Static_assert(INTERPRETER_INSTRUCTION_IDS_COUNT <= INTERPRETER_COST_MODEL_MAXIMUM_INSTRUCTION_IDS_COUNT, "The cost model table is too small for all instructions.");
+#endif
+
 //-------------------------------------------------------------------------------------------------
 // Private variables
 //-------------------------------------------------------------------------------------------------
@@ -171,10 +641,339 @@ static unsigned char Interpreter_Is_Shift_Using_Vy_Enabled;
 static unsigned char Interpreter_Is_VF_Reset_Enabled;
 /** Add some milliseconds of delay to the DRAW instruction. This is active only when the fast rendering mode is enabled. */
 static unsigned char Interpreter_Rendering_Delay;
+/** How many instructions to execute during a 60Hz frame, 0 means that the instructions are executed as fast as possible. */
+static unsigned short Interpreter_Instructions_Per_Frame;
+
+#if INTERPRETER_IS_DECODE_CACHE_ENABLED == 1
+	/** A direct-mapped cache of the already decoded instructions, indexed by the instruction address. */
+	static TInterpreterDecodedInstruction Interpreter_Decode_Cache[INTERPRETER_DECODE_CACHE_ENTRIES_COUNT];
+#endif
+
+/** The current display width in pixels. */
+static unsigned char Interpreter_Display_Columns_Count;
+/** The current display height in pixels. */
+static unsigned char Interpreter_Display_Rows_Count;
+/** The frame buffer row displayed at the display top, the frame buffer rows are a ring so the vertical scrolling instructions only move this row and clear the exposed rows. */
+static unsigned char Interpreter_Display_Row_Offset;
+/** Set to 1 when the SuperChip-8 128x64 display mode is selected. */
+static unsigned char Interpreter_Is_High_Resolution_Enabled;
+/** Set to 1 when the fast rendering mode or the CLS instruction have changed the frame buffer, and the changes have not been sent to the display yet. */
+static unsigned char Interpreter_Is_Rendering_Needed;
+/** The columns of each frame buffer page that changed since the last transfer, only these parts are sent to the display. */
+static TDisplayDirtyColumns Interpreter_Dirty_Pages[DISPLAY_ROWS_COUNT / 8];
+/** Set by the instruction handlers to stop the program execution. */
+static TInterpreterExecutionState Interpreter_Execution_State;
+
+/** Bit n is set when the display plane n is drawn, scrolled and cleared by the instructions (the XO-CHIP programs select the planes with the PLANE instruction). */
+static unsigned char Interpreter_Selected_Planes_Mask;
+/** Set to 1 once the program selected the second display plane, the display then shows the combination of both planes. */
+static unsigned char Interpreter_Is_Second_Plane_Enabled;
+/** The frame buffer of each display plane, the second plane uses memory that is not needed while a game is running. */
+static unsigned char * const Interpreter_Display_Planes[INTERPRETER_DISPLAY_PLANES_COUNT] =
+{
+	Shared_Buffer_Display,
+	#if INTERPRETER_IS_XO_CHIP_ENABLED == 1
+		Shared_Buffers.Interpreter_Display_Second_Plane
+	#endif
+};
+
+/** Set to 1 when the turbo mode is running. */
+static unsigned char Interpreter_Is_Turbo_Enabled;
+/** The fast rendering setting of the game, it is restored when the turbo mode ends. */
+static unsigned char Interpreter_Turbo_Saved_Is_Fast_Rendering_Enabled;
+/** How many ticks remain before the next frame is displayed in turbo mode. */
+static unsigned char Interpreter_Turbo_Skipped_Frames_Count;
+
+#if INTERPRETER_IS_IDLE_STATISTICS_ENABLED == 1
+	/** How many times the Idle mode was entered. */
+	static unsigned long Interpreter_Idle_Mode_Entries_Count;
+	/** The total time spent in Idle mode, in microseconds. */
+	static unsigned long Interpreter_Idle_Mode_Duration;
+#endif
+
+#if INTERPRETER_IS_TRACE_BUFFER_ENABLED == 1
+	/** The last executed instructions. The opcodes are kept because the program memory may be overwritten by the error message. */
+	static TInterpreterTraceBufferEntry Interpreter_Trace_Buffer[INTERPRETER_TRACE_BUFFER_ENTRIES_COUNT];
+	/** The trace buffer entry to write the next instruction to, this is also the oldest entry. */
+	static unsigned char Interpreter_Trace_Buffer_Index;
+#endif
+
+#if INTERPRETER_IS_PROFILER_ENABLED == 1
+	/** How many times each instruction was executed, indexed by the instruction ID. The counters saturate at 65535. */
+	static unsigned short Interpreter_Profiler_Instruction_Counters[INTERPRETER_INSTRUCTION_IDS_COUNT];
+#endif
+
+#if INTERPRETER_IS_COST_MEASUREMENT_ENABLED == 1
+	/** How many times each measured operation was executed. */
+	static unsigned long Interpreter_Cost_Measurement_Counts[INTERPRETER_COST_MEASUREMENT_ENTRIES_COUNT];
+	/** The total time spent in each measured operation, in microseconds. */
+	static unsigned long Interpreter_Cost_Measurement_Durations[INTERPRETER_COST_MEASUREMENT_ENTRIES_COUNT];
+	/** The time spent transferring the frame buffer during the current instruction, it is removed from the instruction time so the transfers are accounted only once. */
+	static unsigned short Interpreter_Cost_Measurement_Nested_Duration;
+#endif
+
+#if INTERPRETER_IS_BENCHMARK_ENABLED == 1
+	/** The name of the running ROM file, it is copied before the file is loaded because the INI section holding it is overwritten. */
+	static char Interpreter_Benchmark_String_ROM_File_Name[INTERPRETER_BENCHMARK_ROM_FILE_NAME_SIZE];
+	/** How many DRW instructions were executed (including the fused ones). */
+	static unsigned long Interpreter_Benchmark_DRW_Instructions_Count;
+	/** The time spent executing the DRW instructions, in microseconds. */
+	static unsigned long Interpreter_Benchmark_DRW_Duration;
+	/** The total program execution time, in microseconds. */
+	static unsigned long Interpreter_Benchmark_Duration;
+#endif
+
+#if INTERPRETER_IS_INPUT_STREAM_ENABLED == 1
+	/** The input stream mode selected by the game configuration. */
+	static TInterpreterInputStreamMode Interpreter_Input_Stream_Mode;
+	/** The keys seen by the program, they are sampled only once per frame so the replayed program reads them at the same instructions than the recorded one. */
+	static unsigned char Interpreter_Input_Stream_Keys_Mask;
+	/** When recording, how many frames elapsed since the last written event. When replaying, how many frames remain before the next event is applied. */
+	static unsigned char Interpreter_Input_Stream_Frames_Count;
+	/** When replaying, the keys of the next event. */
+	static unsigned char Interpreter_Input_Stream_Next_Keys_Mask;
+#endif
+
+#if INTERPRETER_IS_RECOMPILER_ENABLED == 1
+	/** The translated block starting at each program address, NULL when there is no block or when it has been disabled. */
+	static TInterpreterRecompiledBlockFunction Interpreter_Recompiler_Blocks_Map[INTERPRETER_MEMORY_SIZE];
+	/** Set to 1 for the program bytes at least one enabled block has been built from. */
+	static unsigned char Interpreter_Recompiler_Is_Code_Byte[INTERPRETER_MEMORY_SIZE];
+#endif
+
+#if INTERPRETER_IS_PC_SAMPLING_ENABLED == 1
+	/** How many ticks occurred while the program counter was in each program area. The counters saturate at 65535. */
+	static unsigned short Interpreter_PC_Sampling_Histogram[INTERPRETER_PC_SAMPLING_BUCKETS_COUNT];
+	/** Tell the interrupt handler whether a program is running. */
+	static volatile unsigned char Interpreter_Is_PC_Sampling_Enabled = 0;
+#endif
+
+/** Convert the instruction high nibble to the instruction, for the opcode classes that contain only one instruction. */
+static const TInterpreterInstructionID Interpreter_Instruction_IDs_Classes[16] =
+{
+	INTERPRETER_INSTRUCTION_ID_INVALID, // 0x0 sub-group
+	INTERPRETER_INSTRUCTION_ID_JP_ADDRESS,
+	INTERPRETER_INSTRUCTION_ID_CALL_ADDRESS,
+	INTERPRETER_INSTRUCTION_ID_SE_VX_BYTE,
+	INTERPRETER_INSTRUCTION_ID_SNE_VX_BYTE,
+	INTERPRETER_INSTRUCTION_ID_SE_VX_VY,
+	INTERPRETER_INSTRUCTION_ID_LD_VX_BYTE,
+	INTERPRETER_INSTRUCTION_ID_ADD_VX_BYTE,
+	INTERPRETER_INSTRUCTION_ID_INVALID, // 0x8 sub-group
+	INTERPRETER_INSTRUCTION_ID_SNE_VX_VY,
+	INTERPRETER_INSTRUCTION_ID_LD_I_ADDRESS,
+	INTERPRETER_INSTRUCTION_ID_JP_V0_ADDRESS,
+	INTERPRETER_INSTRUCTION_ID_RND_VX_BYTE,
+	INTERPRETER_INSTRUCTION_ID_DRW_VX_VY_NIBBLE,
+	INTERPRETER_INSTRUCTION_ID_INVALID, // 0xE sub-group
+	INTERPRETER_INSTRUCTION_ID_INVALID // 0xF sub-group
+};
+
+/** Convert the low byte of a 0x0 class instruction to the instruction. */
+static const TInterpreterInstructionID Interpreter_Instruction_IDs_Group_0[256] =
+{
+	[0xC0] = INTERPRETER_INSTRUCTION_ID_SCROLL_DOWN,
+	[0xC1] = INTERPRETER_INSTRUCTION_ID_SCROLL_DOWN,
+	[0xC2] = INTERPRETER_INSTRUCTION_ID_SCROLL_DOWN,
+	[0xC3] = INTERPRETER_INSTRUCTION_ID_SCROLL_DOWN,
+	[0xC4] = INTERPRETER_INSTRUCTION_ID_SCROLL_DOWN,
+	[0xC5] = INTERPRETER_INSTRUCTION_ID_SCROLL_DOWN,
+	[0xC6] = INTERPRETER_INSTRUCTION_ID_SCROLL_DOWN,
+	[0xC7] = INTERPRETER_INSTRUCTION_ID_SCROLL_DOWN,
+	[0xC8] = INTERPRETER_INSTRUCTION_ID_SCROLL_DOWN,
+	[0xC9] = INTERPRETER_INSTRUCTION_ID_SCROLL_DOWN,
+	[0xCA] = INTERPRETER_INSTRUCTION_ID_SCROLL_DOWN,
+	[0xCB] = INTERPRETER_INSTRUCTION_ID_SCROLL_DOWN,
+	[0xCC] = INTERPRETER_INSTRUCTION_ID_SCROLL_DOWN,
+	[0xCD] = INTERPRETER_INSTRUCTION_ID_SCROLL_DOWN,
+	[0xCE] = INTERPRETER_INSTRUCTION_ID_SCROLL_DOWN,
+	[0xCF] = INTERPRETER_INSTRUCTION_ID_SCROLL_DOWN,
+	#if INTERPRETER_IS_XO_CHIP_ENABLED == 1
+		[0xD0] = INTERPRETER_INSTRUCTION_ID_SCROLL_UP,
+		[0xD1] = INTERPRETER_INSTRUCTION_ID_SCROLL_UP,
+		[0xD2] = INTERPRETER_INSTRUCTION_ID_SCROLL_UP,
+		[0xD3] = INTERPRETER_INSTRUCTION_ID_SCROLL_UP,
+		[0xD4] = INTERPRETER_INSTRUCTION_ID_SCROLL_UP,
+		[0xD5] = INTERPRETER_INSTRUCTION_ID_SCROLL_UP,
+		[0xD6] = INTERPRETER_INSTRUCTION_ID_SCROLL_UP,
+		[0xD7] = INTERPRETER_INSTRUCTION_ID_SCROLL_UP,
+		[0xD8] = INTERPRETER_INSTRUCTION_ID_SCROLL_UP,
+		[0xD9] = INTERPRETER_INSTRUCTION_ID_SCROLL_UP,
+		[0xDA] = INTERPRETER_INSTRUCTION_ID_SCROLL_UP,
+		[0xDB] = INTERPRETER_INSTRUCTION_ID_SCROLL_UP,
+		[0xDC] = INTERPRETER_INSTRUCTION_ID_SCROLL_UP,
+		[0xDD] = INTERPRETER_INSTRUCTION_ID_SCROLL_UP,
+		[0xDE] = INTERPRETER_INSTRUCTION_ID_SCROLL_UP,
+		[0xDF] = INTERPRETER_INSTRUCTION_ID_SCROLL_UP,
+	#endif
+	[0xE0] = INTERPRETER_INSTRUCTION_ID_CLS,
+	[0xEE] = INTERPRETER_INSTRUCTION_ID_RET,
+	[0xFB] = INTERPRETER_INSTRUCTION_ID_SCROLL_RIGHT,
+	[0xFC] = INTERPRETER_INSTRUCTION_ID_SCROLL_LEFT,
+	[0xFD] = INTERPRETER_INSTRUCTION_ID_EXIT,
+	[0xFE] = INTERPRETER_INSTRUCTION_ID_LOW,
+	[0xFF] = INTERPRETER_INSTRUCTION_ID_HIGH
+};
+
+/** Convert the low nibble of a 0x8 class instruction to the instruction. */
+static const TInterpreterInstructionID Interpreter_Instruction_IDs_Group_8[16] =
+{
+	[0x0] = INTERPRETER_INSTRUCTION_ID_LD_VX_VY,
+	[0x1] = INTERPRETER_INSTRUCTION_ID_OR_VX_VY,
+	[0x2] = INTERPRETER_INSTRUCTION_ID_AND_VX_VY,
+	[0x3] = INTERPRETER_INSTRUCTION_ID_XOR_VX_VY,
+	[0x4] = INTERPRETER_INSTRUCTION_ID_ADD_VX_VY,
+	[0x5] = INTERPRETER_INSTRUCTION_ID_SUB_VX_VY,
+	[0x6] = INTERPRETER_INSTRUCTION_ID_SHR_VX_VY,
+	[0x7] = INTERPRETER_INSTRUCTION_ID_SUBN_VX_VY,
+	[0xE] = INTERPRETER_INSTRUCTION_ID_SHL_VX_VY
+};
+
+#if INTERPRETER_IS_XO_CHIP_ENABLED == 1
+	/** Convert the low nibble of a 0x5 class instruction to the instruction. */
+	static const TInterpreterInstructionID Interpreter_Instruction_IDs_Group_5[16] =
+	{
+		[0x0] = INTERPRETER_INSTRUCTION_ID_SE_VX_VY,
+		[0x1] = INTERPRETER_INSTRUCTION_ID_SE_VX_VY,
+		[0x2] = INTERPRETER_INSTRUCTION_ID_SAVE_VX_VY,
+		[0x3] = INTERPRETER_INSTRUCTION_ID_LOAD_VX_VY,
+		[0x4] = INTERPRETER_INSTRUCTION_ID_SE_VX_VY,
+		[0x5] = INTERPRETER_INSTRUCTION_ID_SE_VX_VY,
+		[0x6] = INTERPRETER_INSTRUCTION_ID_SE_VX_VY,
+		[0x7] = INTERPRETER_INSTRUCTION_ID_SE_VX_VY,
+		[0x8] = INTERPRETER_INSTRUCTION_ID_SE_VX_VY,
+		[0x9] = INTERPRETER_INSTRUCTION_ID_SE_VX_VY,
+		[0xA] = INTERPRETER_INSTRUCTION_ID_SE_VX_VY,
+		[0xB] = INTERPRETER_INSTRUCTION_ID_SE_VX_VY,
+		[0xC] = INTERPRETER_INSTRUCTION_ID_SE_VX_VY,
+		[0xD] = INTERPRETER_INSTRUCTION_ID_SE_VX_VY,
+		[0xE] = INTERPRETER_INSTRUCTION_ID_SE_VX_VY,
+		[0xF] = INTERPRETER_INSTRUCTION_ID_SE_VX_VY
+	};
+#endif
+
+/** Convert the low byte of a 0xE class instruction to the instruction. */
+static const TInterpreterInstructionID Interpreter_Instruction_IDs_Group_E[256] =
+{
+	[0x9E] = INTERPRETER_INSTRUCTION_ID_SKP_VX,
+	[0xA1] = INTERPRETER_INSTRUCTION_ID_SKNP_VX
+};
+
+/** Convert the low byte of a 0xF class instruction to the instruction. */
+static const TInterpreterInstructionID Interpreter_Instruction_IDs_Group_F[256] =
+{
+	#if INTERPRETER_IS_XO_CHIP_ENABLED == 1
+		[0x00] = INTERPRETER_INSTRUCTION_ID_LD_I_LONG_ADDRESS, // Only F000 is valid, this is checked when decoding
+		[0x01] = INTERPRETER_INSTRUCTION_ID_PLANE,
+	#endif
+	[0x07] = INTERPRETER_INSTRUCTION_ID_LD_VX_DT,
+	[0x0A] = INTERPRETER_INSTRUCTION_ID_LD_VX_K,
+	[0x15] = INTERPRETER_INSTRUCTION_ID_LD_DT_VX,
+	[0x18] = INTERPRETER_INSTRUCTION_ID_LD_ST_VX,
+	[0x1E] = INTERPRETER_INSTRUCTION_ID_ADD_I_VX,
+	[0x29] = INTERPRETER_INSTRUCTION_ID_LD_F_VX,
+	[0x30] = INTERPRETER_INSTRUCTION_ID_LD_HF_VX,
+	[0x33] = INTERPRETER_INSTRUCTION_ID_LD_B_VX,
+	[0x55] = INTERPRETER_INSTRUCTION_ID_LD_MEMORY_I_VX,
+	[0x65] = INTERPRETER_INSTRUCTION_ID_LD_VX_MEMORY_I,
+	[0x75] = INTERPRETER_INSTRUCTION_ID_LD_R_VX,
+	[0x85] = INTERPRETER_INSTRUCTION_ID_LD_VX_R
+};
+
+/** Find the instruction from the opcode high nibble, then from the opcode low byte for the classes containing several instructions. */
+static const TInterpreterInstructionClass Interpreter_Instruction_Classes[16] =
+{
+	{ Interpreter_Instruction_IDs_Group_0, 0xFF },
+	{ &Interpreter_Instruction_IDs_Classes[0x1], 0 },
+	{ &Interpreter_Instruction_IDs_Classes[0x2], 0 },
+	{ &Interpreter_Instruction_IDs_Classes[0x3], 0 },
+	{ &Interpreter_Instruction_IDs_Classes[0x4], 0 },
+	#if INTERPRETER_IS_XO_CHIP_ENABLED == 1
+		{ Interpreter_Instruction_IDs_Group_5, 0x0F },
+	#else
+		{ &Interpreter_Instruction_IDs_Classes[0x5], 0 },
+	#endif
+	{ &Interpreter_Instruction_IDs_Classes[0x6], 0 },
+	{ &Interpreter_Instruction_IDs_Classes[0x7], 0 },
+	{ Interpreter_Instruction_IDs_Group_8, 0x0F },
+	{ &Interpreter_Instruction_IDs_Classes[0x9], 0 },
+	{ &Interpreter_Instruction_IDs_Classes[0xA], 0 },
+	{ &Interpreter_Instruction_IDs_Classes[0xB], 0 },
+	{ &Interpreter_Instruction_IDs_Classes[0xC], 0 },
+	{ &Interpreter_Instruction_IDs_Classes[0xD], 0 },
+	{ Interpreter_Instruction_IDs_Group_E, 0xFF },
+	{ Interpreter_Instruction_IDs_Group_F, 0xFF }
+};
+
+/** The bits to remove from the 12-bit nnn operand to get the operand an instruction needs : the kk byte for the instructions using an immediate value, the n nibble for the instructions using one, all other instructions keep the nnn operand (they use its address or ignore it). */
+static const unsigned short Interpreter_Instruction_Operand_Removed_Bits[INTERPRETER_INSTRUCTION_IDS_COUNT] =
+{
+	[INTERPRETER_INSTRUCTION_ID_SE_VX_BYTE] = 0x0F00,
+	[INTERPRETER_INSTRUCTION_ID_SNE_VX_BYTE] = 0x0F00,
+	[INTERPRETER_INSTRUCTION_ID_LD_VX_BYTE] = 0x0F00,
+	[INTERPRETER_INSTRUCTION_ID_ADD_VX_BYTE] = 0x0F00,
+	[INTERPRETER_INSTRUCTION_ID_RND_VX_BYTE] = 0x0F00,
+	[INTERPRETER_INSTRUCTION_ID_SCROLL_DOWN] = 0x0FF0,
+	[INTERPRETER_INSTRUCTION_ID_SCROLL_UP] = 0x0FF0,
+	[INTERPRETER_INSTRUCTION_ID_DRW_VX_VY_NIBBLE] = 0x0FF0
+};
 
 //-------------------------------------------------------------------------------------------------
 // Private functions
 //-------------------------------------------------------------------------------------------------
+/** Tell that the whole frame buffer changed, so it is entirely sent by the next transfer. This is needed when most of the pixels move, and when the display did not show the frame buffer content. */
+static void InterpreterMarkFrameBufferChanged(void)
+{
+	unsigned char i;
+
+	for (i = 0; i < Interpreter_Display_Rows_Count / 8; i++)
+	{
+		Interpreter_Dirty_Pages[i].First_Column = 0;
+		Interpreter_Dirty_Pages[i].Last_Column = Interpreter_Display_Columns_Count - 1;
+	}
+}
+
+/** Add some columns to the changed part of a frame buffer page.
+ * @param Page The page index.
+ * @param First_Column The leftmost changed column.
+ * @param Last_Column The rightmost changed column.
+ */
+static void InterpreterMarkPageChanged(unsigned char Page, unsigned char First_Column, unsigned char Last_Column)
+{
+	if (First_Column < Interpreter_Dirty_Pages[Page].First_Column) Interpreter_Dirty_Pages[Page].First_Column = First_Column;
+	if (Last_Column > Interpreter_Dirty_Pages[Page].Last_Column) Interpreter_Dirty_Pages[Page].Last_Column = Last_Column;
+}
+
+/** Transfer the changed parts of the frame buffer to the display with the current resolution. */
+static void InterpreterDrawFrameBuffer(void)
+{
+	unsigned char i;
+
+	#if INTERPRETER_IS_COST_MEASUREMENT_ENABLED == 1
+		unsigned short Start_Time, Duration;
+		unsigned char Entry_Index;
+
+		Start_Time = InterpreterPlatformReadTimeCounter();
+	#endif
+
+	InterpreterPlatformDrawFrameBuffer(Interpreter_Is_High_Resolution_Enabled, Interpreter_Is_Second_Plane_Enabled, Interpreter_Dirty_Pages, Interpreter_Display_Row_Offset);
+
+	// The display now shows the whole frame buffer, mark all pages as unchanged (the first column is greater than the last one)
+	for (i = 0; i < DISPLAY_ROWS_COUNT / 8; i++)
+	{
+		Interpreter_Dirty_Pages[i].First_Column = 0xFF;
+		Interpreter_Dirty_Pages[i].Last_Column = 0;
+	}
+
+	#if INTERPRETER_IS_COST_MEASUREMENT_ENABLED == 1
+		Duration = InterpreterPlatformReadTimeCounter() - Start_Time;
+		Entry_Index = INTERPRETER_INSTRUCTION_IDS_COUNT + Interpreter_Is_High_Resolution_Enabled;
+		Interpreter_Cost_Measurement_Counts[Entry_Index]++;
+		Interpreter_Cost_Measurement_Durations[Entry_Index] += Duration;
+		Interpreter_Cost_Measurement_Nested_Duration += Duration;
+	#endif
+}
+
 /** Retrieve the keys configuration from the game INI configuration.
  * @param Pointer_String_Game_INI_Section The INI section corresponding to the game.
  * @return 0 on success,
@@ -216,8 +1015,7 @@ static unsigned char InterpreterConfigureKeyBindings(char *Pointer_String_Game_I
 			{
 				LOG(INTERPRETER_IS_LOGGING_ENABLED, "Invalid Chip-8 key code, it must be in range 0 to 15 (read value is %u).", Key_Index);
 				snprintf(Shared_Buffers.String_Temporary, sizeof(Shared_Buffers.String_Temporary), LocalizedStringGet(LOCALIZED_STRING_ID_INTERPRETER_MESSAGE_INVALID_KEY_CODE_CONTENT), Pointer_Key_Binding->Pointer_String_INI_Key_Name);
-				DisplayDrawTextMessage(Shared_Buffer_Display, LocalizedStringGet(LOCALIZED_STRING_ID_INTERPRETER_MESSAGE_ERROR_TITLE), Shared_Buffers.String_Temporary);
-				while (!KeyboardIsMenuKeyPressed());
+				InterpreterPlatformDisplayErrorMessage(Shared_Buffers.String_Temporary);
 				return 1;
 			}
 			LOG(INTERPRETER_IS_LOGGING_ENABLED, "Chip-8 key binding value is %u.", Key_Index);
@@ -244,1210 +1042,2374 @@ static unsigned char InterpreterConfigureKeyBindings(char *Pointer_String_Game_I
 	return 0;
 }
 
-//-------------------------------------------------------------------------------------------------
-// Public functions
-//-------------------------------------------------------------------------------------------------
-void InterpreterInitialize(void)
+/** Fetch the instruction located at the specified address and extract its operands.
+ * @param Address The instruction address, it must be in range 0 to INTERPRETER_MEMORY_SIZE - 1.
+ * @param Pointer_Instruction On output, contain the decoded instruction. Unsupported encodings are decoded as INTERPRETER_INSTRUCTION_ID_INVALID.
+ */
+static void InterpreterDecodeInstruction(unsigned short Address, TInterpreterDecodedInstruction *Pointer_Instruction)
 {
-	// Enable the peripheral module
-	PMD1bits.TMR6MD = 0;
+	unsigned char Instruction_High_Byte, Instruction_Low_Byte;
+	#if INTERPRETER_IS_INSTRUCTION_FUSION_ENABLED == 1
+		unsigned char Instruction_Class;
+	#endif
+	const TInterpreterInstructionClass *Pointer_Class;
+	TInterpreterInstructionID ID;
+
+	// Fetch the instruction (the address following the last memory byte wraps to the memory beginning, like the program counter does)
+	Instruction_High_Byte = Shared_Buffers.Interpreter_Memory[Address];
+	Instruction_Low_Byte = Shared_Buffers.Interpreter_Memory[(Address + 1) & 0x0FFF];
+
+	// Find the instruction to execute, a table tells for each class which low byte bits select the instruction
+	Pointer_Class = &Interpreter_Instruction_Classes[Instruction_High_Byte >> 4];
+	ID = Pointer_Class->Pointer_Instruction_IDs[Instruction_Low_Byte & Pointer_Class->Low_Byte_Mask];
+
+	// Extract all operands, each instruction will use only the ones it needs (the kk byte or the n nibble are kept from the nnn operand)
+	Pointer_Instruction->Address = Address;
+	Pointer_Instruction->ID = ID;
+	Pointer_Instruction->Register_Index_X = Instruction_High_Byte & 0x0F;
+	Pointer_Instruction->Register_Index_Y = Instruction_Low_Byte >> 4;
+	Pointer_Instruction->Operand = (((unsigned short) (Instruction_High_Byte & 0x0F) << 8) | Instruction_Low_Byte) & ~Interpreter_Instruction_Operand_Removed_Bits[ID];
+
+	#if INTERPRETER_IS_XO_CHIP_ENABLED == 1
+		// The LD I, long address instruction is followed by the 16-bit address, the interpreter memory being 4KB only the address low 12 bits are used
+		if (ID == INTERPRETER_INSTRUCTION_ID_LD_I_LONG_ADDRESS)
+		{
+			if (Pointer_Instruction->Register_Index_X != 0) Pointer_Instruction->ID = INTERPRETER_INSTRUCTION_ID_INVALID;
+			else Pointer_Instruction->Operand = (((unsigned short) Shared_Buffers.Interpreter_Memory[(Address + 2) & 0x0FFF] << 8) | Shared_Buffers.Interpreter_Memory[(Address + 3) & 0x0FFF]) & 0x0FFF;
+		}
+	#endif
 
-	// Use timer 6 as the Chip-8 delay timer
-	T6CLK = 0x09; // Clock the timer by the NCO module
-	T6HLT = 0xA8; // Prescaler output is synchronized with Fosc/4, also synchronize the ON bit with the timer clock input, select the one-shot mode with one-shot operation and software start
-	T6CON = 0; // Do not enable the timer yet, do not enable any prescaler or postscaler (the timer is already clocked at the desired frequency)
+	#if INTERPRETER_IS_INSTRUCTION_FUSION_ENABLED == 1
+		// Merge the instruction with the following one if they form a frequent pair (a jump to the second instruction still finds it decoded on its own in its own cache entry)
+		if ((ID == INTERPRETER_INSTRUCTION_ID_SE_VX_BYTE) || (ID == INTERPRETER_INSTRUCTION_ID_SNE_VX_BYTE) || (ID == INTERPRETER_INSTRUCTION_ID_LD_VX_BYTE) || (ID == INTERPRETER_INSTRUCTION_ID_LD_I_ADDRESS))
+		{
+			// Fetch the next instruction
+			Address = (Address + 2) & 0x0FFF;
+			Instruction_High_Byte = Shared_Buffers.Interpreter_Memory[Address];
+			Instruction_Low_Byte = Shared_Buffers.Interpreter_Memory[(Address + 1) & 0x0FFF];
+			Instruction_Class = Instruction_High_Byte >> 4;
+
+			// SE Vx, byte or SNE Vx, byte followed by JP address
+			if (Instruction_Class == 0x1)
+			{
+				if (ID == INTERPRETER_INSTRUCTION_ID_SE_VX_BYTE) Pointer_Instruction->ID = INTERPRETER_INSTRUCTION_ID_SE_VX_BYTE_JP_ADDRESS;
+				else if (ID == INTERPRETER_INSTRUCTION_ID_SNE_VX_BYTE) Pointer_Instruction->ID = INTERPRETER_INSTRUCTION_ID_SNE_VX_BYTE_JP_ADDRESS;
+				else return;
+				Pointer_Instruction->Register_Index_Y = (unsigned char) Pointer_Instruction->Operand;
+				Pointer_Instruction->Operand = ((unsigned short) (Instruction_High_Byte & 0x0F) << 8) | Instruction_Low_Byte;
+			}
+			// LD Vx, byte followed by LD Vy, byte
+			else if ((Instruction_Class == 0x6) && (ID == INTERPRETER_INSTRUCTION_ID_LD_VX_BYTE))
+			{
+				Pointer_Instruction->ID = INTERPRETER_INSTRUCTION_ID_LD_VX_BYTE_LD_VY_BYTE;
+				Pointer_Instruction->Register_Index_Y = Instruction_High_Byte & 0x0F;
+				Pointer_Instruction->Operand |= (unsigned short) Instruction_Low_Byte << 8;
+			}
+			// LD I, address followed by DRW Vx, Vy, nibble
+			else if ((Instruction_Class == 0xD) && (ID == INTERPRETER_INSTRUCTION_ID_LD_I_ADDRESS))
+			{
+				Pointer_Instruction->ID = INTERPRETER_INSTRUCTION_ID_LD_I_ADDRESS_DRW_VX_VY_NIBBLE;
+				Pointer_Instruction->Register_Index_X = Instruction_High_Byte & 0x0F;
+				Pointer_Instruction->Register_Index_Y = Instruction_Low_Byte >> 4;
+				Pointer_Instruction->Operand |= (unsigned short) Instruction_Low_Byte << 12;
+			}
+			// LD I, address followed by ADD I, Vx
+			else if ((Instruction_Class == 0xF) && (Instruction_Low_Byte == 0x1E) && (ID == INTERPRETER_INSTRUCTION_ID_LD_I_ADDRESS))
+			{
+				Pointer_Instruction->ID = INTERPRETER_INSTRUCTION_ID_LD_I_ADDRESS_ADD_I_VX;
+				Pointer_Instruction->Register_Index_X = Instruction_High_Byte & 0x0F;
+			}
+		}
+	#endif
 }
 
-unsigned char InterpreterLoadProgramFromFile(char *Pointer_String_Game_INI_Section)
-{
-	unsigned char Result;
-	char *Pointer_String;
-	TFATFileInformation File_Information;
-	TFATFileDescriptor File_Descriptor;
+#if INTERPRETER_IS_RECOMPILER_ENABLED == 1
+	// The translated blocks table is provided by the translated program, which is included after all handlers
+	static void InterpreterRecompilerInvalidate(unsigned short Address);
+#endif
 
-	// Assign the console keys to the Chip-8 values expected by the game (do that before loading the ROM file because the INI data is stored in the same buffer that the one in which the ROM file will be loaded)
-	if (InterpreterConfigureKeyBindings(Pointer_String_Game_INI_Section) != 0)
+#if INTERPRETER_IS_DECODE_CACHE_ENABLED == 1
+	/** Discard all decoded instructions. */
+	static void InterpreterDecodeCacheClear(void)
 	{
-		LOG(INTERPRETER_IS_LOGGING_ENABLED, "Error : failed to configure the key bindings.");
-		return 1;
-	}
+		unsigned char i;
 
-	// Retrieve the game ROM file name
-	Pointer_String = INIParserReadString(Pointer_String_Game_INI_Section, "ROMFile");
-	if (Pointer_String == NULL)
-	{
-		LOG(INTERPRETER_IS_LOGGING_ENABLED, "Error : failed to retrieve the game ROM file from the INI configuration.");
-		return 1;
+		for (i = 0; i < INTERPRETER_DECODE_CACHE_ENTRIES_COUNT; i++) Interpreter_Decode_Cache[i].Address = INTERPRETER_DECODE_CACHE_INVALID_ADDRESS;
 	}
-	LOG(INTERPRETER_IS_LOGGING_ENABLED, "ROM file name : \"%s\".", Pointer_String);
 
-	// If the corresponding key is not found, the variable is set to 0, in order to disable the feature by default
-	// Fast rendering
-	if (INIParserRead8BitInteger(Pointer_String_Game_INI_Section, "FastRendering", &Result) == 0) Interpreter_Is_Fast_Rendering_Enabled = Result;
-	else Interpreter_Is_Fast_Rendering_Enabled = 0;
-	// Display wrapping
-	if (INIParserRead8BitInteger(Pointer_String_Game_INI_Section, "DisplayWrapping", &Result) == 0) Interpreter_Is_Display_Wrapping_Enabled = Result;
-	else Interpreter_Is_Display_Wrapping_Enabled = 0;
-	// Memory
-	if (INIParserRead8BitInteger(Pointer_String_Game_INI_Section, "MemoryLoadStoreIncrement", &Result) == 0) Interpreter_Is_Memory_Load_Store_Increment_Enabled = Result;
-	else Interpreter_Is_Memory_Load_Store_Increment_Enabled = 0;
-	// Shift
-	if (INIParserRead8BitInteger(Pointer_String_Game_INI_Section, "ShiftUsingVy", &Result) == 0) Interpreter_Is_Shift_Using_Vy_Enabled = Result;
-	else Interpreter_Is_Shift_Using_Vy_Enabled = 0;
-	// VF reset
-	if (INIParserRead8BitInteger(Pointer_String_Game_INI_Section, "ResetVF", &Result) == 0) Interpreter_Is_VF_Reset_Enabled = Result;
-	else Interpreter_Is_VF_Reset_Enabled = 0;
-	// Rendering delay (in milliseconds)
-	if (INIParserRead8BitInteger(Pointer_String_Game_INI_Section, "RenderingDelay", &Result) == 0)
+	/** Discard the decoded instructions that contain the specified memory byte, this must be called each time the program writes to its memory.
+	 * @param Address The address of the modified byte.
+	 */
+	static void InterpreterDecodeCacheInvalidate(unsigned short Address)
 	{
-		Interpreter_Rendering_Delay = Result;
+		// The byte can be the first or the second byte of an instruction, instructions can also be located at odd addresses, so both cache entries must be discarded
+		INTERPRETER_DECODE_CACHE_GET_ENTRY(Address)->Address = INTERPRETER_DECODE_CACHE_INVALID_ADDRESS;
+		INTERPRETER_DECODE_CACHE_GET_ENTRY((Address - 1) & 0x0FFF)->Address = INTERPRETER_DECODE_CACHE_INVALID_ADDRESS;
+
+		// A fused instruction and the LD I, long address instruction also contain the bytes of the following instruction
+		#if (INTERPRETER_IS_INSTRUCTION_FUSION_ENABLED == 1) || (INTERPRETER_IS_XO_CHIP_ENABLED == 1)
+			INTERPRETER_DECODE_CACHE_GET_ENTRY((Address - 2) & 0x0FFF)->Address = INTERPRETER_DECODE_CACHE_INVALID_ADDRESS;
+			INTERPRETER_DECODE_CACHE_GET_ENTRY((Address - 3) & 0x0FFF)->Address = INTERPRETER_DECODE_CACHE_INVALID_ADDRESS;
+		#endif
 
-		// The delay is done in the fast rendering code, so enable this feature
-		Interpreter_Is_Fast_Rendering_Enabled = 1;
+		// The translated code does not match the program anymore if the program is modifying it
+		#if INTERPRETER_IS_RECOMPILER_ENABLED == 1
+			InterpreterRecompilerInvalidate(Address);
+		#endif
 	}
-	else Interpreter_Rendering_Delay = 0;
+#endif
 
-	// Begin listing the files
-	if (FATListStart("/") != 0)
+#if INTERPRETER_IS_TRACE_BUFFER_ENABLED == 1
+	/** Send the content of the trace buffer to the serial port, from the oldest instruction to the most recent one. */
+	static void InterpreterTraceBufferSend(void)
 	{
-		LOG(INTERPRETER_IS_LOGGING_ENABLED, "FATListStart() failed.");
-		return 1;
+		unsigned char i, Index;
+		char String_Entry[24];
+
+		SerialPortWriteString("Last executed instructions (oldest first) :\r\n");
+		Index = Interpreter_Trace_Buffer_Index;
+		for (i = 0; i < INTERPRETER_TRACE_BUFFER_ENTRIES_COUNT; i++)
+		{
+			// Bypass the entries that were not used if the program stopped early
+			if (Interpreter_Trace_Buffer[Index].Address != INTERPRETER_TRACE_BUFFER_INVALID_ADDRESS)
+			{
+				snprintf(String_Entry, sizeof(String_Entry), "0x%03X : 0x%02X%02X\r\n", Interpreter_Trace_Buffer[Index].Address, Interpreter_Trace_Buffer[Index].Opcode_High_Byte, Interpreter_Trace_Buffer[Index].Opcode_Low_Byte);
+				SerialPortWriteString(String_Entry);
+			}
+			Index = (Index + 1) & (INTERPRETER_TRACE_BUFFER_ENTRIES_COUNT - 1);
+		}
 	}
+#endif
 
-	// Search for the game ROM file
-	while (1)
+#if INTERPRETER_IS_PROFILER_ENABLED == 1
+	/** Send the instruction counters to the serial port. The dump is made of the magic number, the amount of counters (1 byte), then all counters in the instruction ID order (2 bytes each, little endian). */
+	static void InterpreterProfilerSendCounters(void)
 	{
-		Result = FATListNext(&File_Information);
-		if (Result != 0) break;
-		LOG(INTERPRETER_IS_LOGGING_ENABLED, "File found : name=\"%s\", is directory=%u, size=%lu, first cluster=%lu.",
-			File_Information.String_Short_Name,
-			File_Information.Is_Directory,
-			File_Information.Size,
-			File_Information.First_Cluster_Number);
+		const char *Pointer_String_Magic_Number = INTERPRETER_PROFILER_DUMP_MAGIC_NUMBER;
+		unsigned char i;
+		unsigned short Counter;
 
-		// Do not take directories into account
-		if (File_Information.Is_Directory)
+		// Send the header
+		while (*Pointer_String_Magic_Number != 0)
 		{
-			LOG(INTERPRETER_IS_LOGGING_ENABLED, "This is a directory, skipping it.");
-			continue;
+			SerialPortWriteByte(*Pointer_String_Magic_Number);
+			Pointer_String_Magic_Number++;
 		}
+		SerialPortWriteByte(INTERPRETER_INSTRUCTION_IDS_COUNT);
 
-		// Is this the searched file ?
-		if (strcmp((char *) File_Information.String_Short_Name, Pointer_String) == 0)
+		// Send the counters
+		for (i = 0; i < INTERPRETER_INSTRUCTION_IDS_COUNT; i++)
 		{
-			LOG(INTERPRETER_IS_LOGGING_ENABLED, "Found the game file, loading it.");
-			break;
+			Counter = Interpreter_Profiler_Instruction_Counters[i];
+			SerialPortWriteByte((unsigned char) Counter);
+			SerialPortWriteByte(Counter >> 8);
 		}
 	}
-	// Was the file found ?
-	if (Result != 0)
+#endif
+
+#if INTERPRETER_IS_COST_MEASUREMENT_ENABLED == 1
+	/** Send the cost measurements to the serial port. The dump is made of the magic number, the amount of entries (1 byte), then all entries in the instruction ID order followed by the half-size and the full-size frame buffer transfers. Each entry contains the execution count then the total duration in microseconds (4 bytes each, little endian). */
+	static void InterpreterCostMeasurementSendDurations(void)
 	{
-		LOG(INTERPRETER_IS_LOGGING_ENABLED, "Error : could not find the game file, stopping.");
-		return 1;
+		const char *Pointer_String_Magic_Number = INTERPRETER_COST_MEASUREMENT_DUMP_MAGIC_NUMBER;
+		unsigned char i, j;
+		unsigned long Count, Duration;
+
+		// Send the header
+		while (*Pointer_String_Magic_Number != 0)
+		{
+			SerialPortWriteByte(*Pointer_String_Magic_Number);
+			Pointer_String_Magic_Number++;
+		}
+		SerialPortWriteByte(INTERPRETER_COST_MEASUREMENT_ENTRIES_COUNT);
+
+		// Send the entries
+		for (i = 0; i < INTERPRETER_COST_MEASUREMENT_ENTRIES_COUNT; i++)
+		{
+			Count = Interpreter_Cost_Measurement_Counts[i];
+			Duration = Interpreter_Cost_Measurement_Durations[i];
+			for (j = 0; j < 4; j++)
+			{
+				SerialPortWriteByte((unsigned char) Count);
+				Count >>= 8;
+			}
+			for (j = 0; j < 4; j++)
+			{
+				SerialPortWriteByte((unsigned char) Duration);
+				Duration >>= 8;
+			}
+		}
 	}
+#endif
 
-	// Load the file
-	FATReadSectorsStart(&File_Information, &File_Descriptor);
-	if (FATReadSectorsNext(&File_Descriptor, (INTERPRETER_MEMORY_SIZE - INTERPRETER_PROGRAM_ENTRY_POINT) / SD_CARD_BLOCK_SIZE, &Shared_Buffers.Interpreter_Memory[INTERPRETER_PROGRAM_ENTRY_POINT]) > 1) // The resulting sectors count value is correct because the INTERPRETER_MEMORY_SIZE and INTERPRETER_PROGRAM_ENTRY_POINT values are aligned on a sector size
+#if INTERPRETER_IS_PC_SAMPLING_ENABLED == 1
+	/** Send the program counter histogram to the serial port. The dump is made of the magic number, the address of the first histogram entry (2 bytes, little endian), the amount of bytes per entry (1 byte), the amount of entries (1 byte), then all entries (2 bytes each, little endian). */
+	static void InterpreterPCSamplingSendHistogram(void)
 	{
-		LOG(INTERPRETER_IS_LOGGING_ENABLED, "Error : failed to load the program from the file named \"%s\".", File_Information.String_Short_Name);
-		return 1;
-	}
+		const char *Pointer_String_Magic_Number = INTERPRETER_PC_SAMPLING_DUMP_MAGIC_NUMBER;
+		unsigned char i;
+		unsigned short Counter;
 
-	// Place the built-in fonts at the beginning of the interpreter memory
-	memcpy(Shared_Buffers.Interpreter_Memory, Interpreter_Fonts, sizeof(Interpreter_Fonts));
+		// Send the header
+		while (*Pointer_String_Magic_Number != 0)
+		{
+			SerialPortWriteByte(*Pointer_String_Magic_Number);
+			Pointer_String_Magic_Number++;
+		}
+		SerialPortWriteByte((unsigned char) INTERPRETER_PROGRAM_ENTRY_POINT);
+		SerialPortWriteByte(INTERPRETER_PROGRAM_ENTRY_POINT >> 8);
+		SerialPortWriteByte(INTERPRETER_PC_SAMPLING_BUCKET_SIZE);
+		SerialPortWriteByte(INTERPRETER_PC_SAMPLING_BUCKETS_COUNT);
 
-	// Configure the registers for the program execution
-	Interpreter_Register_PC = INTERPRETER_PROGRAM_ENTRY_POINT; // The default entry point
-	Interpreter_Register_SP = 0; // Clear the stack
-	// Reset all other registers
-	Interpreter_Register_I = 0;
-	memset(Interpreter_Registers_V, 0, sizeof(Interpreter_Registers_V));
+		// Send the histogram
+		for (i = 0; i < INTERPRETER_PC_SAMPLING_BUCKETS_COUNT; i++)
+		{
+			Counter = Interpreter_PC_Sampling_Histogram[i];
+			SerialPortWriteByte((unsigned char) Counter);
+			SerialPortWriteByte(Counter >> 8);
+		}
+	}
+#endif
 
-	// Clear the frame buffer
-	memset(Shared_Buffer_Display, 0, sizeof(Shared_Buffer_Display));
+#if INTERPRETER_IS_BENCHMARK_ENABLED == 1
+	/** Send the benchmark measurements to the serial port as a single line of space-separated Key=Value fields, prefixed by "Benchmark :" so the host script can find it among the log messages. The times are in microseconds. */
+	static void InterpreterBenchmarkSendReport(void)
+	{
+		char String_Report[160];
+
+		snprintf(String_Report, sizeof(String_Report), "Benchmark : ROM=%s Instructions=%lu Duration=%lu DRW_Instructions=%lu DRW_Duration=%lu\r\n",
+			Interpreter_Benchmark_String_ROM_File_Name,
+			Interpreter_Benchmark_Instructions_Count,
+			Interpreter_Benchmark_Duration,
+			Interpreter_Benchmark_DRW_Instructions_Count,
+			Interpreter_Benchmark_DRW_Duration);
+		SerialPortWriteString(String_Report);
+	}
+#endif
 
-	// Purge any spurious press of the menu key
-	KeyboardIsMenuKeyPressed();
+/** Put the CPU in Idle mode until the next tick. The peripherals keep running, so the sound, the delay timer and the menu key are still working. */
+static void InterpreterWaitForTick(void)
+{
+	#if INTERPRETER_IS_IDLE_STATISTICS_ENABLED == 1
+		unsigned short Duration;
+
+		// The benchmark time counter uses the log timer, which can't be restarted without disturbing the benchmark (a tick lasts less than the counter period)
+		#if INTERPRETER_IS_BENCHMARK_ENABLED == 1
+			Duration = InterpreterPlatformReadTimeCounter();
+		#else
+			LogTimingStart();
+		#endif
+	#endif
 
-	// Use the timer feeding the sound PWM generation (which is always running) to initialize the random seed for the entire Chip-8 program execution
-	Interpreter_Random_Seed = T2TMR;
+	InterpreterPlatformWaitForTick();
 
-	return 0;
+	#if INTERPRETER_IS_IDLE_STATISTICS_ENABLED == 1
+		#if INTERPRETER_IS_BENCHMARK_ENABLED == 1
+			Duration = (unsigned short) (InterpreterPlatformReadTimeCounter() - Duration);
+		#else
+			Duration = LogTimingStop();
+		#endif
+		if (Duration != 0xFFFF)
+		{
+			Interpreter_Idle_Mode_Entries_Count++;
+			Interpreter_Idle_Mode_Duration += Duration;
+		}
+	#endif
 }
 
-unsigned char InterpreterRunProgram(void)
+/** Read the key switches, the turbo chord key is removed while the menu key is held because it is then part of the turbo chord (so the program does not move the player while the user speeds the game up).
+ * @return A bit mask of the pressed keys, built with the TKeyboardKey values.
+ */
+static inline unsigned char InterpreterReadKeyboardKeysMask(void)
 {
-	unsigned char Display_Rows_Count, Display_Columns_Count, Instruction_High_Byte, Instruction_Low_Byte, Is_Rendering_Needed = 0, Is_High_Resolution_Enabled = 0;
-	#if INTERPRETER_IS_DEBUGGER_ENABLED == 1
-		unsigned char Is_Stepping_Enabled = 1;
-		unsigned short Breakpoint_Address = 0; // Set to 0 to disable the breakpoint feature, otherwise set to the address to break on
-	#endif
+	unsigned char Keys_Mask;
 
-	// Configure the Chip-8 display settings by default, they may be updated later by the resolution changing instructions
-	Display_Columns_Count = INTERPRETER_DISPLAY_COLUMNS_COUNT_CHIP_8;
-	Display_Rows_Count = INTERPRETER_DISPLAY_ROWS_COUNT_CHIP_8;
+	Keys_Mask = InterpreterPlatformReadKeysMask();
+	if (InterpreterPlatformIsMenuKeyHeld()) Keys_Mask &= (unsigned char) ~INTERPRETER_TURBO_CHORD_KEY;
+	return Keys_Mask;
+}
 
-	while (1)
+#if INTERPRETER_IS_INPUT_STREAM_ENABLED == 1
+	/** Read the next event of the replayed input stream, the program is stopped when the stream end marker is found. The stream is made of the magic number, the random seed, then of the events. Each event is made of two bytes : how many frames to wait before applying the event (INTERPRETER_INPUT_STREAM_END_MARKER ends the stream), and the new keys mask. */
+	static void InterpreterInputStreamReadEvent(void)
 	{
-		// Exit when the menu key is pressed
-		if (KeyboardIsMenuKeyPressed()) goto Exit_Success;
+		Interpreter_Input_Stream_Frames_Count = InterpreterPlatformReadInputStreamByte();
+		Interpreter_Input_Stream_Next_Keys_Mask = InterpreterPlatformReadInputStreamByte();
+		if (Interpreter_Input_Stream_Frames_Count == INTERPRETER_INPUT_STREAM_END_MARKER)
+		{
+			LOG(INTERPRETER_IS_LOGGING_ENABLED, "The input stream end has been reached.");
+			Interpreter_Execution_State = INTERPRETER_EXECUTION_STATE_EXIT;
+		}
+	}
+
+	/** Start recording or replaying the keys if the game configuration asks for it. When replaying, the recorded random seed replaces the one chosen when the program was loaded.
+	 * @return 0 on success,
+	 * @return 1 if an error occurred.
+	 */
+	static unsigned char InterpreterInputStreamStart(void)
+	{
+		unsigned char i;
 
-		// Make sure only the instruction address can't go out the array bounds
-		Interpreter_Register_PC &= 0x0FFF;
+		Interpreter_Input_Stream_Keys_Mask = 0;
+		Interpreter_Input_Stream_Frames_Count = 0;
+		if (Interpreter_Input_Stream_Mode == INTERPRETER_INPUT_STREAM_MODE_DISABLED) return 0;
 
-		// Fetch the next instruction
-		Instruction_High_Byte = Shared_Buffers.Interpreter_Memory[Interpreter_Register_PC];
-		Instruction_Low_Byte = Shared_Buffers.Interpreter_Memory[Interpreter_Register_PC + 1];
-		LOG(INTERPRETER_IS_LOGGING_ENABLED, "**** Fetching instruction at address 0x%03X : 0x%02X 0x%02X.", Interpreter_Register_PC, Instruction_High_Byte, Instruction_Low_Byte);
+		if (InterpreterPlatformOpenInputStream(Interpreter_Input_Stream_Mode == INTERPRETER_INPUT_STREAM_MODE_REPLAY) != 0)
+		{
+			LOG(INTERPRETER_IS_LOGGING_ENABLED, "Error : failed to open the input stream.");
+			return 1;
+		}
 
-		#if INTERPRETER_IS_DEBUGGER_ENABLED == 1
-			if (Breakpoint_Address != 0)
+		if (Interpreter_Input_Stream_Mode == INTERPRETER_INPUT_STREAM_MODE_RECORD)
+		{
+			for (i = 0; i < sizeof(INTERPRETER_INPUT_STREAM_MAGIC_NUMBER) - 1; i++) InterpreterPlatformWriteInputStreamByte(INTERPRETER_INPUT_STREAM_MAGIC_NUMBER[i]);
+			InterpreterPlatformWriteInputStreamByte(Interpreter_Random_Seed);
+		}
+		else
+		{
+			for (i = 0; i < sizeof(INTERPRETER_INPUT_STREAM_MAGIC_NUMBER) - 1; i++)
 			{
-				if (Breakpoint_Address == Interpreter_Register_PC)
+				if (InterpreterPlatformReadInputStreamByte() != INTERPRETER_INPUT_STREAM_MAGIC_NUMBER[i])
 				{
-					SerialPortWriteString("Reached breakpoint.\r\n");
-					Is_Stepping_Enabled = 1;
+					LOG(INTERPRETER_IS_LOGGING_ENABLED, "Error : the replayed data is not an input stream.");
+					InterpreterPlatformCloseInputStream();
+					return 1;
 				}
 			}
+			Interpreter_Random_Seed = InterpreterPlatformReadInputStreamByte();
+			InterpreterInputStreamReadEvent();
+		}
+		LOG(INTERPRETER_IS_LOGGING_ENABLED, "Input stream %s started with random seed 0x%02X.", Interpreter_Input_Stream_Mode == INTERPRETER_INPUT_STREAM_MODE_RECORD ? "recording" : "replay", Interpreter_Random_Seed);
 
-			if (Is_Stepping_Enabled)
-			{
-				unsigned char i, Character;
+		return 0;
+	}
 
-				// Display all registers
-				SerialPortWriteString("Registers :\r\n");
-				printf("PC=0x%04X, I=0x%04X, SP=0x%02X\r\n", Interpreter_Register_PC, Interpreter_Register_I, Interpreter_Register_SP);
-				for (i = 0; i < INTERPRETER_REGISTERS_V_COUNT; i++) printf("V%01X=0x%02X, ", i, Interpreter_Registers_V[i]);
-				SerialPortWriteString("\r\n");
+	/** Sample the keys the program sees during the next frame, from the keyboard or from the replayed stream. This must be called at the same places whatever the mode is, so the recorded and the replayed frames match. */
+	static void InterpreterInputStreamProcessFrame(void)
+	{
+		unsigned char Keys_Mask;
 
-				// Wait for user input
-				SerialPortWriteString("Press 'c' to continue execution or 's' to step.\r\n");
-				while (1)
-				{
-					Character = SerialPortReadByte();
-					if (Character == 'c')
-					{
-						Is_Stepping_Enabled = 0;
-						SerialPortWriteString("Continuing execution...\r\n");
-						break;
-					}
-					if (Character == 's') break;
-				}
+		if (Interpreter_Input_Stream_Mode == INTERPRETER_INPUT_STREAM_MODE_RECORD)
+		{
+			// Write an event only when the keys change, or when the frames count can't grow anymore
+			Keys_Mask = InterpreterReadKeyboardKeysMask();
+			if ((Keys_Mask != Interpreter_Input_Stream_Keys_Mask) || (Interpreter_Input_Stream_Frames_Count == INTERPRETER_INPUT_STREAM_END_MARKER - 1))
+			{
+				InterpreterPlatformWriteInputStreamByte(Interpreter_Input_Stream_Frames_Count);
+				InterpreterPlatformWriteInputStreamByte(Keys_Mask);
+				Interpreter_Input_Stream_Keys_Mask = Keys_Mask;
+				Interpreter_Input_Stream_Frames_Count = 0;
 			}
-		#endif
-
-		// Decode and execute the instruction
-		switch (Instruction_High_Byte & 0xF0)
+			else Interpreter_Input_Stream_Frames_Count++;
+		}
+		else if (Interpreter_Input_Stream_Mode == INTERPRETER_INPUT_STREAM_MODE_REPLAY)
 		{
-			case 0x00:
+			if (Interpreter_Input_Stream_Frames_Count == 0)
 			{
-				// SCROLL DOWN
-				if ((Instruction_Low_Byte & 0xF0) == 0xC0)
-				{
-					unsigned char Pixels_Amount, Rows_Count, Columns_Count_Byte, *Pointer_Source_Byte, *Pointer_Destination_Byte;
-					unsigned short Bytes_To_Copy_Count;
-
-					// Extract the operands
-					Pixels_Amount = Instruction_Low_Byte & 0x0F;
+				Interpreter_Input_Stream_Keys_Mask = Interpreter_Input_Stream_Next_Keys_Mask;
+				InterpreterInputStreamReadEvent();
+			}
+			else Interpreter_Input_Stream_Frames_Count--;
+		}
+	}
 
-					LOG(INTERPRETER_IS_LOGGING_ENABLED, "SCROLL-DOWN %u.", Pixels_Amount);
+	/** Let a frame elapse while an instruction is blocked waiting for the keys, so the recorded or replayed keys can change. The frame lasts a tick, so the stream does not grow with the CPU speed. */
+	static void InterpreterInputStreamWaitForNextFrame(void)
+	{
+		if (Interpreter_Input_Stream_Mode == INTERPRETER_INPUT_STREAM_MODE_DISABLED) return;
 
-					// The value 0 seems to be wasted and does nothing
-					if (Pixels_Amount == 0) break;
+		InterpreterPlatformClearTick();
+		InterpreterWaitForTick();
+		InterpreterInputStreamProcessFrame();
+	}
 
-					// Compute the source and destination addresses of the framebuffer copy operation
-					Columns_Count_Byte = Display_Columns_Count / 8; // Address the bytes directly
-					// Start writing to the display last byte
-					Pointer_Destination_Byte = Shared_Buffer_Display + (Display_Rows_Count * Columns_Count_Byte) - 1;
-					// Start reading from the last byte of the framebuffer area that needs to be copied
-					Pointer_Source_Byte = Pointer_Destination_Byte - (Pixels_Amount * Columns_Count_Byte);
+	/** Terminate the input stream when the program exits. The recording ends with an event applied at the frame following the last one, so the replay stops at the same place than the recording when the user leaves the program. */
+	static void InterpreterInputStreamStop(void)
+	{
+		if (Interpreter_Input_Stream_Mode == INTERPRETER_INPUT_STREAM_MODE_DISABLED) return;
 
-					// Copy the scrolled picture bytes from the last byte to the first, to avoid adjusting the pointer values between each line
-					Rows_Count = Display_Rows_Count - Pixels_Amount;
-					Bytes_To_Copy_Count = Rows_Count * Columns_Count_Byte;
-					while (Bytes_To_Copy_Count > 0)
-					{
-						*Pointer_Destination_Byte = *Pointer_Source_Byte;
-						Pointer_Destination_Byte--;
-						Pointer_Source_Byte--;
-						Bytes_To_Copy_Count--;
-					}
+		if (Interpreter_Input_Stream_Mode == INTERPRETER_INPUT_STREAM_MODE_RECORD)
+		{
+			InterpreterPlatformWriteInputStreamByte(Interpreter_Input_Stream_Frames_Count);
+			InterpreterPlatformWriteInputStreamByte(Interpreter_Input_Stream_Keys_Mask);
+			InterpreterPlatformWriteInputStreamByte(INTERPRETER_INPUT_STREAM_END_MARKER);
+			InterpreterPlatformWriteInputStreamByte(0);
+		}
+		InterpreterPlatformCloseInputStream();
+	}
+#endif
 
-					// Clear the scrolled part of the picture
-					while (Pointer_Destination_Byte != Shared_Buffer_Display)
-					{
-						*Pointer_Destination_Byte = 0;
-						Pointer_Destination_Byte--;
-					}
+/** Read the keys seen by the program, they come from the input stream when the keys are recorded or replayed.
+ * @return A bit mask of the pressed keys, built with the TKeyboardKey values.
+ */
+static inline unsigned char InterpreterReadKeysMask(void)
+{
+	#if INTERPRETER_IS_INPUT_STREAM_ENABLED == 1
+		if (Interpreter_Input_Stream_Mode != INTERPRETER_INPUT_STREAM_MODE_DISABLED) return Interpreter_Input_Stream_Keys_Mask;
+	#endif
+	return InterpreterReadKeyboardKeysMask();
+}
 
-					break;
-				}
+#if INTERPRETER_IS_IDLE_LOOP_DETECTION_ENABLED == 1
+	/** Tell whether a loop can only be left when the delay timer changes. The loop body can only contain the "LD Vx, DT", "LD Vx, byte", "SE" and "SNE" instructions, and jumps out of the loop following a skip. Each tested register must not be written by the loop, or it must have been unconditionally written before by the same loop iteration. This way, each iteration tests the same values and takes the same path until the delay timer decrements, which can only happen at the next tick. The instructions modifying the memory, the I register or the display, and the keys tests, are not accepted because their results change from one iteration to another.
+	 * @param Address The loop first instruction address.
+	 * @param Jump_Address The address of the jump instruction going back to the loop first instruction.
+	 * @return 1 if the loop is waiting for the delay timer,
+	 * @return 0 if the loop may do something else or if it is too long to be checked.
+	 */
+	static unsigned char InterpreterIsDelayTimerPollingLoop(unsigned short Address, unsigned short Jump_Address)
+	{
+		unsigned char *Pointer_Instruction, Instruction_High_Byte, Instruction_Low_Byte, Is_Instruction_Skip, Is_Previous_Instruction_Skip = 0;
+		unsigned short Written_Registers_Mask = 0, Unconditionally_Written_Registers_Mask = 0, Tested_Registers_Mask = 0, Register_X_Mask, Register_Y_Mask, Jump_Target;
 
-				switch (Instruction_Low_Byte)
-				{
-					// CLS
-					case 0xE0:
-						memset(Shared_Buffer_Display, 0, sizeof(Shared_Buffer_Display));
-						DisplayDrawFullSizeBuffer(Shared_Buffer_Display);
-						LOG(INTERPRETER_IS_LOGGING_ENABLED, "CLS.");
-						break;
-
-					// RET
-					case 0xEE:
-						LOG(INTERPRETER_IS_LOGGING_ENABLED, "RET (SP = %d).", Interpreter_Register_SP);
-						// Make sure there is a valid address on the stack
-						if (Interpreter_Register_SP == 0)
-						{
-							LOG(INTERPRETER_IS_LOGGING_ENABLED, "Error : virtual stack underflow. Stopping interpreter.");
-							memset(Shared_Buffer_Display, 0, sizeof(Shared_Buffer_Display));
-							DisplayDrawTextMessage(Shared_Buffer_Display, LocalizedStringGet(LOCALIZED_STRING_ID_INTERPRETER_MESSAGE_ERROR_TITLE), LocalizedStringGet(LOCALIZED_STRING_ID_INTERPRETER_MESSAGE_VIRTUAL_STACK_UNDERFLOW_CONTENT));
-							while (!KeyboardIsMenuKeyPressed());
-							return 1;
-						}
-						Interpreter_Register_SP--; // The CALL instruction increments the stack pointer after pushing, so the RET instruction needs to decrement the stack pointer before popping
-						Interpreter_Register_PC = Interpreter_Stack[Interpreter_Register_SP];
-						goto Next_Instruction; // Bypass PC incrementation
+		// The loop can't wrap around the memory end, the jump instruction ending it has a higher address
+		if ((unsigned short) (Jump_Address - Address) > INTERPRETER_IDLE_LOOP_MAXIMUM_INSTRUCTIONS_COUNT * 2) return 0;
 
-					// SCROLL RIGHT
-					case 0xFB:
-					{
-						unsigned char Row, Column, Columns_Count_Byte, *Pointer_Byte, Current_Byte, Previous_Byte;
+		for (Pointer_Instruction = &Shared_Buffers.Interpreter_Memory[Address]; Pointer_Instruction < &Shared_Buffers.Interpreter_Memory[Jump_Address]; Pointer_Instruction += 2)
+		{
+			Instruction_High_Byte = Pointer_Instruction[0];
+			Instruction_Low_Byte = Pointer_Instruction[1];
+			Register_X_Mask = 1 << (Instruction_High_Byte & 0x0F);
+			Register_Y_Mask = 1 << (Instruction_Low_Byte >> 4);
+			Is_Instruction_Skip = 0;
 
-						LOG(INTERPRETER_IS_LOGGING_ENABLED, "SCROLL-RIGHT.");
+			switch (Instruction_High_Byte >> 4)
+			{
+				// JP addr, it must leave the loop and it must be conditional (the loop would never jump back otherwise)
+				case 0x1:
+					Jump_Target = ((unsigned short) (Instruction_High_Byte & 0x0F) << 8) | Instruction_Low_Byte;
+					if (!Is_Previous_Instruction_Skip || ((Jump_Target >= Address) && (Jump_Target <= Jump_Address))) return 0;
+					break;
 
-						// Cache some values
-						Columns_Count_Byte = Display_Columns_Count / 8; // Address the bytes directly
-						Pointer_Byte = Shared_Buffer_Display + (Display_Rows_Count * Columns_Count_Byte) - 1; // Use a pointer to avoid computing the byte position in the array every time, go to the last byte of the last row
-						Columns_Count_Byte--; // Remove one because the following loop is addressing the previous and current bytes
+				// SE Vx, byte and SNE Vx, byte
+				case 0x3:
+				case 0x4:
+					// Only the tests made before the register is written in this iteration read a value from a previous iteration
+					if (!(Unconditionally_Written_Registers_Mask & Register_X_Mask)) Tested_Registers_Mask |= Register_X_Mask;
+					Is_Instruction_Skip = 1;
+					break;
 
-						// Shift all rows by 4 bits on the right, starting from the frame buffer end so the display pointer only needs to be decremented (this is a simple implementation that is not optimized)
-						for (Row = 0; Row < Display_Rows_Count; Row++)
-						{
-							for (Column = 0; Column < Columns_Count_Byte; Column++)
-							{
-								Current_Byte = *Pointer_Byte;
-								Previous_Byte = *(Pointer_Byte - 1);
-
-								Current_Byte >>= 4;
-								Previous_Byte <<= 4;
-								Current_Byte |= Previous_Byte;
-
-								*Pointer_Byte = Current_Byte;
-								Pointer_Byte--;
-							}
-
-							// Handle the last row byte, which must be only shifted
-							Current_Byte = *Pointer_Byte;
-							Current_Byte >>= 4;
-							*Pointer_Byte = Current_Byte;
-							Pointer_Byte--;
-						}
+				// SE Vx, Vy and SNE Vx, Vy (the XO-CHIP instructions using the same prefix are not accepted)
+				case 0x5:
+				case 0x9:
+					if ((Instruction_Low_Byte & 0x0F) != 0) return 0;
+					if (!(Unconditionally_Written_Registers_Mask & Register_X_Mask)) Tested_Registers_Mask |= Register_X_Mask;
+					if (!(Unconditionally_Written_Registers_Mask & Register_Y_Mask)) Tested_Registers_Mask |= Register_Y_Mask;
+					Is_Instruction_Skip = 1;
+					break;
 
-						break;
-					}
+				// LD Vx, byte
+				case 0x6:
+					Written_Registers_Mask |= Register_X_Mask;
+					if (!Is_Previous_Instruction_Skip) Unconditionally_Written_Registers_Mask |= Register_X_Mask;
+					break;
 
-					// SCROLL LEFT
-					case 0xFC:
-					{
-						unsigned char Row, Column, Columns_Count_Byte, *Pointer_Byte, Current_Byte, Next_Byte;
+				// LD Vx, DT
+				case 0xF:
+					if (Instruction_Low_Byte != 0x07) return 0;
+					Written_Registers_Mask |= Register_X_Mask;
+					if (!Is_Previous_Instruction_Skip) Unconditionally_Written_Registers_Mask |= Register_X_Mask;
+					break;
 
-						LOG(INTERPRETER_IS_LOGGING_ENABLED, "SCROLL-LEFT.");
+				default:
+					return 0;
+			}
 
-						// Cache some values
-						Columns_Count_Byte = Display_Columns_Count / 8; // Address the bytes directly
-						Columns_Count_Byte--; // Remove one because the following loop is addressing the current and next bytes
-						Pointer_Byte = Shared_Buffer_Display; // Use a pointer to avoid computing the byte position in the array every time
+			Is_Previous_Instruction_Skip = Is_Instruction_Skip;
+		}
 
-						// Shift all rows by 4 bits on the left (this is a simple implementation that is not optimized)
-						for (Row = 0; Row < Display_Rows_Count; Row++)
-						{
-							for (Column = 0; Column < Columns_Count_Byte; Column++)
-							{
-								Current_Byte = *Pointer_Byte;
-								Next_Byte = *(Pointer_Byte + 1);
-
-								Current_Byte <<= 4; // TODO it would be nice to use SWAPF followed by logical and to gain some cycles instead of the shifts, but there seem to be no compiler builtin for that and using assembly is not really portable
-								Next_Byte >>= 4;
-								Current_Byte |= Next_Byte;
-
-								*Pointer_Byte = Current_Byte;
-								Pointer_Byte++;
-							}
-
-							// Handle the last row byte, which must be only shifted
-							Current_Byte = *Pointer_Byte;
-							Current_Byte <<= 4;
-							*Pointer_Byte = Current_Byte;
-							Pointer_Byte++;
-						}
+		// A register written by the loop and tested before being written may hold a value that the next iteration will not see anymore
+		if (Tested_Registers_Mask & Written_Registers_Mask) return 0;
+		return 1;
+	}
+#endif
 
-						break;
-					}
+/** Tell the user that the instruction can't be executed and stop the program (this handler is used for all unsupported encodings). */
+static void InterpreterExecuteInvalid(unsigned char Register_Index_X, unsigned char Register_Index_Y, unsigned short Operand)
+{
+	unsigned char Instruction_High_Byte, Instruction_Low_Byte;
+	unsigned short Address;
 
-					// EXIT
-					case 0xFD:
-						LOG(INTERPRETER_IS_LOGGING_ENABLED, "EXIT.");
-						goto Exit_Success;
-
-					// LOW
-					case 0xFE:
-						LOG(INTERPRETER_IS_LOGGING_ENABLED, "LOW (display resolution is 64x32).");
-						Display_Columns_Count = INTERPRETER_DISPLAY_COLUMNS_COUNT_CHIP_8;
-						Display_Rows_Count = INTERPRETER_DISPLAY_ROWS_COUNT_CHIP_8;
-						Is_High_Resolution_Enabled = 0;
-						break;
-
-					// HIGH
-					case 0xFF:
-						LOG(INTERPRETER_IS_LOGGING_ENABLED, "HIGH (display resolution is 128x64).");
-						Display_Columns_Count = INTERPRETER_DISPLAY_COLUMNS_COUNT_SUPER_CHIP_8;
-						Display_Rows_Count = INTERPRETER_DISPLAY_ROWS_COUNT_SUPER_CHIP_8;
-						Is_High_Resolution_Enabled = 1;
-						break;
-
-					default:
-						goto Invalid_Instruction;
-				}
-				break;
-			}
+	// The decoded instruction does not keep the raw opcode, so fetch it again (the program counter is already pointing to the next instruction)
+	Address = (Interpreter_Register_PC - 2) & 0x0FFF;
+	Instruction_High_Byte = Shared_Buffers.Interpreter_Memory[Address];
+	Instruction_Low_Byte = Shared_Buffers.Interpreter_Memory[(Address + 1) & 0x0FFF];
 
-			// JP addr
-			case 0x10:
-				Interpreter_Register_PC = (unsigned short) (Instruction_High_Byte & 0x0F) << 8;
-				Interpreter_Register_PC |= Instruction_Low_Byte;
-				LOG(INTERPRETER_IS_LOGGING_ENABLED, "JP 0x%03X.", Interpreter_Register_PC);
-				goto Next_Instruction; // Bypass PC incrementation
+	LOG(INTERPRETER_IS_LOGGING_ENABLED, "Invalid instruction 0x%02X%02X at address 0x%03X. Stopping interpreter.", Instruction_High_Byte, Instruction_Low_Byte, Address);
+	snprintf(Shared_Buffers.String_Temporary, sizeof(Shared_Buffers.String_Temporary), LocalizedStringGet(LOCALIZED_STRING_ID_INTERPRETER_MESSAGE_INVALID_INSTRUCTION_CONTENT), Instruction_High_Byte, Instruction_Low_Byte, Address);
+	InterpreterPlatformDisplayErrorMessage(Shared_Buffers.String_Temporary);
 
-			// CALL addr
-			case 0x20:
-			{
-				unsigned short Address;
+	Interpreter_Execution_State = INTERPRETER_EXECUTION_STATE_ERROR;
+}
 
-				// Extract the operands
-				Address = (unsigned short) (Instruction_High_Byte & 0x0F) << 8;
-				Address |= Instruction_Low_Byte; // The address will by default be on 12 bits due to the instruction encoding, so no need to check for an overflow
-				LOG(INTERPRETER_IS_LOGGING_ENABLED, "CALL 0x%03X (SP = %d).", Address, Interpreter_Register_SP);
+/** Rotate the rows of a display plane down, the bottom rows reappear at the top.
+ * @param Pointer_Plane The plane frame buffer.
+ * @param Rows_Amount How many rows to rotate, it is in range 1 to the display height minus 1.
+ */
+static void InterpreterRotatePlaneDown(unsigned char *Pointer_Plane, unsigned char Rows_Amount)
+{
+	unsigned char Columns_Count, Pages_Count, Page, Source_Page, Pages_Shift, Bits_Shift, Column, *Pointer_Byte, Column_Bytes[DISPLAY_ROWS_COUNT / 8];
 
-				// Make sure there is still room on the stack
-				if (Interpreter_Register_SP >= INTERPRETER_STACK_SIZE)
-				{
-					LOG(INTERPRETER_IS_LOGGING_ENABLED, "Error : virtual stack overflow. Stopping interpreter.");
-					memset(Shared_Buffer_Display, 0, sizeof(Shared_Buffer_Display));
-					DisplayDrawTextMessage(Shared_Buffer_Display, LocalizedStringGet(LOCALIZED_STRING_ID_INTERPRETER_MESSAGE_ERROR_TITLE), LocalizedStringGet(LOCALIZED_STRING_ID_INTERPRETER_MESSAGE_VIRTUAL_STACK_OVERFLOW_CONTENT));
-					while (!KeyboardIsMenuKeyPressed());
-					return 1;
-				}
-				Interpreter_Stack[Interpreter_Register_SP] = Interpreter_Register_PC + 2; // Store the address of the instruction following this one
-				Interpreter_Register_SP++;
+	// A frame buffer byte stores 8 vertical pixels, so the rotation moves whole pages and then shifts the bits of each column
+	Columns_Count = Interpreter_Display_Columns_Count;
+	Pages_Count = Interpreter_Display_Rows_Count / 8;
+	Pages_Shift = Rows_Amount / 8;
+	Bits_Shift = Rows_Amount % 8;
 
-				// Jump to the function entry point
-				Interpreter_Register_PC = Address;
-				goto Next_Instruction; // Bypass PC incrementation
-			}
+	for (Column = 0; Column < Columns_Count; Column++)
+	{
+		// Keep a copy of the whole column, as each page receives the pixels of the pages above it
+		Pointer_Byte = Pointer_Plane + Column;
+		for (Page = 0; Page < Pages_Count; Page++)
+		{
+			Column_Bytes[Page] = *Pointer_Byte;
+			Pointer_Byte += Columns_Count;
+		}
 
-			// SE Vx, byte
-			case 0x30:
-			{
-				unsigned char Register_Index;
+		// The least significant bit is the top pixel, so the pixels going down are shifted to the left and the bottom pixels of the page above enter the page top (the pages count is a power of two)
+		Pointer_Byte = Pointer_Plane + Column;
+		for (Page = 0; Page < Pages_Count; Page++)
+		{
+			Source_Page = (Page - Pages_Shift) & (Pages_Count - 1);
+			if (Bits_Shift == 0) *Pointer_Byte = Column_Bytes[Source_Page];
+			else *Pointer_Byte = (unsigned char) (Column_Bytes[Source_Page] << Bits_Shift) | (Column_Bytes[(Source_Page - 1) & (Pages_Count - 1)] >> (8 - Bits_Shift));
+			Pointer_Byte += Columns_Count;
+		}
+	}
+}
 
-				// Extract the operands
-				Register_Index = Instruction_High_Byte & 0x0F;
+/** Clear some consecutive displayed rows of a display plane and send them at the next transfer.
+ * @param Pointer_Plane The plane frame buffer.
+ * @param Display_Row The first row to clear, given as a display row (the display row offset is applied to find the frame buffer row).
+ * @param Rows_Count How many rows to clear, it is in range 1 to 15.
+ */
+static void InterpreterClearPlaneRows(unsigned char *Pointer_Plane, unsigned char Display_Row, unsigned char Rows_Count)
+{
+	unsigned char Columns_Count, Row, Page_Rows_Count, Mask, Column, *Pointer_Page;
 
-				// Skip the next instruction if Vx is equal to the immediate value
-				if (Interpreter_Registers_V[Register_Index] == Instruction_Low_Byte) Interpreter_Register_PC += 2;
-				LOG(INTERPRETER_IS_LOGGING_ENABLED, "SE V%01X (= 0x%02X), 0x%02X.", Register_Index, Interpreter_Registers_V[Register_Index], Instruction_Low_Byte);
-				break;
-			}
+	Columns_Count = Interpreter_Display_Columns_Count;
+	Row = (Display_Row + Interpreter_Display_Row_Offset) & (Interpreter_Display_Rows_Count - 1);
+	while (Rows_Count > 0)
+	{
+		// Clear the rows belonging to the current page, they may go past the frame buffer end and continue from the first page
+		Page_Rows_Count = 8 - (Row % 8);
+		if (Page_Rows_Count > Rows_Count) Page_Rows_Count = Rows_Count;
+		Mask = (unsigned char) (((1 << Page_Rows_Count) - 1) << (Row % 8));
+		Pointer_Page = Pointer_Plane + (Row / 8) * Columns_Count;
+		if (Mask == 0xFF) memset(Pointer_Page, 0, Columns_Count);
+		else
+		{
+			Mask = ~Mask;
+			for (Column = 0; Column < Columns_Count; Column++) Pointer_Page[Column] &= Mask;
+		}
+		InterpreterMarkPageChanged(Row / 8, 0, Columns_Count - 1);
 
-			// SNE Vx, byte
-			case 0x40:
-			{
-				unsigned char Register_Index;
+		Row = (Row + Page_Rows_Count) & (Interpreter_Display_Rows_Count - 1);
+		Rows_Count -= Page_Rows_Count;
+	}
+}
 
-				// Extract the operands
-				Register_Index = Instruction_High_Byte & 0x0F;
+/** Scroll the selected display planes vertically by moving the displayed frame buffer rows, then clear the exposed rows.
+ * @param Rows_Amount How many rows to scroll, it is in range 1 to 15.
+ * @param Is_Scrolling_Down Set to 1 to scroll the planes down (the top rows are cleared), set to 0 to scroll them up (the bottom rows are cleared).
+ */
+static void InterpreterScrollPlanesVertically(unsigned char Rows_Amount, unsigned char Is_Scrolling_Down)
+{
+	unsigned char Displayed_Planes_Mask, Plane, Plane_Mask, Compensation_Rows_Amount, Exposed_Display_Row;
 
-				// Skip the next instruction if Vx is not equal to the immediate value
-				if (Interpreter_Registers_V[Register_Index] != Instruction_Low_Byte) Interpreter_Register_PC += 2;
-				LOG(INTERPRETER_IS_LOGGING_ENABLED, "SNE V%01X (= 0x%02X), 0x%02X.", Register_Index, Interpreter_Registers_V[Register_Index], Instruction_Low_Byte);
-				break;
-			}
+	// Moving the display top row scrolls all displayed planes at once, so the displayed planes that are not selected are rotated the opposite way to stay in place (this only happens with some XO-CHIP programs)
+	if (Is_Scrolling_Down)
+	{
+		Interpreter_Display_Row_Offset = (Interpreter_Display_Row_Offset - Rows_Amount) & (Interpreter_Display_Rows_Count - 1);
+		Compensation_Rows_Amount = Interpreter_Display_Rows_Count - Rows_Amount;
+		Exposed_Display_Row = 0;
+	}
+	else
+	{
+		Interpreter_Display_Row_Offset = (Interpreter_Display_Row_Offset + Rows_Amount) & (Interpreter_Display_Rows_Count - 1);
+		Compensation_Rows_Amount = Rows_Amount;
+		Exposed_Display_Row = Interpreter_Display_Rows_Count - Rows_Amount;
+	}
 
-			// SE Vx, Vy
-			case 0x50:
-			{
-				unsigned char Register_Index_1, Register_Index_2;
+	// The second plane content is kept blank until the program selects it
+	if (Interpreter_Is_Second_Plane_Enabled) Displayed_Planes_Mask = 0x03;
+	else Displayed_Planes_Mask = 0x01;
 
-				// Extract the operands
-				Register_Index_1 = Instruction_High_Byte & 0x0F;
-				Register_Index_2 = (Instruction_Low_Byte >> 4) & 0x0F;
+	for (Plane = 0, Plane_Mask = 1; Plane < INTERPRETER_DISPLAY_PLANES_COUNT; Plane++, Plane_Mask <<= 1)
+	{
+		if (Interpreter_Selected_Planes_Mask & Plane_Mask) InterpreterClearPlaneRows(Interpreter_Display_Planes[Plane], Exposed_Display_Row, Rows_Amount);
+		else if (Displayed_Planes_Mask & Plane_Mask)
+		{
+			InterpreterRotatePlaneDown(Interpreter_Display_Planes[Plane], Compensation_Rows_Amount);
+			InterpreterMarkFrameBufferChanged();
+		}
+	}
+}
 
-				// Skip the next instruction if Vx is not equal to Vy
-				if (Interpreter_Registers_V[Register_Index_1] == Interpreter_Registers_V[Register_Index_2]) Interpreter_Register_PC += 2;
-				LOG(INTERPRETER_IS_LOGGING_ENABLED, "SE V%01X (= 0x%02X), V%01X (= 0x%02X).", Register_Index_1, Interpreter_Registers_V[Register_Index_1], Register_Index_2, Interpreter_Registers_V[Register_Index_2]);
-				break;
-			}
+/** Rotate all display planes so the display top row is the frame buffer first row again. This is needed before the display resolution changes, because the frame buffer rows are then displayed at other locations. */
+static void InterpreterResetDisplayRowOffset(void)
+{
+	unsigned char Planes_Count, Plane;
 
-			// LD Vx, byte
-			case 0x60:
-			{
-				unsigned char Register_Index, Immediate_Value;
+	if (Interpreter_Display_Row_Offset == 0) return;
 
-				// Extract the operands
-				Register_Index = Instruction_High_Byte & 0x0F;
-				Immediate_Value = Instruction_Low_Byte;
+	// The second plane is blank until the program selects it, and its memory may still be used by the FAT driver, so leave it untouched in that case
+	if (Interpreter_Is_Second_Plane_Enabled) Planes_Count = INTERPRETER_DISPLAY_PLANES_COUNT;
+	else Planes_Count = 1;
 
-				Interpreter_Registers_V[Register_Index] = Immediate_Value;
-				LOG(INTERPRETER_IS_LOGGING_ENABLED, "LD V%01X, 0x%02X.", Register_Index, Immediate_Value);
-				break;
-			}
+	// Rotating the rows up by the offset moves the displayed top row to the frame buffer first row
+	for (Plane = 0; Plane < Planes_Count; Plane++) InterpreterRotatePlaneDown(Interpreter_Display_Planes[Plane], Interpreter_Display_Rows_Count - Interpreter_Display_Row_Offset);
+	Interpreter_Display_Row_Offset = 0;
+}
 
-			// ADD Vx, byte
-			case 0x70:
-			{
-				unsigned char Register_Index, Immediate_Value;
+/** Scroll a display plane 4 pixels of the current resolution to the right, the left columns are cleared. Only the columns whose content changes are moved and sent at the next transfer, a column changes when it differs from the column it receives (a blank page does not change at all).
+ * @param Pointer_Plane The plane frame buffer.
+ */
+static void InterpreterScrollPlaneRight(unsigned char *Pointer_Plane)
+{
+	unsigned char Page, Pages_Count, Columns_Count, First_Changed_Column, Last_Changed_Column, First_Moved_Column;
 
-				// Extract the operands
-				Register_Index = Instruction_High_Byte & 0x0F;
-				Immediate_Value = Instruction_Low_Byte;
+	// A frame buffer byte is a whole column of a page, so the columns are moved without any bit shifting
+	Columns_Count = Interpreter_Display_Columns_Count;
+	Pages_Count = Interpreter_Display_Rows_Count / 8;
+	for (Page = 0; Page < Pages_Count; Page++, Pointer_Plane += Columns_Count)
+	{
+		// Find the leftmost changing column, the 4 left columns receive blank columns and the other ones receive the column 4 pixels to their left
+		for (First_Changed_Column = 0; First_Changed_Column < 4; First_Changed_Column++)
+		{
+			if (Pointer_Plane[First_Changed_Column] != 0) break;
+		}
+		if (First_Changed_Column == 4)
+		{
+			// Most pages of a scrolled picture are blank, compare them at once (the library function is faster than a byte loop on the host)
+			if (memcmp(Pointer_Plane + 4, Pointer_Plane, Columns_Count - 4) == 0) continue;
+			while (Pointer_Plane[First_Changed_Column] == Pointer_Plane[First_Changed_Column - 4]) First_Changed_Column++;
+		}
 
-				Interpreter_Registers_V[Register_Index] += Immediate_Value;
-				LOG(INTERPRETER_IS_LOGGING_ENABLED, "ADD V%01X, 0x%02X.", Register_Index, Immediate_Value);
-				break;
-			}
+		// Find the rightmost changing column, there is at least the leftmost one
+		Last_Changed_Column = Columns_Count - 1;
+		while ((Last_Changed_Column >= 4) && (Pointer_Plane[Last_Changed_Column] == Pointer_Plane[Last_Changed_Column - 4])) Last_Changed_Column--;
+		if (Last_Changed_Column < 4)
+		{
+			while (Pointer_Plane[Last_Changed_Column] == 0) Last_Changed_Column--;
+		}
 
-			case 0x80:
-			{
-				switch (Instruction_Low_Byte & 0x0F)
-				{
-					// LD Vx, Vy
-					case 0x00:
-					{
-						unsigned char Register_Index_1, Register_Index_2;
+		// Move the changing columns (the columns crossing the display right edge are lost), then clear the changing columns among the 4 left ones
+		if (First_Changed_Column < 4) First_Moved_Column = 4;
+		else First_Moved_Column = First_Changed_Column;
+		if (Last_Changed_Column >= 4) memmove(Pointer_Plane + First_Moved_Column, Pointer_Plane + First_Moved_Column - 4, Last_Changed_Column - First_Moved_Column + 1);
+		if (First_Changed_Column < 4)
+		{
+			if (Last_Changed_Column < 4) memset(Pointer_Plane + First_Changed_Column, 0, Last_Changed_Column - First_Changed_Column + 1);
+			else memset(Pointer_Plane + First_Changed_Column, 0, 4 - First_Changed_Column);
+		}
+		InterpreterMarkPageChanged(Page, First_Changed_Column, Last_Changed_Column);
+	}
+}
 
-						// Extract the operands
-						Register_Index_1 = Instruction_High_Byte & 0x0F;
-						Register_Index_2 = (Instruction_Low_Byte >> 4) & 0x0F;
+/** Scroll a display plane 4 pixels of the current resolution to the left, the right columns are cleared. Only the columns whose content changes are moved and sent at the next transfer, a column changes when it differs from the column it receives (a blank page does not change at all).
+ * @param Pointer_Plane The plane frame buffer.
+ */
+static void InterpreterScrollPlaneLeft(unsigned char *Pointer_Plane)
+{
+	unsigned char Page, Pages_Count, Columns_Count, Cleared_Columns_Start, First_Changed_Column, Last_Changed_Column, Last_Moved_Column;
 
-						Interpreter_Registers_V[Register_Index_1] = Interpreter_Registers_V[Register_Index_2];
-						LOG(INTERPRETER_IS_LOGGING_ENABLED, "LD V%01X, V%01X (= 0x%02X).", Register_Index_1, Register_Index_2, Interpreter_Registers_V[Register_Index_2]);
-						break;
-					}
+	// A frame buffer byte is a whole column of a page, so the columns are moved without any bit shifting
+	Columns_Count = Interpreter_Display_Columns_Count;
+	Pages_Count = Interpreter_Display_Rows_Count / 8;
+	Cleared_Columns_Start = Columns_Count - 4;
+	for (Page = 0; Page < Pages_Count; Page++, Pointer_Plane += Columns_Count)
+	{
+		// Find the leftmost changing column, the 4 right columns receive blank columns and the other ones receive the column 4 pixels to their right
+		for (First_Changed_Column = Cleared_Columns_Start; First_Changed_Column < Columns_Count; First_Changed_Column++)
+		{
+			if (Pointer_Plane[First_Changed_Column] != 0) break;
+		}
+		if (First_Changed_Column == Columns_Count)
+		{
+			// Most pages of a scrolled picture are blank, compare them at once (the library function is faster than a byte loop on the host)
+			if (memcmp(Pointer_Plane, Pointer_Plane + 4, Cleared_Columns_Start) == 0) continue;
+		}
+		First_Changed_Column = 0;
+		while ((First_Changed_Column < Cleared_Columns_Start) && (Pointer_Plane[First_Changed_Column] == Pointer_Plane[First_Changed_Column + 4])) First_Changed_Column++;
+		if (First_Changed_Column == Cleared_Columns_Start)
+		{
+			while (Pointer_Plane[First_Changed_Column] == 0) First_Changed_Column++;
+		}
 
-					// OR Vx, Vy
-					case 0x01:
-					{
-						unsigned char Register_Index_1, Register_Index_2;
+		// Find the rightmost changing column, there is at least the leftmost one
+		for (Last_Changed_Column = Columns_Count - 1; Last_Changed_Column >= Cleared_Columns_Start; Last_Changed_Column--)
+		{
+			if (Pointer_Plane[Last_Changed_Column] != 0) break;
+		}
+		if (Last_Changed_Column < Cleared_Columns_Start)
+		{
+			while (Pointer_Plane[Last_Changed_Column] == Pointer_Plane[Last_Changed_Column + 4]) Last_Changed_Column--;
+		}
 
-						// Extract the operands
-						Register_Index_1 = Instruction_High_Byte & 0x0F;
-						Register_Index_2 = (Instruction_Low_Byte >> 4) & 0x0F;
+		// Move the changing columns (the columns crossing the display left edge are lost), then clear the changing columns among the 4 right ones
+		if (Last_Changed_Column >= Cleared_Columns_Start) Last_Moved_Column = Cleared_Columns_Start - 1;
+		else Last_Moved_Column = Last_Changed_Column;
+		if (First_Changed_Column < Cleared_Columns_Start) memmove(Pointer_Plane + First_Changed_Column, Pointer_Plane + First_Changed_Column + 4, Last_Moved_Column - First_Changed_Column + 1);
+		if (Last_Changed_Column >= Cleared_Columns_Start)
+		{
+			if (First_Changed_Column >= Cleared_Columns_Start) memset(Pointer_Plane + First_Changed_Column, 0, Last_Changed_Column - First_Changed_Column + 1);
+			else memset(Pointer_Plane + Cleared_Columns_Start, 0, Last_Changed_Column - Cleared_Columns_Start + 1);
+		}
+		InterpreterMarkPageChanged(Page, First_Changed_Column, Last_Changed_Column);
+	}
+}
 
-						LOG(INTERPRETER_IS_LOGGING_ENABLED, "OR V%01X (= 0x%02X), V%01X (= 0x%02X).", Register_Index_1, Interpreter_Registers_V[Register_Index_1], Register_Index_2, Interpreter_Registers_V[Register_Index_2]);
-						Interpreter_Registers_V[Register_Index_1] |= Interpreter_Registers_V[Register_Index_2];
+/** Execute the SCROLL DOWN instruction (00Cn). */
+static void InterpreterExecuteScrollDown(unsigned char Register_Index_X, unsigned char Register_Index_Y, unsigned short Operand)
+{
+	unsigned char Pixels_Amount;
 
-						// Apply the reset VF quirk if enabled
-						if (Interpreter_Is_VF_Reset_Enabled) Interpreter_Registers_V[15] = 0;
-						break;
-					}
+	// Extract the operands
+	Pixels_Amount = (unsigned char) Operand;
 
-					// AND Vx, Vy
-					case 0x02:
-					{
-						unsigned char Register_Index_1, Register_Index_2;
+	LOG(INTERPRETER_IS_LOGGING_ENABLED, "SCROLL-DOWN %u.", Pixels_Amount);
 
-						// Extract the operands
-						Register_Index_1 = Instruction_High_Byte & 0x0F;
-						Register_Index_2 = (Instruction_Low_Byte >> 4) & 0x0F;
+	// The value 0 seems to be wasted and does nothing
+	if (Pixels_Amount == 0) return;
 
-						LOG(INTERPRETER_IS_LOGGING_ENABLED, "AND V%01X (= 0x%02X), V%01X (= 0x%02X).", Register_Index_1, Interpreter_Registers_V[Register_Index_1], Register_Index_2, Interpreter_Registers_V[Register_Index_2]);
-						Interpreter_Registers_V[Register_Index_1] &= Interpreter_Registers_V[Register_Index_2];
+	InterpreterScrollPlanesVertically(Pixels_Amount, 1);
+}
 
-						// Apply the reset VF quirk if enabled
-						if (Interpreter_Is_VF_Reset_Enabled) Interpreter_Registers_V[15] = 0;
-						break;
-					}
+/** Execute the SCROLL UP instruction (00Dn). */
+static void InterpreterExecuteScrollUp(unsigned char Register_Index_X, unsigned char Register_Index_Y, unsigned short Operand)
+{
+	unsigned char Pixels_Amount;
 
-					// XOR Vx, Vy
-					case 0x03:
-					{
-						unsigned char Register_Index_1, Register_Index_2;
+	// Extract the operands
+	Pixels_Amount = (unsigned char) Operand;
 
-						// Extract the operands
-						Register_Index_1 = Instruction_High_Byte & 0x0F;
-						Register_Index_2 = (Instruction_Low_Byte >> 4) & 0x0F;
+	LOG(INTERPRETER_IS_LOGGING_ENABLED, "SCROLL-UP %u.", Pixels_Amount);
 
-						LOG(INTERPRETER_IS_LOGGING_ENABLED, "XOR V%01X (= 0x%02X), V%01X (= 0x%02X).", Register_Index_1, Interpreter_Registers_V[Register_Index_1], Register_Index_2, Interpreter_Registers_V[Register_Index_2]);
-						Interpreter_Registers_V[Register_Index_1] ^= Interpreter_Registers_V[Register_Index_2];
+	// Like SCROLL DOWN, the value 0 does nothing
+	if (Pixels_Amount == 0) return;
 
-						// Apply the reset VF quirk if enabled
-						if (Interpreter_Is_VF_Reset_Enabled) Interpreter_Registers_V[15] = 0;
-						break;
-					}
+	InterpreterScrollPlanesVertically(Pixels_Amount, 0);
+}
 
-					// ADD Vx, Vy
-					case 0x04:
-					{
-						unsigned char Register_Index_1, Register_Index_2;
-						unsigned short Sum;
+/** Execute the CLS instruction (00E0). */
+static void InterpreterExecuteCls(unsigned char Register_Index_X, unsigned char Register_Index_Y, unsigned short Operand)
+{
+	unsigned char Plane, Plane_Mask;
 
-						// Extract the operands
-						Register_Index_1 = Instruction_High_Byte & 0x0F;
-						Register_Index_2 = (Instruction_Low_Byte >> 4) & 0x0F;
+	// Only clear the selected planes
+	for (Plane = 0, Plane_Mask = 1; Plane < INTERPRETER_DISPLAY_PLANES_COUNT; Plane++, Plane_Mask <<= 1)
+	{
+		if (Interpreter_Selected_Planes_Mask & Plane_Mask) memset(Interpreter_Display_Planes[Plane], 0, sizeof(Shared_Buffer_Display));
+	}
+	// Send the cleared pages with the next frame, the programs often draw the new picture right after clearing the display
+	InterpreterMarkFrameBufferChanged();
+	Interpreter_Is_Rendering_Needed = 1;
+	LOG(INTERPRETER_IS_LOGGING_ENABLED, "CLS.");
+}
 
-						Sum = Interpreter_Registers_V[Register_Index_1] + Interpreter_Registers_V[Register_Index_2]; // Compute the operation on a 16-bit variable to be able to detect an overflow
-						LOG(INTERPRETER_IS_LOGGING_ENABLED, "ADD V%01X (= 0x%02X), V%01X (= 0x%02X).", Register_Index_1, Interpreter_Registers_V[Register_Index_1], Register_Index_2, Interpreter_Registers_V[Register_Index_2]);
-						Interpreter_Registers_V[Register_Index_1] = (unsigned char) Sum;
+/** Execute the RET instruction (00EE). */
+static void InterpreterExecuteRet(unsigned char Register_Index_X, unsigned char Register_Index_Y, unsigned short Operand)
+{
+	LOG(INTERPRETER_IS_LOGGING_ENABLED, "RET (SP = %d).", Interpreter_Register_SP);
+	// Make sure there is a valid address on the stack
+	if (Interpreter_Register_SP == 0)
+	{
+		LOG(INTERPRETER_IS_LOGGING_ENABLED, "Error : virtual stack underflow. Stopping interpreter.");
+		InterpreterPlatformDisplayErrorMessage(LocalizedStringGet(LOCALIZED_STRING_ID_INTERPRETER_MESSAGE_VIRTUAL_STACK_UNDERFLOW_CONTENT));
+		Interpreter_Execution_State = INTERPRETER_EXECUTION_STATE_ERROR;
+		return;
+	}
+	Interpreter_Register_SP--; // The CALL instruction increments the stack pointer after pushing, so the RET instruction needs to decrement the stack pointer before popping
+	Interpreter_Register_PC = Interpreter_Stack[Interpreter_Register_SP];
+}
 
-						// Set VF register if carry is set
-						if (Sum & 0x0100) Interpreter_Registers_V[15] = 1;
-						else Interpreter_Registers_V[15] = 0;
-						break;
-					}
+/** Execute the SCROLL RIGHT instruction (00FB). The low resolution mode scrolls by 4 low resolution pixels (8 display pixels) like the XO-CHIP and the modern Super-Chip interpreters, the XO-CHIP programs drawing in this mode expect it. The original HP48 Super-Chip 1.1 scrolled by half this distance in low resolution mode, this behavior is not emulated (both behaviors are the same in high resolution mode). */
+static void InterpreterExecuteScrollRight(unsigned char Register_Index_X, unsigned char Register_Index_Y, unsigned short Operand)
+{
+	unsigned char Plane, Plane_Mask;
 
-					// SUB Vx, Vy
-					case 0x05:
-					{
-						unsigned char Register_Index_1, Register_Index_2, Register_Value_1, Register_Value_2;
+	LOG(INTERPRETER_IS_LOGGING_ENABLED, "SCROLL-RIGHT.");
 
-						// Extract the operands
-						Register_Index_1 = Instruction_High_Byte & 0x0F;
-						Register_Index_2 = (Instruction_Low_Byte >> 4) & 0x0F;
+	for (Plane = 0, Plane_Mask = 1; Plane < INTERPRETER_DISPLAY_PLANES_COUNT; Plane++, Plane_Mask <<= 1)
+	{
+		if (Interpreter_Selected_Planes_Mask & Plane_Mask) InterpreterScrollPlaneRight(Interpreter_Display_Planes[Plane]);
+	}
+}
 
-						Register_Value_1 = Interpreter_Registers_V[Register_Index_1];
-						Register_Value_2 = Interpreter_Registers_V[Register_Index_2];
-						Interpreter_Registers_V[Register_Index_1] -= Register_Value_2;
-						LOG(INTERPRETER_IS_LOGGING_ENABLED, "SUB V%01X (= 0x%02X), V%01X (= 0x%02X).", Register_Index_1, Register_Value_1, Register_Index_2, Register_Value_2);
+/** Execute the SCROLL LEFT instruction (00FC). The scrolling distance is the same than SCROLL RIGHT one. */
+static void InterpreterExecuteScrollLeft(unsigned char Register_Index_X, unsigned char Register_Index_Y, unsigned short Operand)
+{
+	unsigned char Plane, Plane_Mask;
 
-						// Set VF register if borrow is clear
-						if (Register_Value_1 >= Register_Value_2) Interpreter_Registers_V[15] = 1;
-						else Interpreter_Registers_V[15] = 0;
-						break;
-					}
+	LOG(INTERPRETER_IS_LOGGING_ENABLED, "SCROLL-LEFT.");
 
-					// SHR Vx, Vy
-					case 0x06:
-					{
-						unsigned char Register_Index_1, Register_Index_2, Value, Is_Bit_Shifted_Out;
+	for (Plane = 0, Plane_Mask = 1; Plane < INTERPRETER_DISPLAY_PLANES_COUNT; Plane++, Plane_Mask <<= 1)
+	{
+		if (Interpreter_Selected_Planes_Mask & Plane_Mask) InterpreterScrollPlaneLeft(Interpreter_Display_Planes[Plane]);
+	}
+}
 
-						// Extract the operands
-						Register_Index_1 = Instruction_High_Byte & 0x0F; // Vx
+/** Execute the EXIT instruction (00FD). */
+static void InterpreterExecuteExit(unsigned char Register_Index_X, unsigned char Register_Index_Y, unsigned short Operand)
+{
+	LOG(INTERPRETER_IS_LOGGING_ENABLED, "EXIT.");
+	Interpreter_Execution_State = INTERPRETER_EXECUTION_STATE_EXIT;
+}
 
-						// Use the value provided by Vy if asked to
-						if (Interpreter_Is_Shift_Using_Vy_Enabled)
-						{
-							Register_Index_2 = (Instruction_Low_Byte >> 4) & 0x0F; // Vy
-							Value = Interpreter_Registers_V[Register_Index_2];
-							LOG(INTERPRETER_IS_LOGGING_ENABLED, "SHR V%01X (= 0x%02X), V%01X = (0x%02X).", Register_Index_1, Interpreter_Registers_V[Register_Index_1], Register_Index_2, Value);
-						}
-						else
-						{
-							// Retrieve the Vx value
-							Value = Interpreter_Registers_V[Register_Index_1];
-							LOG(INTERPRETER_IS_LOGGING_ENABLED, "SHR V%01X (= 0x%02X).", Register_Index_1, Value);
-						}
+/** Execute the LOW instruction (00FE). */
+static void InterpreterExecuteLow(unsigned char Register_Index_X, unsigned char Register_Index_Y, unsigned short Operand)
+{
+	LOG(INTERPRETER_IS_LOGGING_ENABLED, "LOW (display resolution is 64x32).");
+	InterpreterResetDisplayRowOffset();
+	Interpreter_Display_Columns_Count = INTERPRETER_DISPLAY_COLUMNS_COUNT_CHIP_8;
+	Interpreter_Display_Rows_Count = INTERPRETER_DISPLAY_ROWS_COUNT_CHIP_8;
+	Interpreter_Is_High_Resolution_Enabled = 0;
+	InterpreterMarkFrameBufferChanged(); // The same frame buffer bytes are displayed at another location
+}
 
-						if (Value & 0x01) Is_Bit_Shifted_Out = 1; // Set VF if the Vx least significant bit is set
-						else Is_Bit_Shifted_Out = 0;
-						Value >>= 1;
-						Interpreter_Registers_V[Register_Index_1] = Value;
+/** Execute the HIGH instruction (00FF). */
+static void InterpreterExecuteHigh(unsigned char Register_Index_X, unsigned char Register_Index_Y, unsigned short Operand)
+{
+	LOG(INTERPRETER_IS_LOGGING_ENABLED, "HIGH (display resolution is 128x64).");
+	InterpreterResetDisplayRowOffset();
+	Interpreter_Display_Columns_Count = INTERPRETER_DISPLAY_COLUMNS_COUNT_SUPER_CHIP_8;
+	Interpreter_Display_Rows_Count = INTERPRETER_DISPLAY_ROWS_COUNT_SUPER_CHIP_8;
+	Interpreter_Is_High_Resolution_Enabled = 1;
+	InterpreterMarkFrameBufferChanged(); // The same frame buffer bytes are displayed at another location
+}
 
-						// Set VF at the end, in case VF was the output register just before
-						Interpreter_Registers_V[15] = Is_Bit_Shifted_Out;
-						break;
-					}
+/** Execute the JP addr instruction (1nnn). */
+static void InterpreterExecuteJpAddress(unsigned char Register_Index_X, unsigned char Register_Index_Y, unsigned short Operand)
+{
+	#if INTERPRETER_IS_IDLE_LOOP_DETECTION_ENABLED == 1
+		// A jump to itself can only be left by an interrupt (like the menu key), and a loop polling the delay timer can only be left when the timer decrements, nothing can change before the next tick in both cases
+		if (Operand == Interpreter_Register_PC - 2) Interpreter_Execution_State = INTERPRETER_EXECUTION_STATE_IDLE;
+		else if ((Operand < Interpreter_Register_PC - 2) && InterpreterIsDelayTimerPollingLoop(Operand, Interpreter_Register_PC - 2)) Interpreter_Execution_State = INTERPRETER_EXECUTION_STATE_IDLE; // Like the "LD Vx, DT", "SE Vx, 0", "JP loop_start" loop
+	#endif
 
-					// SUBN Vx, Vy
-					case 0x07:
-					{
-						unsigned char Register_Index_1, Register_Index_2, Register_Value_1, Register_Value_2;
+	Interpreter_Register_PC = Operand;
+	LOG(INTERPRETER_IS_LOGGING_ENABLED, "JP 0x%03X.", Interpreter_Register_PC);
+}
 
-						// Extract the operands
-						Register_Index_1 = Instruction_High_Byte & 0x0F;
-						Register_Index_2 = (Instruction_Low_Byte >> 4) & 0x0F;
+/** Execute the CALL addr instruction (2nnn). */
+static void InterpreterExecuteCallAddress(unsigned char Register_Index_X, unsigned char Register_Index_Y, unsigned short Operand)
+{
+	LOG(INTERPRETER_IS_LOGGING_ENABLED, "CALL 0x%03X (SP = %d).", Operand, Interpreter_Register_SP);
 
-						Register_Value_1 = Interpreter_Registers_V[Register_Index_1];
-						Register_Value_2 = Interpreter_Registers_V[Register_Index_2];
-						Interpreter_Registers_V[Register_Index_1] = Register_Value_2 - Register_Value_1;
-						LOG(INTERPRETER_IS_LOGGING_ENABLED, "SUBN V%01X (= 0x%02X), V%01X (= 0x%02X).", Register_Index_1, Register_Value_1, Register_Index_2, Register_Value_2);
+	// Make sure there is still room on the stack
+	if (Interpreter_Register_SP >= INTERPRETER_STACK_SIZE)
+	{
+		LOG(INTERPRETER_IS_LOGGING_ENABLED, "Error : virtual stack overflow. Stopping interpreter.");
+		InterpreterPlatformDisplayErrorMessage(LocalizedStringGet(LOCALIZED_STRING_ID_INTERPRETER_MESSAGE_VIRTUAL_STACK_OVERFLOW_CONTENT));
+		Interpreter_Execution_State = INTERPRETER_EXECUTION_STATE_ERROR;
+		return;
+	}
+	Interpreter_Stack[Interpreter_Register_SP] = Interpreter_Register_PC; // Store the address of the instruction following this one (the program counter is already pointing to it)
+	Interpreter_Register_SP++;
 
-						// Set VF register if borrow is clear
-						if (Register_Value_2 >= Register_Value_1) Interpreter_Registers_V[15] = 1;
-						else Interpreter_Registers_V[15] = 0;
-						break;
-					}
+	// Jump to the function entry point (the address is on 12 bits due to the instruction encoding, so no need to check for an overflow)
+	Interpreter_Register_PC = Operand;
+}
 
-					// SHL Vx, Vy
-					case 0x0E:
-					{
-						unsigned char Register_Index_1, Register_Index_2, Value, Is_Bit_Shifted_Out;
+/** Execute the SE Vx, byte instruction (3xkk). */
+static void InterpreterExecuteSeVxByte(unsigned char Register_Index_X, unsigned char Register_Index_Y, unsigned short Operand)
+{
+	// Skip the next instruction if Vx is equal to the immediate value
+	if (Interpreter_Registers_V[Register_Index_X] == (unsigned char) Operand) INTERPRETER_SKIP_NEXT_INSTRUCTION();
+	LOG(INTERPRETER_IS_LOGGING_ENABLED, "SE V%01X (= 0x%02X), 0x%02X.", Register_Index_X, Interpreter_Registers_V[Register_Index_X], Operand);
+}
 
-						// Extract the operands
-						Register_Index_1 = Instruction_High_Byte & 0x0F;
+/** Execute the SNE Vx, byte instruction (4xkk). */
+static void InterpreterExecuteSneVxByte(unsigned char Register_Index_X, unsigned char Register_Index_Y, unsigned short Operand)
+{
+	// Skip the next instruction if Vx is not equal to the immediate value
+	if (Interpreter_Registers_V[Register_Index_X] != (unsigned char) Operand) INTERPRETER_SKIP_NEXT_INSTRUCTION();
+	LOG(INTERPRETER_IS_LOGGING_ENABLED, "SNE V%01X (= 0x%02X), 0x%02X.", Register_Index_X, Interpreter_Registers_V[Register_Index_X], Operand);
+}
 
-						// Use the value provided by Vy if asked to
-						if (Interpreter_Is_Shift_Using_Vy_Enabled)
-						{
-							Register_Index_2 = (Instruction_Low_Byte >> 4) & 0x0F; // Vy
-							Value = Interpreter_Registers_V[Register_Index_2];
-							LOG(INTERPRETER_IS_LOGGING_ENABLED, "SHL V%01X (= 0x%02X), V%01X = (0x%02X).", Register_Index_1, Interpreter_Registers_V[Register_Index_1], Register_Index_2, Value);
-						}
-						else
-						{
-							// Retrieve the Vx value
-							Value = Interpreter_Registers_V[Register_Index_1];
-							LOG(INTERPRETER_IS_LOGGING_ENABLED, "SHL V%01X (= 0x%02X).", Register_Index_1, Value);
-						}
+/** Execute the SE Vx, Vy instruction (5xy0). */
+static void InterpreterExecuteSeVxVy(unsigned char Register_Index_X, unsigned char Register_Index_Y, unsigned short Operand)
+{
+	// Skip the next instruction if Vx is equal to Vy
+	if (Interpreter_Registers_V[Register_Index_X] == Interpreter_Registers_V[Register_Index_Y]) INTERPRETER_SKIP_NEXT_INSTRUCTION();
+	LOG(INTERPRETER_IS_LOGGING_ENABLED, "SE V%01X (= 0x%02X), V%01X (= 0x%02X).", Register_Index_X, Interpreter_Registers_V[Register_Index_X], Register_Index_Y, Interpreter_Registers_V[Register_Index_Y]);
+}
 
-						if (Value & 0x80) Is_Bit_Shifted_Out = 1; // Set VF if the Vx most significant bit is set
-						else Is_Bit_Shifted_Out = 0;
-						Value <<= 1;
-						Interpreter_Registers_V[Register_Index_1] = Value;
+/** Execute the SAVE Vx - Vy instruction (5xy2). Store the registers Vx to Vy to the memory pointed by I, in reverse order if x is greater than y, without changing I. */
+static void InterpreterExecuteSaveVxVy(unsigned char Register_Index_X, unsigned char Register_Index_Y, unsigned short Operand)
+{
+	unsigned short Address;
+	unsigned char Registers_Count;
+	signed char Register_Index_Increment;
 
-						// Set VF at the end, in case VF was the output register just before
-						Interpreter_Registers_V[15] = Is_Bit_Shifted_Out;
-						break;
-					}
+	LOG(INTERPRETER_IS_LOGGING_ENABLED, "SAVE V%01X - V%01X with I = 0x%03X.", Register_Index_X, Register_Index_Y, Interpreter_Register_I);
 
-					default:
-						goto Invalid_Instruction;
-				}
-				break;
-			}
+	// Find the registers order
+	if (Register_Index_X <= Register_Index_Y)
+	{
+		Registers_Count = Register_Index_Y - Register_Index_X + 1;
+		Register_Index_Increment = 1;
+	}
+	else
+	{
+		Registers_Count = Register_Index_X - Register_Index_Y + 1;
+		Register_Index_Increment = -1;
+	}
 
-			// SNE Vx, Vy
-			case 0x90:
-			{
-				unsigned char Register_Index_1, Register_Index_2, Register_Value_1, Register_Value_2;
+	// Store the registers, making sure to prevent any interpreter memory access overflow
+	Address = Interpreter_Register_I & 0x0FFF;
+	while (Registers_Count > 0)
+	{
+		Shared_Buffers.Interpreter_Memory[Address] = Interpreter_Registers_V[Register_Index_X];
+		INTERPRETER_DECODE_CACHE_INVALIDATE(Address); // The program may be modifying its own code
+		Address = (Address + 1) & 0x0FFF;
+		Register_Index_X += Register_Index_Increment;
+		Registers_Count--;
+	}
+}
 
-				// Extract the operands
-				Register_Index_1 = Instruction_High_Byte & 0x0F;
-				Register_Index_2 = (Instruction_Low_Byte >> 4) & 0x0F;
+/** Execute the LOAD Vx - Vy instruction (5xy3). Load the registers Vx to Vy from the memory pointed by I, in reverse order if x is greater than y, without changing I. */
+static void InterpreterExecuteLoadVxVy(unsigned char Register_Index_X, unsigned char Register_Index_Y, unsigned short Operand)
+{
+	unsigned short Address;
+	unsigned char Registers_Count;
+	signed char Register_Index_Increment;
 
-				if (Interpreter_Registers_V[Register_Index_1] != Interpreter_Registers_V[Register_Index_2]) Interpreter_Register_PC += 2;
-				LOG(INTERPRETER_IS_LOGGING_ENABLED, "SNE V%01X (= 0x%02X), V%01X (= 0x%02X).", Register_Index_1, Interpreter_Registers_V[Register_Index_1], Register_Index_2, Interpreter_Registers_V[Register_Index_2]);
-				break;
-			}
+	LOG(INTERPRETER_IS_LOGGING_ENABLED, "LOAD V%01X - V%01X with I = 0x%03X.", Register_Index_X, Register_Index_Y, Interpreter_Register_I);
 
-			// LD I, addr
-			case 0xA0:
-				Interpreter_Register_I = (unsigned short) (Instruction_High_Byte & 0x0F) << 8;
-				Interpreter_Register_I |= Instruction_Low_Byte;
-				LOG(INTERPRETER_IS_LOGGING_ENABLED, "LD I, 0x%03X.", Interpreter_Register_I);
-				break;
+	// Find the registers order
+	if (Register_Index_X <= Register_Index_Y)
+	{
+		Registers_Count = Register_Index_Y - Register_Index_X + 1;
+		Register_Index_Increment = 1;
+	}
+	else
+	{
+		Registers_Count = Register_Index_X - Register_Index_Y + 1;
+		Register_Index_Increment = -1;
+	}
 
-			// JP V0, nnn
-			case 0xB0:
-			{
-				unsigned short Address;
+	// Load the registers, making sure to prevent any interpreter memory access overflow
+	Address = Interpreter_Register_I & 0x0FFF;
+	while (Registers_Count > 0)
+	{
+		Interpreter_Registers_V[Register_Index_X] = Shared_Buffers.Interpreter_Memory[Address];
+		Address = (Address + 1) & 0x0FFF;
+		Register_Index_X += Register_Index_Increment;
+		Registers_Count--;
+	}
+}
 
-				// Extract the operands
-				Address = (unsigned short) (Instruction_High_Byte & 0x0F) << 8;
-				Address |= Instruction_Low_Byte;
+/** Execute the LD Vx, byte instruction (6xkk). */
+static void InterpreterExecuteLdVxByte(unsigned char Register_Index_X, unsigned char Register_Index_Y, unsigned short Operand)
+{
+	Interpreter_Registers_V[Register_Index_X] = (unsigned char) Operand;
+	LOG(INTERPRETER_IS_LOGGING_ENABLED, "LD V%01X, 0x%02X.", Register_Index_X, Operand);
+}
 
-				LOG(INTERPRETER_IS_LOGGING_ENABLED, "JP V0 (= 0x%02X), 0x%03X with PC = 0x%03X.", Interpreter_Registers_V[0], Address, Interpreter_Register_PC);
-				Interpreter_Register_PC = Interpreter_Registers_V[0] + Address;
-				Interpreter_Register_PC &= 0x0FFF; // Make sure the address does not cross the 4KB boundary
-				goto Next_Instruction; // Bypass PC incrementation
-			}
+/** Execute the ADD Vx, byte instruction (7xkk). */
+static void InterpreterExecuteAddVxByte(unsigned char Register_Index_X, unsigned char Register_Index_Y, unsigned short Operand)
+{
+	Interpreter_Registers_V[Register_Index_X] += (unsigned char) Operand;
+	LOG(INTERPRETER_IS_LOGGING_ENABLED, "ADD V%01X, 0x%02X.", Register_Index_X, Operand);
+}
 
-			// RND Vx, byte
-			case 0xC0:
-			{
-				unsigned char Register_Index, Is_Least_Significant_Bit_Set;
+/** Execute the LD Vx, Vy instruction (8xy0). */
+static void InterpreterExecuteLdVxVy(unsigned char Register_Index_X, unsigned char Register_Index_Y, unsigned short Operand)
+{
+	Interpreter_Registers_V[Register_Index_X] = Interpreter_Registers_V[Register_Index_Y];
+	LOG(INTERPRETER_IS_LOGGING_ENABLED, "LD V%01X, V%01X (= 0x%02X).", Register_Index_X, Register_Index_Y, Interpreter_Registers_V[Register_Index_Y]);
+}
 
-				// Extract the operands
-				Register_Index = Instruction_High_Byte & 0x0F;
-				LOG(INTERPRETER_IS_LOGGING_ENABLED, "RND V%01X, 0x%02X.", Register_Index, Instruction_Low_Byte);
+/** Execute the OR Vx, Vy instruction (8xy1), the handlers are generated for all quirk values. */
+INTERPRETER_GENERATE_BITWISE_OPERATION_HANDLER(InterpreterExecuteOrVxVy, "OR", |=, Interpreter_Is_VF_Reset_Enabled)
+#if INTERPRETER_IS_QUIRK_SPECIALIZATION_ENABLED == 1
+	INTERPRETER_GENERATE_BITWISE_OPERATION_HANDLER(InterpreterExecuteOrVxVyWithoutVFReset, "OR", |=, 0)
+	INTERPRETER_GENERATE_BITWISE_OPERATION_HANDLER(InterpreterExecuteOrVxVyWithVFReset, "OR", |=, 1)
+#endif
+
+/** Execute the AND Vx, Vy instruction (8xy2), the handlers are generated for all quirk values. */
+INTERPRETER_GENERATE_BITWISE_OPERATION_HANDLER(InterpreterExecuteAndVxVy, "AND", &=, Interpreter_Is_VF_Reset_Enabled)
+#if INTERPRETER_IS_QUIRK_SPECIALIZATION_ENABLED == 1
+	INTERPRETER_GENERATE_BITWISE_OPERATION_HANDLER(InterpreterExecuteAndVxVyWithoutVFReset, "AND", &=, 0)
+	INTERPRETER_GENERATE_BITWISE_OPERATION_HANDLER(InterpreterExecuteAndVxVyWithVFReset, "AND", &=, 1)
+#endif
+
+/** Execute the XOR Vx, Vy instruction (8xy3), the handlers are generated for all quirk values. */
+INTERPRETER_GENERATE_BITWISE_OPERATION_HANDLER(InterpreterExecuteXorVxVy, "XOR", ^=, Interpreter_Is_VF_Reset_Enabled)
+#if INTERPRETER_IS_QUIRK_SPECIALIZATION_ENABLED == 1
+	INTERPRETER_GENERATE_BITWISE_OPERATION_HANDLER(InterpreterExecuteXorVxVyWithoutVFReset, "XOR", ^=, 0)
+	INTERPRETER_GENERATE_BITWISE_OPERATION_HANDLER(InterpreterExecuteXorVxVyWithVFReset, "XOR", ^=, 1)
+#endif
+
+/** Execute the ADD Vx, Vy instruction (8xy4). */
+static void InterpreterExecuteAddVxVy(unsigned char Register_Index_X, unsigned char Register_Index_Y, unsigned short Operand)
+{
+	unsigned short Sum;
 
-				// Use a 8-bit Galois LFSR to generate good pseudo-random numbers (see https://en.wikipedia.org/wiki/Linear-feedback_shift_register#Galois_LFSRs)
-				if (Interpreter_Random_Seed & 0x01) Is_Least_Significant_Bit_Set = 1;
-				else Is_Least_Significant_Bit_Set = 0;
-				Interpreter_Random_Seed >>= 1;
-				if (Is_Least_Significant_Bit_Set) Interpreter_Random_Seed ^= 0xB4;
+	Sum = Interpreter_Registers_V[Register_Index_X] + Interpreter_Registers_V[Register_Index_Y]; // Compute the operation on a 16-bit variable to be able to detect an overflow
+	LOG(INTERPRETER_IS_LOGGING_ENABLED, "ADD V%01X (= 0x%02X), V%01X (= 0x%02X).", Register_Index_X, Interpreter_Registers_V[Register_Index_X], Register_Index_Y, Interpreter_Registers_V[Register_Index_Y]);
+	Interpreter_Registers_V[Register_Index_X] = (unsigned char) Sum;
 
-				// The random byte is ANDed with a mask provided in the instruction
-				Interpreter_Registers_V[Register_Index] = Interpreter_Random_Seed & Instruction_Low_Byte;
-				break;
-			}
+	// Set VF register if carry is set
+	if (Sum & 0x0100) Interpreter_Registers_V[15] = 1;
+	else Interpreter_Registers_V[15] = 0;
+}
 
-			// DRW Vx, Vy, nibble
-			case 0xD0:
-			{
-				unsigned char Register_Index_1, Register_Index_2, *Pointer_Sprite, *Pointer_Display, *Pointer_Display_Left_Over_Pixels, Sprite_Size, Shift_Offset, Row, Sprite_Row, Sprite_Column, Sprite_Byte, Columns_Count_Byte, Is_Collision_Detected = 0, Sprite_Horizontal_Bytes_Count;
+/** Execute the SUB Vx, Vy instruction (8xy5). */
+static void InterpreterExecuteSubVxVy(unsigned char Register_Index_X, unsigned char Register_Index_Y, unsigned short Operand)
+{
+	unsigned char Register_Value_1, Register_Value_2;
 
-				// Extract the operands
-				Register_Index_1 = Instruction_High_Byte & 0x0F;
-				Register_Index_2 = (Instruction_Low_Byte >> 4) & 0x0F;
-				Sprite_Size = Instruction_Low_Byte & 0x0F;
-				LOG(INTERPRETER_IS_LOGGING_ENABLED, "DRW V%01X (= 0x%02X), V%01X (= 0x%02X), %d with I = 0x%03X.", Register_Index_1, Interpreter_Registers_V[Register_Index_1], Register_Index_2, Interpreter_Registers_V[Register_Index_2], Sprite_Size, Interpreter_Register_I);
+	Register_Value_1 = Interpreter_Registers_V[Register_Index_X];
+	Register_Value_2 = Interpreter_Registers_V[Register_Index_Y];
+	Interpreter_Registers_V[Register_Index_X] -= Register_Value_2;
+	LOG(INTERPRETER_IS_LOGGING_ENABLED, "SUB V%01X (= 0x%02X), V%01X (= 0x%02X).", Register_Index_X, Register_Value_1, Register_Index_Y, Register_Value_2);
 
-				// Retrieve the sprite displaying coordinates
-				Sprite_Column = Interpreter_Registers_V[Register_Index_1];
-				Sprite_Row = Interpreter_Registers_V[Register_Index_2];
+	// Set VF register if borrow is clear
+	if (Register_Value_1 >= Register_Value_2) Interpreter_Registers_V[15] = 1;
+	else Interpreter_Registers_V[15] = 0;
+}
 
-				if (Is_High_Resolution_Enabled)
-				{
-					Sprite_Column &= INTERPRETER_DISPLAY_COLUMNS_COUNT_SUPER_CHIP_8 - 1;
-					Sprite_Row &= INTERPRETER_DISPLAY_ROWS_COUNT_SUPER_CHIP_8 - 1;
-				}
-				else
-				{
-					Sprite_Column &= INTERPRETER_DISPLAY_COLUMNS_COUNT_CHIP_8 - 1;
-					Sprite_Row &= INTERPRETER_DISPLAY_ROWS_COUNT_CHIP_8 - 1;
-				}
-				Pointer_Sprite = &Shared_Buffers.Interpreter_Memory[Interpreter_Register_I];
+/** Execute the SHR Vx, Vy instruction (8xy6), the handlers are generated for all quirk values. */
+INTERPRETER_GENERATE_SHIFT_HANDLER(InterpreterExecuteShrVxVy, "SHR", 0x01, >>=, Interpreter_Is_Shift_Using_Vy_Enabled)
+#if INTERPRETER_IS_QUIRK_SPECIALIZATION_ENABLED == 1
+	INTERPRETER_GENERATE_SHIFT_HANDLER(InterpreterExecuteShrVxVyUsingVx, "SHR", 0x01, >>=, 0)
+	INTERPRETER_GENERATE_SHIFT_HANDLER(InterpreterExecuteShrVxVyUsingVy, "SHR", 0x01, >>=, 1)
+#endif
 
-				// Determine the amount of bits the sprite must be shifted (in case it would not fit entirely in a frame buffer byte)
-				Shift_Offset = Sprite_Column & 0x07;
-				Columns_Count_Byte = Display_Columns_Count / 8; // Cache the amount of columns in bytes (instead of pixels)
-				Sprite_Column /= 8; // A byte stores 8 horizontal pixels, so cache the column coordinate converted to bytes instead of pixels
-				Row = Sprite_Row;
+/** Execute the SUBN Vx, Vy instruction (8xy7). */
+static void InterpreterExecuteSubnVxVy(unsigned char Register_Index_X, unsigned char Register_Index_Y, unsigned short Operand)
+{
+	unsigned char Register_Value_1, Register_Value_2;
 
-				// Find the location in the frame buffer where to draw the sprite
-				Pointer_Display = &Shared_Buffer_Display[(Row * Columns_Count_Byte) + Sprite_Column];
+	Register_Value_1 = Interpreter_Registers_V[Register_Index_X];
+	Register_Value_2 = Interpreter_Registers_V[Register_Index_Y];
+	Interpreter_Registers_V[Register_Index_X] = Register_Value_2 - Register_Value_1;
+	LOG(INTERPRETER_IS_LOGGING_ENABLED, "SUBN V%01X (= 0x%02X), V%01X (= 0x%02X).", Register_Index_X, Register_Value_1, Register_Index_Y, Register_Value_2);
 
-				// Handle the special case of a 16x16 pixels sprite
-				if (Sprite_Size == 0)
-				{
-					Sprite_Size = 16;
-					Sprite_Horizontal_Bytes_Count = 2;
-				}
-				else Sprite_Horizontal_Bytes_Count = 1;
+	// Set VF register if borrow is clear
+	if (Register_Value_2 >= Register_Value_1) Interpreter_Registers_V[15] = 1;
+	else Interpreter_Registers_V[15] = 0;
+}
 
-				// Render the sprite
-				while (Sprite_Size > 0) // The Sprite_Size value has already been checked and can't be invalid
-				{
-					// Cache the sprite data
-					Sprite_Byte = *Pointer_Sprite;
+/** Execute the SHL Vx, Vy instruction (8xyE), the handlers are generated for all quirk values. */
+INTERPRETER_GENERATE_SHIFT_HANDLER(InterpreterExecuteShlVxVy, "SHL", 0x80, <<=, Interpreter_Is_Shift_Using_Vy_Enabled)
+#if INTERPRETER_IS_QUIRK_SPECIALIZATION_ENABLED == 1
+	INTERPRETER_GENERATE_SHIFT_HANDLER(InterpreterExecuteShlVxVyUsingVx, "SHL", 0x80, <<=, 0)
+	INTERPRETER_GENERATE_SHIFT_HANDLER(InterpreterExecuteShlVxVyUsingVy, "SHL", 0x80, <<=, 1)
+#endif
 
-					// Directly display the sprite bytes if they are aligned with a frame buffer byte
-					if (Shift_Offset == 0)
-					{
-						// The first byte is always displayed
-						INTERPRETER_RENDER_SPRITE_BYTE(Pointer_Display, Sprite_Byte, Is_Collision_Detected);
+/** Execute the SNE Vx, Vy instruction (9xy0). */
+static void InterpreterExecuteSneVxVy(unsigned char Register_Index_X, unsigned char Register_Index_Y, unsigned short Operand)
+{
+	if (Interpreter_Registers_V[Register_Index_X] != Interpreter_Registers_V[Register_Index_Y]) INTERPRETER_SKIP_NEXT_INSTRUCTION();
+	LOG(INTERPRETER_IS_LOGGING_ENABLED, "SNE V%01X (= 0x%02X), V%01X (= 0x%02X).", Register_Index_X, Interpreter_Registers_V[Register_Index_X], Register_Index_Y, Interpreter_Registers_V[Register_Index_Y]);
+}
 
-						// The second byte is displayed only for a 16x16 pixels sprite
-						if (Sprite_Horizontal_Bytes_Count > 1)
-						{
-							// Always update the sprite pointer to avoid desynchronizing the sprite displaying
-							Pointer_Sprite++;
-
-							// Display the sprite second byte only if it does not cross the display edge (TODO support screen wrapping if needed)
-							if (Sprite_Column < (Columns_Count_Byte - 2))
-							{
-								// Write to the rightmost byte location
-								Pointer_Display_Left_Over_Pixels = Pointer_Display + 1; // Use another pointer to avoid modifying the value of Pointer_Display, which will be updated later in the loop
-								Sprite_Byte = *Pointer_Sprite;
-								INTERPRETER_RENDER_SPRITE_BYTE(Pointer_Display_Left_Over_Pixels, Sprite_Byte, Is_Collision_Detected);
-							}
-						}
-					}
-					// The sprite is not aligned, draw a part on the first frame buffer byte, and draw the remaining part on the following frame buffer byte
-					else
-					{
-						// Render the first part of the sprite
-						INTERPRETER_RENDER_SPRITE_BYTE(Pointer_Display, Sprite_Byte >> Shift_Offset, Is_Collision_Detected);
+/** Execute the LD I, addr instruction (Annn). */
+static void InterpreterExecuteLdIAddress(unsigned char Register_Index_X, unsigned char Register_Index_Y, unsigned short Operand)
+{
+	Interpreter_Register_I = Operand;
+	LOG(INTERPRETER_IS_LOGGING_ENABLED, "LD I, 0x%03X.", Interpreter_Register_I);
+}
 
-						// If the right side of the display is reached, the left over pixels must wrap around the left side of the display
-						if (Sprite_Column >= (Columns_Count_Byte - 1))
-						{
-							if (Interpreter_Is_Display_Wrapping_Enabled && (Sprite_Horizontal_Bytes_Count == 1)) Pointer_Display_Left_Over_Pixels = Pointer_Display - (Columns_Count_Byte - 1); // TODO support screen wrapping if needed
-							// Discard the right part of the sprite if the clipping mode is enabled
-							else
-							{
-								// Bypass the 16x16 sprite second byte if the first one was already clipped
-								if (Sprite_Horizontal_Bytes_Count > 1) Pointer_Sprite++;
-								goto Next_Line;
-							}
-						}
-						// Otherwise, just render the left over pixels to the following byte location
-						else Pointer_Display_Left_Over_Pixels = Pointer_Display + 1;
-						INTERPRETER_RENDER_SPRITE_BYTE(Pointer_Display_Left_Over_Pixels, Sprite_Byte << (8 - Shift_Offset), Is_Collision_Detected);
+/** Execute the JP V0, nnn instruction (Bnnn). */
+static void InterpreterExecuteJpV0Address(unsigned char Register_Index_X, unsigned char Register_Index_Y, unsigned short Operand)
+{
+	LOG(INTERPRETER_IS_LOGGING_ENABLED, "JP V0 (= 0x%02X), 0x%03X with PC = 0x%03X.", Interpreter_Registers_V[0], Operand, Interpreter_Register_PC - 2);
+	Interpreter_Register_PC = Interpreter_Registers_V[0] + Operand;
+	Interpreter_Register_PC &= 0x0FFF; // Make sure the address does not cross the 4KB boundary
+}
 
-						// If this is a 16x16 sprite, prepare to display the second byte (this is not really efficient because the byte that has just be written needs to be read and XORed again, but this makes the algorithm simpler and this is fast enough for now
-						if (Sprite_Horizontal_Bytes_Count > 1)
-						{
-							// Render the first part of the sprite second byte (this is always possible to render this byte, the display right limit has already been checked in the previous step)
-							Pointer_Sprite++; // Point to the sprite second byte
-							Sprite_Byte = *Pointer_Sprite;
-							INTERPRETER_RENDER_SPRITE_BYTE(Pointer_Display_Left_Over_Pixels, Sprite_Byte >> Shift_Offset, Is_Collision_Detected);
+/** Execute the RND Vx, byte instruction (Cxkk). */
+static void InterpreterExecuteRndVxByte(unsigned char Register_Index_X, unsigned char Register_Index_Y, unsigned short Operand)
+{
+	unsigned char Is_Least_Significant_Bit_Set;
 
-							// Discard the second part of the sprite second byte if the clipping mode is enabled (TODO support wrapping if needed)
-							if ((Sprite_Column + 1) > (Columns_Count_Byte - 1)) goto Next_Line;
+	LOG(INTERPRETER_IS_LOGGING_ENABLED, "RND V%01X, 0x%02X.", Register_Index_X, Operand);
 
-							// Render the second part of the sprite second byte
-							Pointer_Display_Left_Over_Pixels++;
-							INTERPRETER_RENDER_SPRITE_BYTE(Pointer_Display_Left_Over_Pixels, Sprite_Byte << (8 - Shift_Offset), Is_Collision_Detected);
-						}
-					}
+	// Use a 8-bit Galois LFSR to generate good pseudo-random numbers (see https://en.wikipedia.org/wiki/Linear-feedback_shift_register#Galois_LFSRs)
+	if (Interpreter_Random_Seed & 0x01) Is_Least_Significant_Bit_Set = 1;
+	else Is_Least_Significant_Bit_Set = 0;
+	Interpreter_Random_Seed >>= 1;
+	if (Is_Least_Significant_Bit_Set) Interpreter_Random_Seed ^= 0xB4;
 
-				Next_Line:
-					// Draw the next sprite line
-					Pointer_Sprite++;
-					Sprite_Size--;
+	// The random byte is ANDed with a mask provided in the instruction
+	Interpreter_Registers_V[Register_Index_X] = Interpreter_Random_Seed & (unsigned char) Operand;
+}
 
-					// If the bottom side of the display is reached, the sprite must wrap over the top of the display
-					Row++;
-					if (Row >= Display_Rows_Count)
-					{
-						// Stop rendering the sprite if the clipping mode is enabled
-						if (!Interpreter_Is_Display_Wrapping_Enabled) break;
+/** Retrieve the data of a sprite.
+ * @param Address The sprite address, it is usually the I register value.
+ * @param Size The sprite size in bytes.
+ * @param Pointer_Buffer A INTERPRETER_SPRITE_MAXIMUM_SIZE bytes buffer that receives the sprite when it crosses the interpreter memory end.
+ * @return The sprite data, the sprite bytes wrap around the interpreter memory end like the LD [I], Vx and LD Vx, [I] instructions ones.
+ */
+static unsigned char *InterpreterGetSpriteData(unsigned short Address, unsigned char Size, unsigned char *Pointer_Buffer)
+{
+	unsigned char i;
 
-						Row = 0;
-						// Subtract all rows but the last one, keeping only the "column" component of the display address
-						Pointer_Display -= (Display_Rows_Count - 1) * Columns_Count_Byte;
-					}
-					// Go to the next line
-					else Pointer_Display += Columns_Count_Byte;
-				}
+	// Most sprites are entirely located in the interpreter memory, read them in place
+	Address &= 0x0FFF; // The ADD I, Vx instruction does not keep I in the memory bounds
+	if (Address + Size <= INTERPRETER_MEMORY_SIZE) return &Shared_Buffers.Interpreter_Memory[Address];
 
-				// The frame buffer must be transferred to the display at 60Hz
-				if (Interpreter_Is_Fast_Rendering_Enabled) Is_Rendering_Needed = 1; // This variable will never be set if Interpreter_Is_Fast_Rendering_Enabled is false
-				// Transfer the frame buffer at each DRW call because some games use this as a delay
-				else
-				{
-					if (Is_High_Resolution_Enabled) DisplayDrawFullSizeBuffer(Shared_Buffer_Display);
-					else DisplayDrawHalfSizeBuffer(Shared_Buffer_Display);
-				}
+	// Do not read past the interpreter memory end
+	for (i = 0; i < Size; i++)
+	{
+		Pointer_Buffer[i] = Shared_Buffers.Interpreter_Memory[Address];
+		Address = (Address + 1) & 0x0FFF;
+	}
+	return Pointer_Buffer;
+}
 
-				// Set register VF if at least one already lighted pixel has been turned off
-				Interpreter_Registers_V[15] = Is_Collision_Detected;
-				break;
-			}
+/** Find which frame buffer pages and columns a sprite covers.
+ * @param Sprite_Column The sprite left column in pixels, it is in the display bounds.
+ * @param Sprite_Row The frame buffer row receiving the sprite top, it is in the display bounds.
+ * @param Sprite_Width The sprite width in pixels (8 or 16).
+ * @param Sprite_Size How many sprite rows are drawn, the rows discarded by the clipping mode are not counted.
+ * @param Is_Display_Wrapping_Enabled Set to 1 to draw the pixels crossing the display right edge to the opposite side, set to 0 to discard them.
+ * @param Pointer_Layout On output, contain the sprite layout.
+ */
+static void InterpreterPrepareSpriteLayout(unsigned char Sprite_Column, unsigned char Sprite_Row, unsigned char Sprite_Width, unsigned char Sprite_Size, unsigned char Is_Display_Wrapping_Enabled, TInterpreterSpriteLayout *Pointer_Layout)
+{
+	unsigned char Columns_Count, Pages_Count, Page, Right_Columns_Count;
+
+	Columns_Count = Interpreter_Display_Columns_Count;
+	Pages_Count = Interpreter_Display_Rows_Count / 8; // A byte stores 8 vertical pixels
+	Page = Sprite_Row / 8;
+	Pointer_Layout->Columns_Count = Columns_Count;
+	Pointer_Layout->Pages_Count = Pages_Count;
+	Pointer_Layout->Column = Sprite_Column;
+	Pointer_Layout->Page = Page;
+	Pointer_Layout->Row_Shift = Sprite_Row & 0x07;
+
+	// An unaligned sprite covers one more page than its aligned version
+	Pointer_Layout->Sprite_Pages_Count = (Pointer_Layout->Row_Shift + Sprite_Size + 7) / 8;
+
+	// The first column is always in the display, the following ones may cross the display right edge
+	Right_Columns_Count = Columns_Count - Sprite_Column;
+	if (Right_Columns_Count > Sprite_Width) Right_Columns_Count = Sprite_Width;
+	Pointer_Layout->Right_Columns_Count = Right_Columns_Count;
+	if (Is_Display_Wrapping_Enabled) Pointer_Layout->Left_Columns_Count = Sprite_Width - Right_Columns_Count;
+	else Pointer_Layout->Left_Columns_Count = 0;
+}
 
-			case 0xE0:
-			{
-				unsigned char Register_Index, Key_Code, Key_Mask, Is_Key_Pressed;
+/** Convert the rows of a small 8-pixel wide sprite to the frame buffer page layout, pixel by pixel.
+ * @param Pointer_Sprite The sprite rows data.
+ * @param Sprite_Size How many rows the sprite has, it must not exceed INTERPRETER_SPRITE_SMALL_MAXIMUM_ROWS_COUNT.
+ * @param Row_Shift How many pixels the sprite top is below the page top.
+ * @param Pointer_Sprite_Columns On output, contain the sprite columns in the first two strips (see InterpreterTransposeSprite()).
+ */
+static void InterpreterTransposeSmallSprite(unsigned char *Pointer_Sprite, unsigned char Sprite_Size, unsigned char Row_Shift, unsigned char *Pointer_Sprite_Columns)
+{
+	unsigned char *Pointer_Strip, *Pointer_Column, Row_Mask, Sprite_Byte;
 
-				// Retrieve whether the expected key is pressed, this is common to all 0xExxx instructions
-				Register_Index = Instruction_High_Byte & 0x0F; // Retrieve the register containing the key code
-				Key_Code = Interpreter_Registers_V[Register_Index]; // Get the key code
-				Key_Mask = Interpreter_Keys_Table_From_Interpreter[Key_Code]; // Get the bit mask corresponding to the physical key switch
-				if (KeyboardReadKeysMask() & Key_Mask) Is_Key_Pressed = 1;
-				else Is_Key_Pressed = 0;
+	// A small sprite covers one or two pages
+	memset(Pointer_Sprite_Columns, 0, 8);
+	memset(Pointer_Sprite_Columns + INTERPRETER_SPRITE_MAXIMUM_COLUMNS_COUNT, 0, 8);
 
-				switch (Instruction_Low_Byte)
-				{
-					// SKP Vx
-					case 0x9E:
-						LOG(INTERPRETER_IS_LOGGING_ENABLED, "SKP V%01X (= 0x%02X), is key pressed = %u.", Register_Index, Key_Code, Is_Key_Pressed);
-						if (Is_Key_Pressed) Interpreter_Register_PC += 2;
-						break;
-
-					// SKNP Vx
-					case 0xA1:
-						LOG(INTERPRETER_IS_LOGGING_ENABLED, "SKNP V%01X (= 0x%02X), is key pressed = %u.", Register_Index, Key_Code, Is_Key_Pressed);
-						if (!Is_Key_Pressed) Interpreter_Register_PC += 2;
-						break;
-
-					default:
-						goto Invalid_Instruction;
-				}
-				break;
-			}
+	// The least significant bit of a frame buffer byte is the top pixel
+	Pointer_Strip = Pointer_Sprite_Columns;
+	Row_Mask = 1 << Row_Shift;
+	while (Sprite_Size > 0)
+	{
+		// The most significant bit of a sprite byte is the leftmost pixel, stop as soon as the remaining pixels are all off
+		Sprite_Byte = *Pointer_Sprite;
+		Pointer_Sprite++;
+		Pointer_Column = Pointer_Strip;
+		while (Sprite_Byte != 0)
+		{
+			if (Sprite_Byte & 0x80) *Pointer_Column |= Row_Mask;
+			Sprite_Byte <<= 1;
+			Pointer_Column++;
+		}
+
+		// Go to the next page strip when the current one is full
+		Row_Mask <<= 1;
+		if (Row_Mask == 0)
+		{
+			Row_Mask = 1;
+			Pointer_Strip += INTERPRETER_SPRITE_MAXIMUM_COLUMNS_COUNT;
+		}
+		Sprite_Size--;
+	}
+}
+
+/** Convert the sprite rows to the frame buffer page layout, each sprite column becomes one byte per covered page. The 8 sprite rows covering a page make a 8x8 bits matrix that is transposed at once (a 8-pixel wide sprite has one matrix per page, a 16x16 sprite has two), so an unaligned sprite is not shifted, its rows are only gathered from an offset row.
+ * @param Pointer_Sprite The sprite rows data.
+ * @param Sprite_Size How many rows the sprite has.
+ * @param Sprite_Bytes_Per_Row Set to 1 for a 8-pixel wide sprite, set to 2 for a 16x16 sprite.
+ * @param Row_Shift How many pixels the sprite top is below the page top.
+ * @param Pointer_Sprite_Columns On output, contain INTERPRETER_SPRITE_MAXIMUM_PAGES_COUNT strips of INTERPRETER_SPRITE_MAXIMUM_COLUMNS_COUNT bytes, a strip holding the sprite columns of a page. Only the strips and the columns covered by the sprite are written.
+ */
+static void InterpreterTransposeSprite(unsigned char *Pointer_Sprite, unsigned char Sprite_Size, unsigned char Sprite_Bytes_Per_Row, unsigned char Row_Shift, unsigned char *Pointer_Sprite_Columns)
+{
+	unsigned char *Pointer_Strip, Matrix[8], Pages_Count, Page_First_Row, Sprite_Row, Byte_Index, Sprite_Byte, Rows_Bits, i;
 
-			case 0xF0:
+	// A 16x16 sprite clipped by the display bottom edge may keep only a few rows, it is still transposed by matrices
+	if ((Sprite_Bytes_Per_Row == 1) && (Sprite_Size <= INTERPRETER_SPRITE_SMALL_MAXIMUM_ROWS_COUNT))
+	{
+		InterpreterTransposeSmallSprite(Pointer_Sprite, Sprite_Size, Row_Shift, Pointer_Sprite_Columns);
+		return;
+	}
+
+	// The first page top is above the sprite top, the row number wraps around so a single comparison discards the rows above the sprite and the rows below it
+	Page_First_Row = (unsigned char) -Row_Shift;
+	Pointer_Strip = Pointer_Sprite_Columns;
+	for (Pages_Count = (Row_Shift + Sprite_Size + 7) / 8; Pages_Count > 0; Pages_Count--)
+	{
+		for (Byte_Index = 0; Byte_Index < Sprite_Bytes_Per_Row; Byte_Index++)
+		{
+			// Load the page rows from the bottom one to the top one, so the transposed top pixel lands in the least significant bit
+			Rows_Bits = 0;
+			Sprite_Row = Page_First_Row;
+			for (i = 8; i > 0; i--)
 			{
-				switch (Instruction_Low_Byte)
-				{
-					// LD Vx, DT
-					case 0x07:
-					{
-						unsigned char Register_Index, Delay;
+				if (Sprite_Row < Sprite_Size) Sprite_Byte = Pointer_Sprite[Sprite_Row * Sprite_Bytes_Per_Row + Byte_Index];
+				else Sprite_Byte = 0;
+				Matrix[i - 1] = Sprite_Byte;
+				Rows_Bits |= Sprite_Byte;
+				Sprite_Row++;
+			}
 
-						// Extract the operands
-						Register_Index = Instruction_High_Byte & 0x0F;
+			// Many sprite parts are empty (the right half of a small 16x16 sprite, the transparent rows...), there is nothing to transpose
+			if (Rows_Bits != 0) DISPLAY_TRANSPOSE_BITS_MATRIX(Matrix);
+			memcpy(Pointer_Strip + Byte_Index * 8, Matrix, 8);
+		}
 
-						// Retrieve the timer value
-						if (T6CONbits.ON == 0) Delay = 0; // When the timer has overflowed, the counter register is reset and the ON bit is cleared
-						else Delay = T6PR - T6TMR; // The hardware timer is incrementing while the Chip-8 timer is expected to decrement
-						Interpreter_Registers_V[Register_Index] = Delay;
-						LOG(INTERPRETER_IS_LOGGING_ENABLED, "LD V%01X, DT (= 0x%02X).", Register_Index, Delay);
-						break;
-					}
+		Page_First_Row += 8;
+		Pointer_Strip += INTERPRETER_SPRITE_MAXIMUM_COLUMNS_COUNT;
+	}
+}
 
-					// LD Vx, K
-					case 0x0A:
-					{
-						unsigned char Register_Index, Key_Mask, i;
+/** Draw the columns of a transposed sprite to a display plane.
+ * @param Pointer_Layout The sprite layout.
+ * @param Pointer_Plane The plane frame buffer.
+ * @param Pointer_Sprite_Columns The sprite columns computed by InterpreterTransposeSprite().
+ * @return The pixels turned off by the sprite ORed together, the value is not zero if a collision occurred.
+ */
+static unsigned char InterpreterDrawSpriteColumns(const TInterpreterSpriteLayout *Pointer_Layout, unsigned char *Pointer_Plane, unsigned char *Pointer_Sprite_Columns)
+{
+	unsigned char *Pointer_Page, *Pointer_Display, *Pointer_Column, Page, Sprite_Pages_Count, Columns_Count, Collision_Bits = 0;
 
-						// Extract the operands
-						Register_Index = Instruction_High_Byte & 0x0F;
-						LOG(INTERPRETER_IS_LOGGING_ENABLED, "LD V%01X, K.", Register_Index);
+	Page = Pointer_Layout->Page;
+	for (Sprite_Pages_Count = Pointer_Layout->Sprite_Pages_Count; Sprite_Pages_Count > 0; Sprite_Pages_Count--)
+	{
+		// Send the covered columns at the next transfer, a sprite wrapping around the display right edge makes the whole page width change
+		if (Pointer_Layout->Left_Columns_Count == 0) InterpreterMarkPageChanged(Page, Pointer_Layout->Column, Pointer_Layout->Column + Pointer_Layout->Right_Columns_Count - 1);
+		else InterpreterMarkPageChanged(Page, 0, Pointer_Layout->Columns_Count - 1);
 
-						// Stop the execution until a key is pressed
-						do
-						{
-							// Exit when the menu key is pressed
-							if (KeyboardIsMenuKeyPressed()) goto Exit_Success;
+		Pointer_Page = Pointer_Plane + Page * Pointer_Layout->Columns_Count;
+		Pointer_Column = Pointer_Sprite_Columns;
 
-							// Also run the rendering loop in case a DRW instruction was issued just before calling this instruction, and the tick was not present (so the frame buffer could not be transferred to the display before blocking in this instruction)
-							if (Is_Rendering_Needed && NCO_IS_TICK_ELAPSED())
-							{
-								// Display the picture according to the emulation mode display
-								if (Is_High_Resolution_Enabled) DisplayDrawFullSizeBuffer(Shared_Buffer_Display);
-								else DisplayDrawHalfSizeBuffer(Shared_Buffer_Display);
+		// Draw the columns fitting before the display right edge, then the columns wrapping to the display left side
+		Pointer_Display = Pointer_Page + Pointer_Layout->Column;
+		for (Columns_Count = Pointer_Layout->Right_Columns_Count; Columns_Count > 0; Columns_Count--)
+		{
+			if (*Pointer_Column != 0) INTERPRETER_RENDER_SPRITE_BYTE(Pointer_Display, *Pointer_Column, Collision_Bits);
+			Pointer_Display++;
+			Pointer_Column++;
+		}
+		Pointer_Display = Pointer_Page;
+		for (Columns_Count = Pointer_Layout->Left_Columns_Count; Columns_Count > 0; Columns_Count--)
+		{
+			if (*Pointer_Column != 0) INTERPRETER_RENDER_SPRITE_BYTE(Pointer_Display, *Pointer_Column, Collision_Bits);
+			Pointer_Display++;
+			Pointer_Column++;
+		}
 
-								Is_Rendering_Needed = 0;
-								NCO_CLEAR_TICK_INTERRUPT_FLAG(); // The interrupt flag must be manually cleared
-							}
+		// The page following the display bottom one is the display top one (the pages crossing the display bottom edge are not counted if the clipping mode is enabled)
+		Pointer_Sprite_Columns += INTERPRETER_SPRITE_MAXIMUM_COLUMNS_COUNT;
+		Page++;
+		if (Page >= Pointer_Layout->Pages_Count) Page = 0;
+	}
 
-							Key_Mask = KeyboardReadKeysMask();
-						} while (Key_Mask == 0);
+	return Collision_Bits;
+}
 
-						// Wait for the key to be released
-						while (KeyboardReadKeysMask() != 0);
+/** Execute the DRW Vx, Vy, nibble instruction (Dxyn), the handlers are generated for all quirk values. */
+INTERPRETER_GENERATE_DRW_HANDLER(InterpreterExecuteDrwVxVyNibble, Interpreter_Is_Display_Wrapping_Enabled, Interpreter_Is_Fast_Rendering_Enabled)
+#if INTERPRETER_IS_QUIRK_SPECIALIZATION_ENABLED == 1
+	INTERPRETER_GENERATE_DRW_HANDLER(InterpreterExecuteDrwVxVyNibbleClippingDirectRendering, 0, 0)
+	INTERPRETER_GENERATE_DRW_HANDLER(InterpreterExecuteDrwVxVyNibbleClippingFastRendering, 0, 1)
+	INTERPRETER_GENERATE_DRW_HANDLER(InterpreterExecuteDrwVxVyNibbleWrappingDirectRendering, 1, 0)
+	INTERPRETER_GENERATE_DRW_HANDLER(InterpreterExecuteDrwVxVyNibbleWrappingFastRendering, 1, 1)
+#endif
+
+/** Execute the SKP Vx instruction (Ex9E). */
+static void InterpreterExecuteSkpVx(unsigned char Register_Index_X, unsigned char Register_Index_Y, unsigned short Operand)
+{
+	unsigned char Key_Code;
 
-						// Retrieve the corresponding Chip-8 key (the first one matching)
-						for (i = 0; i < 8; i++)
-						{
-							if ((1 << i) & Key_Mask)
-							{
-								Interpreter_Registers_V[Register_Index] = Interpreter_Keys_Table_From_Console[i];
-								break;
-							}
-						}
-						break;
-					}
+	Key_Code = Interpreter_Registers_V[Register_Index_X]; // Get the key code
+	LOG(INTERPRETER_IS_LOGGING_ENABLED, "SKP V%01X (= 0x%02X).", Register_Index_X, Key_Code);
+	if (InterpreterReadKeysMask() & Interpreter_Keys_Table_From_Interpreter[Key_Code]) INTERPRETER_SKIP_NEXT_INSTRUCTION(); // Get the bit mask corresponding to the physical key switch
+}
 
-					// LD DT, Vx
-					case 0x15:
-					{
-						unsigned char Register_Index, Delay;
+/** Execute the SKNP Vx instruction (ExA1). */
+static void InterpreterExecuteSknpVx(unsigned char Register_Index_X, unsigned char Register_Index_Y, unsigned short Operand)
+{
+	unsigned char Key_Code;
 
-						// Extract the operands
-						Register_Index = Instruction_High_Byte & 0x0F;
+	Key_Code = Interpreter_Registers_V[Register_Index_X]; // Get the key code
+	LOG(INTERPRETER_IS_LOGGING_ENABLED, "SKNP V%01X (= 0x%02X).", Register_Index_X, Key_Code);
+	if (!(InterpreterReadKeysMask() & Interpreter_Keys_Table_From_Interpreter[Key_Code])) INTERPRETER_SKIP_NEXT_INSTRUCTION(); // Get the bit mask corresponding to the physical key switch
+}
 
-						// Retrieve the register value
-						Delay = Interpreter_Registers_V[Register_Index];
-						LOG(INTERPRETER_IS_LOGGING_ENABLED, "LD DT, V%01X (= 0x%02X).", Register_Index, Delay);
+/** Execute the LD I, long address instruction (F000 nnnn). The decoder already extracted the address from the instruction second word. */
+static void InterpreterExecuteLdILongAddress(unsigned char Register_Index_X, unsigned char Register_Index_Y, unsigned short Operand)
+{
+	LOG(INTERPRETER_IS_LOGGING_ENABLED, "LD I, long 0x%03X.", Operand);
+	Interpreter_Register_I = Operand;
+	Interpreter_Register_PC += 2; // Skip the address word
+}
 
-						// Start the timer
-						T6CONbits.ON = 0; // Stop the timer in case it is already running
-						T6PR = Delay; // The timer will stop incrementing when the TMR register value will become equal to the PR register value
-						T6TMR = 0;
-						T6CONbits.ON = 1;
-						break;
-					}
+/** Execute the PLANE n instruction (Fn01). Select the display planes the drawing, scrolling and clearing instructions work on. */
+static void InterpreterExecutePlane(unsigned char Register_Index_X, unsigned char Register_Index_Y, unsigned short Operand)
+{
+	LOG(INTERPRETER_IS_LOGGING_ENABLED, "PLANE %u.", Register_Index_X);
+	Interpreter_Selected_Planes_Mask = Register_Index_X & 0x03;
+	// The second plane pixels are displayed from now on
+	if ((Interpreter_Selected_Planes_Mask & 0x02) && !Interpreter_Is_Second_Plane_Enabled)
+	{
+		Interpreter_Is_Second_Plane_Enabled = 1;
+		InterpreterMarkFrameBufferChanged();
+	}
+}
 
-					// LD ST, Vx
-					case 0x18:
-					{
-						unsigned char Register_Index;
+/** Execute the LD Vx, DT instruction (Fx07). */
+static void InterpreterExecuteLdVxDt(unsigned char Register_Index_X, unsigned char Register_Index_Y, unsigned short Operand)
+{
+	unsigned char Delay;
 
-						// Extract the operands
-						Register_Index = Instruction_High_Byte & 0x0F;
-						LOG(INTERPRETER_IS_LOGGING_ENABLED, "LD ST, V%01X (= 0x%02X).", Register_Index, Interpreter_Registers_V[Register_Index]);
+	// Retrieve the timer value
+	Delay = InterpreterPlatformGetDelayTimer();
+	Interpreter_Registers_V[Register_Index_X] = Delay;
+	LOG(INTERPRETER_IS_LOGGING_ENABLED, "LD V%01X, DT (= 0x%02X).", Register_Index_X, Delay);
+}
 
-						SoundPlay(Interpreter_Registers_V[Register_Index]);
-						break;
-					}
+/** Execute the LD Vx, K instruction (Fx0A). */
+static void InterpreterExecuteLdVxK(unsigned char Register_Index_X, unsigned char Register_Index_Y, unsigned short Operand)
+{
+	unsigned char Key_Mask, i;
 
-					// ADD I, Vx
-					case 0x1E:
-					{
-						unsigned char Register_Index;
+	LOG(INTERPRETER_IS_LOGGING_ENABLED, "LD V%01X, K.", Register_Index_X);
 
-						// Extract the operands
-						Register_Index = Instruction_High_Byte & 0x0F;
+	// Stop the execution until a key is pressed
+	do
+	{
+		// Exit when the menu key is pressed
+		if (InterpreterPlatformIsMenuKeyPressed())
+		{
+			Interpreter_Execution_State = INTERPRETER_EXECUTION_STATE_EXIT;
+			return;
+		}
 
-						// Sum the values
-						LOG(INTERPRETER_IS_LOGGING_ENABLED, "ADD I (= 0x%04X), V%01X (= 0x%02X).", Interpreter_Register_I, Register_Index, Interpreter_Registers_V[Register_Index]);
-						Interpreter_Register_I += Interpreter_Registers_V[Register_Index];
-						break;
-					}
+		// Also run the rendering loop in case a DRW instruction was issued just before calling this instruction, and the tick was not present (so the frame buffer could not be transferred to the display before blocking in this instruction)
+		if (Interpreter_Is_Rendering_Needed && InterpreterPlatformIsTickElapsed())
+		{
+			// Display the picture according to the emulation mode display
+			InterpreterDrawFrameBuffer();
 
-					// LD F, Vx
-					case 0x29:
-					{
-						unsigned char Register_Index, Digit;
+			Interpreter_Is_Rendering_Needed = 0;
+			InterpreterPlatformClearTick(); // The tick flag must be manually cleared
+		}
 
-						// Extract the operands
-						Register_Index = Instruction_High_Byte & 0x0F;
-						LOG(INTERPRETER_IS_LOGGING_ENABLED, "LD F, V%01X (= 0x%02X).", Register_Index, Interpreter_Registers_V[Register_Index]);
+		#if INTERPRETER_IS_INPUT_STREAM_ENABLED == 1
+			InterpreterInputStreamWaitForNextFrame();
+			if (Interpreter_Execution_State == INTERPRETER_EXECUTION_STATE_EXIT) return; // The replayed stream has ended
+		#endif
 
-						// Retrieve the digit value
-						Digit = Interpreter_Registers_V[Register_Index] & 0x0F; // The allowed digit values are 0 to 0xF
+		Key_Mask = InterpreterReadKeysMask();
+	} while (Key_Mask == 0);
 
-						// Each digit is stored on 5 bytes, and the first digit starts at the memory offset 0
-						Interpreter_Register_I = Digit * 5;
-						break;
-					}
+	// Wait for the key to be released, still allowing to exit (this also makes the time progress on the host runner)
+	while (InterpreterReadKeysMask() != 0)
+	{
+		if (InterpreterPlatformIsMenuKeyPressed())
+		{
+			Interpreter_Execution_State = INTERPRETER_EXECUTION_STATE_EXIT;
+			return;
+		}
 
-					// LD HF, Vx : load I with the large font sprite starting address precised by Vx
-					case 0x30:
-					{
-						unsigned char Register_Index, Digit;
+		#if INTERPRETER_IS_INPUT_STREAM_ENABLED == 1
+			InterpreterInputStreamWaitForNextFrame();
+			if (Interpreter_Execution_State == INTERPRETER_EXECUTION_STATE_EXIT) return;
+		#endif
+	}
 
-						// Extract the operands
-						Register_Index = Instruction_High_Byte & 0x0F;
-						LOG(INTERPRETER_IS_LOGGING_ENABLED, "LD HF, V%01X (= 0x%02X).", Register_Index, Interpreter_Registers_V[Register_Index]);
+	// Retrieve the corresponding Chip-8 key (the first one matching)
+	for (i = 0; i < 8; i++)
+	{
+		if ((1 << i) & Key_Mask)
+		{
+			Interpreter_Registers_V[Register_Index_X] = Interpreter_Keys_Table_From_Console[i];
+			break;
+		}
+	}
+}
 
-						// Retrieve the digit value
-						Digit = Interpreter_Registers_V[Register_Index] & 0x0F; // The allowed digit values are 0 to 0xF (assume Octo compatibility)
+/** Execute the LD DT, Vx instruction (Fx15). */
+static void InterpreterExecuteLdDtVx(unsigned char Register_Index_X, unsigned char Register_Index_Y, unsigned short Operand)
+{
+	unsigned char Delay;
 
-						// Each digit is stored on 10 bytes, and the first digit starts right after the last 5-bit digit
-						Interpreter_Register_I = (16 * 5) + (Digit * 10);
-						break;
-					}
+	// Retrieve the register value
+	Delay = Interpreter_Registers_V[Register_Index_X];
+	LOG(INTERPRETER_IS_LOGGING_ENABLED, "LD DT, V%01X (= 0x%02X).", Register_Index_X, Delay);
 
-					// LD B, Vx
-					case 0x33:
-					{
-						unsigned char Register_Index, Value, Digit, i, Divider;
-						unsigned short Register_I;
-
-						// Extract the operands
-						Register_Index = Instruction_High_Byte & 0x0F;
-						Value = Interpreter_Registers_V[Register_Index];
-						LOG(INTERPRETER_IS_LOGGING_ENABLED, "LD B, V%01X (= 0x%02X).", Register_Index, Value);
-						Register_I = Interpreter_Register_I & 0x0FFF; // The I register value must not be changed at the end of this instruction execution (also make sure to prevent any interpreter memory access overflow)
-
-						// Convert the and store it to the memory
-						Divider = 100;
-						for (i = 0; i < 3; i++)
-						{
-							// Extract the next digit
-							if (Value >= Divider)
-							{
-								Digit = Value / Divider;
-								Value -= Digit * Divider; // Subtract only the hundreds to the value
-							}
-							else Digit = 0;
-
-							// Store the value in the memory pointed by the I register, making sure to prevent any interpreter memory access overflow
-							Shared_Buffers.Interpreter_Memory[Register_I] = Digit;
-							Register_I = (Register_I + 1) & 0x0FFF;
-
-							// Extract next rank digit
-							Divider /= 10;
-						}
-						break;
-					}
+	// Start the timer
+	InterpreterPlatformSetDelayTimer(Delay);
+}
 
-					// LD [I], Vx
-					case 0x55:
-					{
-						unsigned char Last_Register_Index, i;
-						unsigned short Temporary_Register_I;
+/** Execute the LD ST, Vx instruction (Fx18). */
+static void InterpreterExecuteLdStVx(unsigned char Register_Index_X, unsigned char Register_Index_Y, unsigned short Operand)
+{
+	LOG(INTERPRETER_IS_LOGGING_ENABLED, "LD ST, V%01X (= 0x%02X).", Register_Index_X, Interpreter_Registers_V[Register_Index_X]);
+	InterpreterPlatformPlaySound(Interpreter_Registers_V[Register_Index_X]);
+}
 
-						// Extract the operands
-						Last_Register_Index = Instruction_High_Byte & 0x0F;
-						LOG(INTERPRETER_IS_LOGGING_ENABLED, "LD [I] (= 0x%03X), V%01X.", Interpreter_Register_I, Last_Register_Index);
+/** Execute the ADD I, Vx instruction (Fx1E). */
+static void InterpreterExecuteAddIVx(unsigned char Register_Index_X, unsigned char Register_Index_Y, unsigned short Operand)
+{
+	LOG(INTERPRETER_IS_LOGGING_ENABLED, "ADD I (= 0x%04X), V%01X (= 0x%02X).", Interpreter_Register_I, Register_Index_X, Interpreter_Registers_V[Register_Index_X]);
+	Interpreter_Register_I += Interpreter_Registers_V[Register_Index_X];
+}
 
-						// Store the requested amount of registers to the address pointed by the I register
-						Temporary_Register_I = Interpreter_Register_I;
-						for (i = 0; i <= Last_Register_Index; i++)
-						{
-							Shared_Buffers.Interpreter_Memory[Temporary_Register_I] = Interpreter_Registers_V[i];
-							Temporary_Register_I = (Temporary_Register_I + 1) & 0x0FFF; // Avoid overflowing the interpreter memory buffer
-						}
+/** Execute the LD F, Vx instruction (Fx29). */
+static void InterpreterExecuteLdFVx(unsigned char Register_Index_X, unsigned char Register_Index_Y, unsigned short Operand)
+{
+	LOG(INTERPRETER_IS_LOGGING_ENABLED, "LD F, V%01X (= 0x%02X).", Register_Index_X, Interpreter_Registers_V[Register_Index_X]);
+	// Each digit is stored on 5 bytes, and the first digit starts at the memory offset 0 (the allowed digit values are 0 to 0xF)
+	Interpreter_Register_I = (Interpreter_Registers_V[Register_Index_X] & 0x0F) * 5;
+}
 
-						// Increment the I register only for required games
-						if (Interpreter_Is_Memory_Load_Store_Increment_Enabled) Interpreter_Register_I = Temporary_Register_I;
-						break;
-					}
+/** Execute the LD HF, Vx instruction (Fx30). Load I with the large font sprite starting address precised by Vx. */
+static void InterpreterExecuteLdHfVx(unsigned char Register_Index_X, unsigned char Register_Index_Y, unsigned short Operand)
+{
+	LOG(INTERPRETER_IS_LOGGING_ENABLED, "LD HF, V%01X (= 0x%02X).", Register_Index_X, Interpreter_Registers_V[Register_Index_X]);
+	// Each digit is stored on 10 bytes, and the first digit starts right after the last 5-bit digit (the allowed digit values are 0 to 0xF, assume Octo compatibility)
+	Interpreter_Register_I = (16 * 5) + ((Interpreter_Registers_V[Register_Index_X] & 0x0F) * 10);
+}
 
-					// LD Vx, [I]
-					case 0x65:
-					{
-						unsigned char Last_Register_Index, i;
-						unsigned short Temporary_Register_I;
+/** Execute the LD B, Vx instruction (Fx33). */
+static void InterpreterExecuteLdBVx(unsigned char Register_Index_X, unsigned char Register_Index_Y, unsigned short Operand)
+{
+	unsigned char Value, Digit, i, Divider;
+	unsigned short Register_I;
 
-						// Extract the operands
-						Last_Register_Index = Instruction_High_Byte & 0x0F;
-						LOG(INTERPRETER_IS_LOGGING_ENABLED, "LD V%01X, [I] (= 0x%03X).", Last_Register_Index, Interpreter_Register_I);
+	// Extract the operands
+	Value = Interpreter_Registers_V[Register_Index_X];
+	LOG(INTERPRETER_IS_LOGGING_ENABLED, "LD B, V%01X (= 0x%02X).", Register_Index_X, Value);
+	Register_I = Interpreter_Register_I & 0x0FFF; // The I register value must not be changed at the end of this instruction execution (also make sure to prevent any interpreter memory access overflow)
 
-						// Store the requested amount of registers to the address pointed by the I register
-						Temporary_Register_I = Interpreter_Register_I;
-						for (i = 0; i <= Last_Register_Index; i++)
-						{
-							Interpreter_Registers_V[i] = Shared_Buffers.Interpreter_Memory[Temporary_Register_I];
-							Temporary_Register_I = (Temporary_Register_I + 1) & 0x0FFF; // Avoid overflowing the interpreter memory buffer
-						}
+	// Convert the and store it to the memory
+	Divider = 100;
+	for (i = 0; i < 3; i++)
+	{
+		// Extract the next digit
+		if (Value >= Divider)
+		{
+			Digit = Value / Divider;
+			Value -= Digit * Divider; // Subtract only the hundreds to the value
+		}
+		else Digit = 0;
 
-						// Increment the I register only for required games
-						if (Interpreter_Is_Memory_Load_Store_Increment_Enabled) Interpreter_Register_I = Temporary_Register_I;
-						break;
-					}
+		// Store the value in the memory pointed by the I register, making sure to prevent any interpreter memory access overflow
+		Shared_Buffers.Interpreter_Memory[Register_I] = Digit;
+		INTERPRETER_DECODE_CACHE_INVALIDATE(Register_I); // The program may be modifying its own code
+		Register_I = (Register_I + 1) & 0x0FFF;
 
-					// LD R, Vx
-					case 0x75:
-					{
-						unsigned char Register_Index, Value;
+		// Extract next rank digit
+		Divider /= 10;
+	}
+}
 
-						// Extract the operands
-						Register_Index = Instruction_High_Byte & 0x0F;
-						if (Register_Index >= INTERPRETER_FLAG_REGISTERS_COUNT) goto Invalid_Instruction; // Only indexes from 0 to 7 are allowed
-						Value = Interpreter_Registers_V[Register_Index];
-						LOG(INTERPRETER_IS_LOGGING_ENABLED, "LD R, V%01X (= 0x%02X).", Register_Index, Value);
+/** Execute the LD [I], Vx instruction (Fx55), the handlers are generated for all quirk values. */
+INTERPRETER_GENERATE_STORE_REGISTERS_HANDLER(InterpreterExecuteLdMemoryIVx, Interpreter_Is_Memory_Load_Store_Increment_Enabled)
+#if INTERPRETER_IS_QUIRK_SPECIALIZATION_ENABLED == 1
+	INTERPRETER_GENERATE_STORE_REGISTERS_HANDLER(InterpreterExecuteLdMemoryIVxWithoutIncrement, 0)
+	INTERPRETER_GENERATE_STORE_REGISTERS_HANDLER(InterpreterExecuteLdMemoryIVxWithIncrement, 1)
+#endif
+
+/** Execute the LD Vx, [I] instruction (Fx65), the handlers are generated for all quirk values. */
+INTERPRETER_GENERATE_LOAD_REGISTERS_HANDLER(InterpreterExecuteLdVxMemoryI, Interpreter_Is_Memory_Load_Store_Increment_Enabled)
+#if INTERPRETER_IS_QUIRK_SPECIALIZATION_ENABLED == 1
+	INTERPRETER_GENERATE_LOAD_REGISTERS_HANDLER(InterpreterExecuteLdVxMemoryIWithoutIncrement, 0)
+	INTERPRETER_GENERATE_LOAD_REGISTERS_HANDLER(InterpreterExecuteLdVxMemoryIWithIncrement, 1)
+#endif
+
+/** Execute the LD R, Vx instruction (Fx75). */
+static void InterpreterExecuteLdRVx(unsigned char Register_Index_X, unsigned char Register_Index_Y, unsigned short Operand)
+{
+	unsigned char Value;
 
-						// Store the value
-						EEPROMWriteByte(EEPROM_ADDRESS_INTERPRETER_FLAG_REGISTER_0 + Register_Index, Value);
-						break;
-					}
+	// Only indexes from 0 to 7 are allowed
+	if (Register_Index_X >= INTERPRETER_FLAG_REGISTERS_COUNT)
+	{
+		InterpreterExecuteInvalid(Register_Index_X, Register_Index_Y, Operand);
+		return;
+	}
+	Value = Interpreter_Registers_V[Register_Index_X];
+	LOG(INTERPRETER_IS_LOGGING_ENABLED, "LD R, V%01X (= 0x%02X).", Register_Index_X, Value);
+
+	// Store the value
+	InterpreterPlatformWriteFlagRegister(Register_Index_X, Value);
+}
+
+/** Execute the LD Vx, R instruction (Fx85). */
+static void InterpreterExecuteLdVxR(unsigned char Register_Index_X, unsigned char Register_Index_Y, unsigned short Operand)
+{
+	unsigned char Value;
+
+	// Only indexes from 0 to 7 are allowed
+	if (Register_Index_X >= INTERPRETER_FLAG_REGISTERS_COUNT)
+	{
+		InterpreterExecuteInvalid(Register_Index_X, Register_Index_Y, Operand);
+		return;
+	}
+
+	// Read the value
+	Value = InterpreterPlatformReadFlagRegister(Register_Index_X);
+	LOG(INTERPRETER_IS_LOGGING_ENABLED, "LD V%01X (= 0x%02X), R.", Register_Index_X, Value);
+	Interpreter_Registers_V[Register_Index_X] = Value;
+}
+
+#if INTERPRETER_IS_INSTRUCTION_FUSION_ENABLED == 1
+	// The fused instructions handlers call the instructions handlers table, so they are defined after it
+	static void InterpreterExecuteSeVxByteJpAddress(unsigned char Register_Index_X, unsigned char Register_Index_Y, unsigned short Operand);
+	static void InterpreterExecuteSneVxByteJpAddress(unsigned char Register_Index_X, unsigned char Register_Index_Y, unsigned short Operand);
+	static void InterpreterExecuteLdVxByteLdVyByte(unsigned char Register_Index_X, unsigned char Register_Index_Y, unsigned short Operand);
+	static void InterpreterExecuteLdIAddressDrwVxVyNibble(unsigned char Register_Index_X, unsigned char Register_Index_Y, unsigned short Operand);
+	static void InterpreterExecuteLdIAddressAddIVx(unsigned char Register_Index_X, unsigned char Register_Index_Y, unsigned short Operand);
+#endif
+
+/** All instruction handlers, indexed by the instruction ID. The quirk-dependent entries are updated when a game is loaded if the quirk specialization is enabled. */
+#if INTERPRETER_IS_QUIRK_SPECIALIZATION_ENABLED == 1
+static TInterpreterInstructionHandler Interpreter_Instruction_Handlers[INTERPRETER_INSTRUCTION_IDS_COUNT] =
+#else
+static const TInterpreterInstructionHandler Interpreter_Instruction_Handlers[INTERPRETER_INSTRUCTION_IDS_COUNT] =
+#endif
+{
+	InterpreterExecuteInvalid,
+	InterpreterExecuteScrollDown,
+	InterpreterExecuteScrollUp,
+	InterpreterExecuteCls,
+	InterpreterExecuteRet,
+	InterpreterExecuteScrollRight,
+	InterpreterExecuteScrollLeft,
+	InterpreterExecuteExit,
+	InterpreterExecuteLow,
+	InterpreterExecuteHigh,
+	InterpreterExecuteJpAddress,
+	InterpreterExecuteCallAddress,
+	InterpreterExecuteSeVxByte,
+	InterpreterExecuteSneVxByte,
+	InterpreterExecuteSeVxVy,
+	InterpreterExecuteSaveVxVy,
+	InterpreterExecuteLoadVxVy,
+	InterpreterExecuteLdVxByte,
+	InterpreterExecuteAddVxByte,
+	InterpreterExecuteLdVxVy,
+	InterpreterExecuteOrVxVy,
+	InterpreterExecuteAndVxVy,
+	InterpreterExecuteXorVxVy,
+	InterpreterExecuteAddVxVy,
+	InterpreterExecuteSubVxVy,
+	InterpreterExecuteShrVxVy,
+	InterpreterExecuteSubnVxVy,
+	InterpreterExecuteShlVxVy,
+	InterpreterExecuteSneVxVy,
+	InterpreterExecuteLdIAddress,
+	InterpreterExecuteJpV0Address,
+	InterpreterExecuteRndVxByte,
+	InterpreterExecuteDrwVxVyNibble,
+	InterpreterExecuteSkpVx,
+	InterpreterExecuteSknpVx,
+	InterpreterExecuteLdILongAddress,
+	InterpreterExecutePlane,
+	InterpreterExecuteLdVxDt,
+	InterpreterExecuteLdVxK,
+	InterpreterExecuteLdDtVx,
+	InterpreterExecuteLdStVx,
+	InterpreterExecuteAddIVx,
+	InterpreterExecuteLdFVx,
+	InterpreterExecuteLdHfVx,
+	InterpreterExecuteLdBVx,
+	InterpreterExecuteLdMemoryIVx,
+	InterpreterExecuteLdVxMemoryI,
+	InterpreterExecuteLdRVx,
+	InterpreterExecuteLdVxR,
+	#if INTERPRETER_IS_INSTRUCTION_FUSION_ENABLED == 1
+		InterpreterExecuteSeVxByteJpAddress,
+		InterpreterExecuteSneVxByteJpAddress,
+		InterpreterExecuteLdVxByteLdVyByte,
+		InterpreterExecuteLdIAddressDrwVxVyNibble,
+		InterpreterExecuteLdIAddressAddIVx
+	#endif
+};
+
+#if INTERPRETER_IS_INSTRUCTION_FUSION_ENABLED == 1
+	/** Execute the SE Vx, byte instruction (3xkk) followed by the JP address instruction (1nnn).
+	 * @param Register_Index_Y The SE instruction immediate value.
+	 * @param Operand The JP instruction address.
+	 */
+	static void InterpreterExecuteSeVxByteJpAddress(unsigned char Register_Index_X, unsigned char Register_Index_Y, unsigned short Operand)
+	{
+		LOG(INTERPRETER_IS_LOGGING_ENABLED, "SE V%01X (= 0x%02X), 0x%02X.", Register_Index_X, Interpreter_Registers_V[Register_Index_X], Register_Index_Y);
+
+		// Point after the jump instruction, this skips it or gives it the program counter value it would have if it was executed alone
+		Interpreter_Register_PC += 2;
+		if (Interpreter_Registers_V[Register_Index_X] != Register_Index_Y) InterpreterExecuteJpAddress(0, 0, Operand);
+	}
+
+	/** Execute the SNE Vx, byte instruction (4xkk) followed by the JP address instruction (1nnn).
+	 * @param Register_Index_Y The SNE instruction immediate value.
+	 * @param Operand The JP instruction address.
+	 */
+	static void InterpreterExecuteSneVxByteJpAddress(unsigned char Register_Index_X, unsigned char Register_Index_Y, unsigned short Operand)
+	{
+		LOG(INTERPRETER_IS_LOGGING_ENABLED, "SNE V%01X (= 0x%02X), 0x%02X.", Register_Index_X, Interpreter_Registers_V[Register_Index_X], Register_Index_Y);
+
+		// Point after the jump instruction, this skips it or gives it the program counter value it would have if it was executed alone
+		Interpreter_Register_PC += 2;
+		if (Interpreter_Registers_V[Register_Index_X] == Register_Index_Y) InterpreterExecuteJpAddress(0, 0, Operand);
+	}
+
+	/** Execute the LD Vx, byte instruction (6xkk) followed by another LD Vy, byte instruction (6ykk).
+	 * @param Register_Index_Y The second instruction register.
+	 * @param Operand The first instruction immediate value in the low byte, the second instruction immediate value in the high byte.
+	 */
+	static void InterpreterExecuteLdVxByteLdVyByte(unsigned char Register_Index_X, unsigned char Register_Index_Y, unsigned short Operand)
+	{
+		Interpreter_Registers_V[Register_Index_X] = (unsigned char) Operand;
+		Interpreter_Registers_V[Register_Index_Y] = Operand >> 8; // Write the second register last, in case both instructions use the same register
+		Interpreter_Register_PC += 2;
+		LOG(INTERPRETER_IS_LOGGING_ENABLED, "LD V%01X, 0x%02X.", Register_Index_X, Operand & 0xFF);
+		LOG(INTERPRETER_IS_LOGGING_ENABLED, "LD V%01X, 0x%02X.", Register_Index_Y, Operand >> 8);
+	}
+
+	/** Execute the LD I, address instruction (Annn) followed by the DRW Vx, Vy, nibble instruction (Dxyn).
+	 * @param Operand The LD instruction address in the 12 lower bits, the DRW instruction sprite size in the 4 upper bits.
+	 */
+	static void InterpreterExecuteLdIAddressDrwVxVyNibble(unsigned char Register_Index_X, unsigned char Register_Index_Y, unsigned short Operand)
+	{
+		Interpreter_Register_I = Operand & 0x0FFF;
+		Interpreter_Register_PC += 2;
+		LOG(INTERPRETER_IS_LOGGING_ENABLED, "LD I, 0x%03X.", Interpreter_Register_I);
+
+		// Use the table to call the DRW handler matching the game quirks
+		Interpreter_Instruction_Handlers[INTERPRETER_INSTRUCTION_ID_DRW_VX_VY_NIBBLE](Register_Index_X, Register_Index_Y, Operand >> 12);
+	}
+
+	/** Execute the LD I, address instruction (Annn) followed by the ADD I, Vx instruction (Fx1E). */
+	static void InterpreterExecuteLdIAddressAddIVx(unsigned char Register_Index_X, unsigned char Register_Index_Y, unsigned short Operand)
+	{
+		LOG(INTERPRETER_IS_LOGGING_ENABLED, "LD I, 0x%03X.", Operand);
+		LOG(INTERPRETER_IS_LOGGING_ENABLED, "ADD I (= 0x%04X), V%01X (= 0x%02X).", Operand, Register_Index_X, Interpreter_Registers_V[Register_Index_X]);
+		Interpreter_Register_I = Operand + Interpreter_Registers_V[Register_Index_X];
+		Interpreter_Register_PC += 2;
+	}
+#endif
+
+#if INTERPRETER_IS_QUIRK_SPECIALIZATION_ENABLED == 1
+	/** Install the instruction handlers matching the quirks configured for the current game, so the quirk variables are not tested anymore during the program execution. */
+	static void InterpreterSelectQuirkHandlers(void)
+	{
+		// VF reset
+		if (Interpreter_Is_VF_Reset_Enabled)
+		{
+			Interpreter_Instruction_Handlers[INTERPRETER_INSTRUCTION_ID_OR_VX_VY] = InterpreterExecuteOrVxVyWithVFReset;
+			Interpreter_Instruction_Handlers[INTERPRETER_INSTRUCTION_ID_AND_VX_VY] = InterpreterExecuteAndVxVyWithVFReset;
+			Interpreter_Instruction_Handlers[INTERPRETER_INSTRUCTION_ID_XOR_VX_VY] = InterpreterExecuteXorVxVyWithVFReset;
+		}
+		else
+		{
+			Interpreter_Instruction_Handlers[INTERPRETER_INSTRUCTION_ID_OR_VX_VY] = InterpreterExecuteOrVxVyWithoutVFReset;
+			Interpreter_Instruction_Handlers[INTERPRETER_INSTRUCTION_ID_AND_VX_VY] = InterpreterExecuteAndVxVyWithoutVFReset;
+			Interpreter_Instruction_Handlers[INTERPRETER_INSTRUCTION_ID_XOR_VX_VY] = InterpreterExecuteXorVxVyWithoutVFReset;
+		}
+
+		// Shift
+		if (Interpreter_Is_Shift_Using_Vy_Enabled)
+		{
+			Interpreter_Instruction_Handlers[INTERPRETER_INSTRUCTION_ID_SHR_VX_VY] = InterpreterExecuteShrVxVyUsingVy;
+			Interpreter_Instruction_Handlers[INTERPRETER_INSTRUCTION_ID_SHL_VX_VY] = InterpreterExecuteShlVxVyUsingVy;
+		}
+		else
+		{
+			Interpreter_Instruction_Handlers[INTERPRETER_INSTRUCTION_ID_SHR_VX_VY] = InterpreterExecuteShrVxVyUsingVx;
+			Interpreter_Instruction_Handlers[INTERPRETER_INSTRUCTION_ID_SHL_VX_VY] = InterpreterExecuteShlVxVyUsingVx;
+		}
+
+		// Memory
+		if (Interpreter_Is_Memory_Load_Store_Increment_Enabled)
+		{
+			Interpreter_Instruction_Handlers[INTERPRETER_INSTRUCTION_ID_LD_MEMORY_I_VX] = InterpreterExecuteLdMemoryIVxWithIncrement;
+			Interpreter_Instruction_Handlers[INTERPRETER_INSTRUCTION_ID_LD_VX_MEMORY_I] = InterpreterExecuteLdVxMemoryIWithIncrement;
+		}
+		else
+		{
+			Interpreter_Instruction_Handlers[INTERPRETER_INSTRUCTION_ID_LD_MEMORY_I_VX] = InterpreterExecuteLdMemoryIVxWithoutIncrement;
+			Interpreter_Instruction_Handlers[INTERPRETER_INSTRUCTION_ID_LD_VX_MEMORY_I] = InterpreterExecuteLdVxMemoryIWithoutIncrement;
+		}
+
+		// Display wrapping and fast rendering
+		if (Interpreter_Is_Display_Wrapping_Enabled)
+		{
+			if (Interpreter_Is_Fast_Rendering_Enabled) Interpreter_Instruction_Handlers[INTERPRETER_INSTRUCTION_ID_DRW_VX_VY_NIBBLE] = InterpreterExecuteDrwVxVyNibbleWrappingFastRendering;
+			else Interpreter_Instruction_Handlers[INTERPRETER_INSTRUCTION_ID_DRW_VX_VY_NIBBLE] = InterpreterExecuteDrwVxVyNibbleWrappingDirectRendering;
+		}
+		else
+		{
+			if (Interpreter_Is_Fast_Rendering_Enabled) Interpreter_Instruction_Handlers[INTERPRETER_INSTRUCTION_ID_DRW_VX_VY_NIBBLE] = InterpreterExecuteDrwVxVyNibbleClippingFastRendering;
+			else Interpreter_Instruction_Handlers[INTERPRETER_INSTRUCTION_ID_DRW_VX_VY_NIBBLE] = InterpreterExecuteDrwVxVyNibbleClippingDirectRendering;
+		}
+	}
+#endif
+
+/** Enter or leave the turbo mode. In turbo mode, the tick (which clocks the delay and sound timers) runs INTERPRETER_TURBO_SPEED_FACTOR times faster, the game speed is not regulated anymore and the display is rendered at most once every INTERPRETER_TURBO_SPEED_FACTOR ticks.
+ * @param Is_Enabled Set to 1 to enter the turbo mode, set to 0 to return to the normal speed.
+ */
+static void InterpreterSetTurboMode(unsigned char Is_Enabled)
+{
+	if (Is_Enabled == Interpreter_Is_Turbo_Enabled) return;
+	Interpreter_Is_Turbo_Enabled = Is_Enabled;
+	LOG(INTERPRETER_IS_LOGGING_ENABLED, "Turbo mode is %s.", Is_Enabled ? "enabled" : "disabled");
+
+	// Change the timers clock, they keep their current count so no timer is lost when switching modes
+	if (Is_Enabled)
+	{
+		InterpreterPlatformSetTickSpeedFactor(INTERPRETER_TURBO_SPEED_FACTOR);
+
+		// Render the frame buffer only on ticks, so frames can be skipped
+		Interpreter_Turbo_Saved_Is_Fast_Rendering_Enabled = Interpreter_Is_Fast_Rendering_Enabled;
+		Interpreter_Is_Fast_Rendering_Enabled = 1;
+		Interpreter_Turbo_Skipped_Frames_Count = INTERPRETER_TURBO_SPEED_FACTOR - 1;
+	}
+	else
+	{
+		InterpreterPlatformSetTickSpeedFactor(1);
+		Interpreter_Is_Fast_Rendering_Enabled = Interpreter_Turbo_Saved_Is_Fast_Rendering_Enabled;
+
+		// Make sure the last frame is displayed if the game does not use the fast rendering mode
+		if (!Interpreter_Is_Fast_Rendering_Enabled && Interpreter_Is_Rendering_Needed)
+		{
+			InterpreterDrawFrameBuffer();
+			Interpreter_Is_Rendering_Needed = 0;
+		}
+	}
+
+	// Update the DRW instruction handler
+	#if INTERPRETER_IS_QUIRK_SPECIALIZATION_ENABLED == 1
+		InterpreterSelectQuirkHandlers();
+	#endif
+}
+
+#if INTERPRETER_IS_RECOMPILER_ENABLED == 1
+	// The translated program (made by Tools/Recompiler.py) directly uses the registers, the handlers and the private functions, so it is included after all of them
+	#include INTERPRETER_RECOMPILED_PROGRAM_FILE
+
+	/** Enable all translated blocks if the loaded program is the translated one, otherwise the program is only interpreted. */
+	static void InterpreterRecompilerPrepare(void)
+	{
+		unsigned short i, Address;
+		const TInterpreterRecompiledCodeRange *Pointer_Range;
+
+		memset(Interpreter_Recompiler_Blocks_Map, 0, sizeof(Interpreter_Recompiler_Blocks_Map));
+		memset(Interpreter_Recompiler_Is_Code_Byte, 0, sizeof(Interpreter_Recompiler_Is_Code_Byte));
+		Interpreter_Recompiler_Instructions_Count = 0;
+
+		if (memcmp(&Shared_Buffers.Interpreter_Memory[INTERPRETER_PROGRAM_ENTRY_POINT], Interpreter_Recompiled_Program, sizeof(Interpreter_Recompiled_Program)) != 0)
+		{
+			LOG(INTERPRETER_IS_LOGGING_ENABLED, "The loaded program is not the translated one, interpreting it.");
+			return;
+		}
+
+		for (i = 0; i < sizeof(Interpreter_Recompiled_Blocks) / sizeof(Interpreter_Recompiled_Blocks[0]); i++) Interpreter_Recompiler_Blocks_Map[Interpreter_Recompiled_Blocks[i].Address] = Interpreter_Recompiled_Blocks[i].Function;
+		for (i = 0; i < sizeof(Interpreter_Recompiled_Code_Ranges) / sizeof(Interpreter_Recompiled_Code_Ranges[0]); i++)
+		{
+			Pointer_Range = &Interpreter_Recompiled_Code_Ranges[i];
+			for (Address = Pointer_Range->Start_Address; Address < Pointer_Range->End_Address; Address++) Interpreter_Recompiler_Is_Code_Byte[Address] = 1;
+		}
+	}
 
-					// LD Vx, R
-					case 0x85:
+	/** Disable the translated blocks that have been built from the specified program byte, they are interpreted from now on.
+	 * @param Address The address of the modified byte.
+	 */
+	static void InterpreterRecompilerInvalidate(unsigned short Address)
+	{
+		unsigned short i;
+		const TInterpreterRecompiledCodeRange *Pointer_Range;
+
+		// Most writes target the program data, do not search the blocks for them
+		if (!Interpreter_Recompiler_Is_Code_Byte[Address]) return;
+
+		for (i = 0; i < sizeof(Interpreter_Recompiled_Code_Ranges) / sizeof(Interpreter_Recompiled_Code_Ranges[0]); i++)
+		{
+			Pointer_Range = &Interpreter_Recompiled_Code_Ranges[i];
+			if ((Address >= Pointer_Range->Start_Address) && (Address < Pointer_Range->End_Address))
+			{
+				Interpreter_Recompiler_Blocks_Map[Interpreter_Recompiled_Blocks[Pointer_Range->Block_Index].Address] = NULL;
+				LOG(INTERPRETER_IS_LOGGING_ENABLED, "The program modified the byte 0x%03X of the translated block 0x%03X, disabling the block.", Address, Interpreter_Recompiled_Blocks[Pointer_Range->Block_Index].Address);
+			}
+		}
+		Interpreter_Recompiler_Is_Code_Byte[Address] = 0; // All blocks containing this byte are now disabled
+	}
+#endif
+
+#if INTERPRETER_IS_TUNING_DATABASE_ENABLED == 1
+	/** Find the loaded ROM in the tuning database and apply the settings the game configuration did not provide.
+	 * @param ROM_Size How many bytes of the ROM file have been loaded to the interpreter memory.
+	 * @param Configured_Settings_Mask The INTERPRETER_TUNING_DATABASE_SETTING_xxx flags of the settings found in the game configuration, they are not overridden.
+	 */
+	static void InterpreterApplyTuningDatabase(unsigned short ROM_Size, unsigned char Configured_Settings_Mask)
+	{
+		unsigned long Hash = INTERPRETER_TUNING_DATABASE_HASH_OFFSET_BASIS;
+		unsigned short i;
+		const TInterpreterTuningDatabaseEntry *Pointer_Entry;
+		unsigned char Enabled_Settings_Mask;
+
+		// Hash the ROM the same way than the Tools/Tuning_Database.py script
+		for (i = 0; i < ROM_Size; i++)
+		{
+			Hash ^= Shared_Buffers.Interpreter_Memory[INTERPRETER_PROGRAM_ENTRY_POINT + i];
+			Hash *= INTERPRETER_TUNING_DATABASE_HASH_PRIME;
+		}
+		Hash &= 0xFFFFFFFFUL; // The unsigned long type is wider than 32 bits on the host
+		LOG(INTERPRETER_IS_LOGGING_ENABLED, "ROM hash : 0x%08lX, size : %u bytes.", Hash, ROM_Size);
+
+		// Search for the game
+		for (i = 0; i < Interpreter_Tuning_Database_Entries_Count; i++)
+		{
+			Pointer_Entry = &Interpreter_Tuning_Database[i];
+			if ((Pointer_Entry->ROM_Hash == Hash) && (Pointer_Entry->ROM_Size == ROM_Size)) break;
+		}
+		if (i == Interpreter_Tuning_Database_Entries_Count)
+		{
+			LOG(INTERPRETER_IS_LOGGING_ENABLED, "The ROM is not in the tuning database.");
+			return;
+		}
+		LOG(INTERPRETER_IS_LOGGING_ENABLED, "Found the ROM in the tuning database entry %u, the game configuration overrides the settings 0x%02X.", i, Configured_Settings_Mask);
+
+		// Apply the settings
+		Enabled_Settings_Mask = Pointer_Entry->Enabled_Settings_Mask;
+		if (!(Configured_Settings_Mask & INTERPRETER_TUNING_DATABASE_SETTING_FAST_RENDERING)) Interpreter_Is_Fast_Rendering_Enabled = (Enabled_Settings_Mask & INTERPRETER_TUNING_DATABASE_SETTING_FAST_RENDERING) ? 1 : 0;
+		if (!(Configured_Settings_Mask & INTERPRETER_TUNING_DATABASE_SETTING_DISPLAY_WRAPPING)) Interpreter_Is_Display_Wrapping_Enabled = (Enabled_Settings_Mask & INTERPRETER_TUNING_DATABASE_SETTING_DISPLAY_WRAPPING) ? 1 : 0;
+		if (!(Configured_Settings_Mask & INTERPRETER_TUNING_DATABASE_SETTING_MEMORY_LOAD_STORE_INCREMENT)) Interpreter_Is_Memory_Load_Store_Increment_Enabled = (Enabled_Settings_Mask & INTERPRETER_TUNING_DATABASE_SETTING_MEMORY_LOAD_STORE_INCREMENT) ? 1 : 0;
+		if (!(Configured_Settings_Mask & INTERPRETER_TUNING_DATABASE_SETTING_SHIFT_USING_VY)) Interpreter_Is_Shift_Using_Vy_Enabled = (Enabled_Settings_Mask & INTERPRETER_TUNING_DATABASE_SETTING_SHIFT_USING_VY) ? 1 : 0;
+		if (!(Configured_Settings_Mask & INTERPRETER_TUNING_DATABASE_SETTING_VF_RESET)) Interpreter_Is_VF_Reset_Enabled = (Enabled_Settings_Mask & INTERPRETER_TUNING_DATABASE_SETTING_VF_RESET) ? 1 : 0;
+		if (!(Configured_Settings_Mask & INTERPRETER_TUNING_DATABASE_SETTING_RENDERING_DELAY)) Interpreter_Rendering_Delay = Pointer_Entry->Rendering_Delay;
+		if (!(Configured_Settings_Mask & INTERPRETER_TUNING_DATABASE_SETTING_INSTRUCTIONS_PER_FRAME)) Interpreter_Instructions_Per_Frame = Pointer_Entry->Instructions_Per_Frame;
+	}
+#endif
+
+//-------------------------------------------------------------------------------------------------
+// Public functions
+//-------------------------------------------------------------------------------------------------
+void InterpreterInitialize(void)
+{
+	InterpreterPlatformInitialize();
+}
+
+unsigned char InterpreterLoadProgramFromFile(char *Pointer_String_Game_INI_Section)
+{
+	unsigned char Result, Configured_Settings_Mask = 0;
+	unsigned short Instructions_Per_Frame, ROM_Size;
+	char *Pointer_String;
+
+	// Assign the console keys to the Chip-8 values expected by the game (do that before loading the ROM file because the INI data is stored in the same buffer that the one in which the ROM file will be loaded)
+	if (InterpreterConfigureKeyBindings(Pointer_String_Game_INI_Section) != 0)
+	{
+		LOG(INTERPRETER_IS_LOGGING_ENABLED, "Error : failed to configure the key bindings.");
+		return 1;
+	}
+
+	// Retrieve the game ROM file name
+	Pointer_String = INIParserReadString(Pointer_String_Game_INI_Section, "ROMFile");
+	if (Pointer_String == NULL)
+	{
+		LOG(INTERPRETER_IS_LOGGING_ENABLED, "Error : failed to retrieve the game ROM file from the INI configuration.");
+		return 1;
+	}
+	LOG(INTERPRETER_IS_LOGGING_ENABLED, "ROM file name : \"%s\".", Pointer_String);
+	#if INTERPRETER_IS_BENCHMARK_ENABLED == 1
+		snprintf(Interpreter_Benchmark_String_ROM_File_Name, sizeof(Interpreter_Benchmark_String_ROM_File_Name), "%s", Pointer_String);
+	#endif
+
+	// If the corresponding key is not found, the variable is set to 0, in order to disable the feature by default (the tuning database can then provide the value once the ROM is loaded)
+	// Fast rendering
+	if (INIParserRead8BitInteger(Pointer_String_Game_INI_Section, "FastRendering", &Result) == 0)
+	{
+		Interpreter_Is_Fast_Rendering_Enabled = Result;
+		Configured_Settings_Mask |= INTERPRETER_TUNING_DATABASE_SETTING_FAST_RENDERING;
+	}
+	else Interpreter_Is_Fast_Rendering_Enabled = 0;
+	// Display wrapping
+	if (INIParserRead8BitInteger(Pointer_String_Game_INI_Section, "DisplayWrapping", &Result) == 0)
+	{
+		Interpreter_Is_Display_Wrapping_Enabled = Result;
+		Configured_Settings_Mask |= INTERPRETER_TUNING_DATABASE_SETTING_DISPLAY_WRAPPING;
+	}
+	else Interpreter_Is_Display_Wrapping_Enabled = 0;
+	// Memory
+	if (INIParserRead8BitInteger(Pointer_String_Game_INI_Section, "MemoryLoadStoreIncrement", &Result) == 0)
+	{
+		Interpreter_Is_Memory_Load_Store_Increment_Enabled = Result;
+		Configured_Settings_Mask |= INTERPRETER_TUNING_DATABASE_SETTING_MEMORY_LOAD_STORE_INCREMENT;
+	}
+	else Interpreter_Is_Memory_Load_Store_Increment_Enabled = 0;
+	// Shift
+	if (INIParserRead8BitInteger(Pointer_String_Game_INI_Section, "ShiftUsingVy", &Result) == 0)
+	{
+		Interpreter_Is_Shift_Using_Vy_Enabled = Result;
+		Configured_Settings_Mask |= INTERPRETER_TUNING_DATABASE_SETTING_SHIFT_USING_VY;
+	}
+	else Interpreter_Is_Shift_Using_Vy_Enabled = 0;
+	// VF reset
+	if (INIParserRead8BitInteger(Pointer_String_Game_INI_Section, "ResetVF", &Result) == 0)
+	{
+		Interpreter_Is_VF_Reset_Enabled = Result;
+		Configured_Settings_Mask |= INTERPRETER_TUNING_DATABASE_SETTING_VF_RESET;
+	}
+	else Interpreter_Is_VF_Reset_Enabled = 0;
+	// Rendering delay (in milliseconds)
+	if (INIParserRead8BitInteger(Pointer_String_Game_INI_Section, "RenderingDelay", &Result) == 0)
+	{
+		Interpreter_Rendering_Delay = Result;
+
+		// The delay is done in the fast rendering code, so enable this feature
+		Interpreter_Is_Fast_Rendering_Enabled = 1;
+		Configured_Settings_Mask |= INTERPRETER_TUNING_DATABASE_SETTING_RENDERING_DELAY | INTERPRETER_TUNING_DATABASE_SETTING_FAST_RENDERING;
+	}
+	else Interpreter_Rendering_Delay = 0;
+	// Emulation speed (in instructions per frame)
+	if (INIParserRead16BitInteger(Pointer_String_Game_INI_Section, "InstructionsPerFrame", &Instructions_Per_Frame) == 0)
+	{
+		Interpreter_Instructions_Per_Frame = Instructions_Per_Frame;
+		Configured_Settings_Mask |= INTERPRETER_TUNING_DATABASE_SETTING_INSTRUCTIONS_PER_FRAME;
+	}
+	else Interpreter_Instructions_Per_Frame = 0;
+	#if INTERPRETER_IS_INPUT_STREAM_ENABLED == 1
+		// Input stream (0 to read the keyboard, 1 to record the keys, 2 to replay them)
+		if ((INIParserRead8BitInteger(Pointer_String_Game_INI_Section, "InputStream", &Result) == 0) && (Result <= INTERPRETER_INPUT_STREAM_MODE_REPLAY)) Interpreter_Input_Stream_Mode = Result;
+		else Interpreter_Input_Stream_Mode = INTERPRETER_INPUT_STREAM_MODE_DISABLED;
+	#endif
+
+	// Load the file (the INI section containing the file name is overwritten)
+	if (InterpreterPlatformLoadProgramFile(Pointer_String, &Shared_Buffers.Interpreter_Memory[INTERPRETER_PROGRAM_ENTRY_POINT], INTERPRETER_MEMORY_SIZE - INTERPRETER_PROGRAM_ENTRY_POINT, &ROM_Size) != 0) // The INTERPRETER_MEMORY_SIZE and INTERPRETER_PROGRAM_ENTRY_POINT values are multiples of 512
+	{
+		LOG(INTERPRETER_IS_LOGGING_ENABLED, "Error : failed to load the program file.");
+		return 1;
+	}
+
+	// Complete the game configuration with the known-good settings of this ROM
+	#if INTERPRETER_IS_TUNING_DATABASE_ENABLED == 1
+		InterpreterApplyTuningDatabase(ROM_Size, Configured_Settings_Mask);
+	#endif
+
+	#if INTERPRETER_IS_QUIRK_SPECIALIZATION_ENABLED == 1
+		InterpreterSelectQuirkHandlers();
+	#endif
+
+	// Place the built-in fonts at the beginning of the interpreter memory
+	memcpy(Shared_Buffers.Interpreter_Memory, Interpreter_Fonts, sizeof(Interpreter_Fonts));
+
+	// Configure the registers for the program execution
+	Interpreter_Register_PC = INTERPRETER_PROGRAM_ENTRY_POINT; // The default entry point
+	Interpreter_Register_SP = 0; // Clear the stack
+	// Reset all other registers
+	Interpreter_Register_I = 0;
+	memset(Interpreter_Registers_V, 0, sizeof(Interpreter_Registers_V));
+
+	// Clear the frame buffer
+	memset(Shared_Buffer_Display, 0, sizeof(Shared_Buffer_Display));
+	#if INTERPRETER_IS_XO_CHIP_ENABLED == 1
+		memset(Shared_Buffers.Interpreter_Display_Second_Plane, 0, sizeof(Shared_Buffers.Interpreter_Display_Second_Plane)); // The FAT driver used this memory to load the program, it is not needed until the game exits
+	#endif
+	// Only the Chip-8 plane is used until the program selects another one
+	Interpreter_Selected_Planes_Mask = 1;
+	Interpreter_Is_Second_Plane_Enabled = 0;
+
+	#if INTERPRETER_IS_DECODE_CACHE_ENABLED == 1
+	{
+		unsigned short Address;
+
+		// Decode the program beginning once for all, the following instructions will be decoded the first time they are executed
+		InterpreterDecodeCacheClear();
+		for (Address = INTERPRETER_PROGRAM_ENTRY_POINT; Address < INTERPRETER_PROGRAM_ENTRY_POINT + (INTERPRETER_DECODE_CACHE_ENTRIES_COUNT * 2); Address += 2) InterpreterDecodeInstruction(Address, INTERPRETER_DECODE_CACHE_GET_ENTRY(Address));
+	}
+	#endif
+
+	// Purge any spurious press of the menu key
+	InterpreterPlatformIsMenuKeyPressed();
+
+	// Initialize the random seed for the entire Chip-8 program execution
+	Interpreter_Random_Seed = InterpreterPlatformGetRandomSeed();
+
+	return 0;
+}
+
+unsigned char InterpreterRunProgram(void)
+{
+	TInterpreterDecodedInstruction *Pointer_Instruction;
+	unsigned short Slice_Instructions_Count, Remaining_Instructions_Count;
+	#if INTERPRETER_IS_DECODE_CACHE_ENABLED == 0
+		TInterpreterDecodedInstruction Instruction;
+	#endif
+	#if INTERPRETER_IS_TRACE_BUFFER_ENABLED == 1
+		TInterpreterTraceBufferEntry *Pointer_Trace_Buffer_Entry;
+	#endif
+	#if INTERPRETER_IS_DEBUGGER_ENABLED == 1
+		unsigned char Is_Stepping_Enabled = 1;
+		unsigned short Breakpoint_Address = 0; // Set to 0 to disable the breakpoint feature, otherwise set to the address to break on
+	#endif
+	#if INTERPRETER_IS_BENCHMARK_ENABLED == 1
+		unsigned short Benchmark_Slice_Start_Time, Benchmark_DRW_Start_Time;
+	#endif
+	#if INTERPRETER_IS_COST_MEASUREMENT_ENABLED == 1
+		unsigned short Cost_Measurement_Start_Time;
+		TInterpreterInstructionID Cost_Measurement_Instruction_ID;
+	#endif
+	#if INTERPRETER_IS_RECOMPILER_ENABLED == 1
+		TInterpreterRecompiledBlockFunction Recompiled_Block_Function;
+		unsigned short Recompiled_Remaining_Instructions_Count;
+	#endif
+
+	// Configure the Chip-8 display settings by default, they may be updated later by the resolution changing instructions
+	Interpreter_Display_Columns_Count = INTERPRETER_DISPLAY_COLUMNS_COUNT_CHIP_8;
+	Interpreter_Display_Rows_Count = INTERPRETER_DISPLAY_ROWS_COUNT_CHIP_8;
+	Interpreter_Is_High_Resolution_Enabled = 0;
+	Interpreter_Display_Row_Offset = 0; // The frame buffer has just been cleared
+	Interpreter_Is_Rendering_Needed = 0;
+	Interpreter_Execution_State = INTERPRETER_EXECUTION_STATE_RUNNING;
+	InterpreterMarkFrameBufferChanged(); // The display is showing the menu
+
+	Interpreter_Is_Turbo_Enabled = 0;
+
+	// Execute a fixed amount of instructions per frame if the game asks for it, otherwise go as fast as possible
+	if (Interpreter_Instructions_Per_Frame == 0) Slice_Instructions_Count = INTERPRETER_UNTHROTTLED_SLICE_INSTRUCTIONS_COUNT;
+	else Slice_Instructions_Count = Interpreter_Instructions_Per_Frame;
+
+	#if INTERPRETER_IS_INPUT_STREAM_ENABLED == 1
+		if (InterpreterInputStreamStart() != 0) return 1;
+	#endif
+
+	#if INTERPRETER_IS_BENCHMARK_ENABLED == 1
+		Interpreter_Benchmark_Instructions_Count = 0;
+		Interpreter_Benchmark_DRW_Instructions_Count = 0;
+		Interpreter_Benchmark_DRW_Duration = 0;
+		Interpreter_Benchmark_Duration = 0;
+	#endif
+	#if INTERPRETER_IS_IDLE_STATISTICS_ENABLED == 1
+		Interpreter_Idle_Mode_Entries_Count = 0;
+		Interpreter_Idle_Mode_Duration = 0;
+	#endif
+	#if INTERPRETER_IS_TRACE_BUFFER_ENABLED == 1
+		memset(Interpreter_Trace_Buffer, 0xFF, sizeof(Interpreter_Trace_Buffer)); // Set all addresses to INTERPRETER_TRACE_BUFFER_INVALID_ADDRESS
+		Interpreter_Trace_Buffer_Index = 0;
+	#endif
+	#if INTERPRETER_IS_PROFILER_ENABLED == 1
+		memset(Interpreter_Profiler_Instruction_Counters, 0, sizeof(Interpreter_Profiler_Instruction_Counters));
+	#endif
+	#if INTERPRETER_IS_COST_MEASUREMENT_ENABLED == 1
+		memset(Interpreter_Cost_Measurement_Counts, 0, sizeof(Interpreter_Cost_Measurement_Counts));
+		memset(Interpreter_Cost_Measurement_Durations, 0, sizeof(Interpreter_Cost_Measurement_Durations));
+	#endif
+	#if INTERPRETER_IS_PC_SAMPLING_ENABLED == 1
+		memset(Interpreter_PC_Sampling_Histogram, 0, sizeof(Interpreter_PC_Sampling_Histogram));
+		Interpreter_Is_PC_Sampling_Enabled = 1;
+	#endif
+	#if INTERPRETER_IS_RECOMPILER_ENABLED == 1
+		InterpreterRecompilerPrepare();
+	#endif
+
+	while (1)
+	{
+		// A frame starts with each slice, sample the keys the slice will see (the stream is not included in the benchmark time)
+		#if INTERPRETER_IS_INPUT_STREAM_ENABLED == 1
+			InterpreterInputStreamProcessFrame();
+			if (Interpreter_Execution_State == INTERPRETER_EXECUTION_STATE_EXIT) break; // The replayed stream has ended
+		#endif
+
+		// Measure the time of each slice separately, so the counter does not wrap around during the measurement
+		#if INTERPRETER_IS_BENCHMARK_ENABLED == 1
+			Benchmark_Slice_Start_Time = InterpreterPlatformReadTimeCounter();
+		#endif
+
+		// Execute a slice of instructions, nothing else is done between them
+		for (Remaining_Instructions_Count = Slice_Instructions_Count; Remaining_Instructions_Count > 0; Remaining_Instructions_Count--)
+		{
+			// Make sure only the instruction address can't go out the array bounds
+			Interpreter_Register_PC &= 0x0FFF;
+
+			// Run the translated code instead when the program counter reaches a translated block (the block executes as many instructions as the slice allows)
+			#if INTERPRETER_IS_RECOMPILER_ENABLED == 1
+				Recompiled_Block_Function = Interpreter_Recompiler_Blocks_Map[Interpreter_Register_PC];
+				if (Recompiled_Block_Function != NULL)
+				{
+					Recompiled_Remaining_Instructions_Count = Recompiled_Block_Function(Remaining_Instructions_Count);
+					Interpreter_Recompiler_Instructions_Count += Remaining_Instructions_Count - Recompiled_Remaining_Instructions_Count;
+					Remaining_Instructions_Count = Recompiled_Remaining_Instructions_Count + 1; // The loop counter will be decremented for the last executed instruction, like for an interpreted one
+					goto Check_Execution_State;
+				}
+			#endif
+
+			// Fetch the next instruction, decoding it only if it is not already present in the cache
+			#if INTERPRETER_IS_DECODE_CACHE_ENABLED == 1
+				Pointer_Instruction = INTERPRETER_DECODE_CACHE_GET_ENTRY(Interpreter_Register_PC);
+				if (Pointer_Instruction->Address != Interpreter_Register_PC) InterpreterDecodeInstruction(Interpreter_Register_PC, Pointer_Instruction);
+			#else
+				Pointer_Instruction = &Instruction;
+				InterpreterDecodeInstruction(Interpreter_Register_PC, Pointer_Instruction);
+			#endif
+			LOG(INTERPRETER_IS_LOGGING_ENABLED, "**** Fetching instruction at address 0x%03X : 0x%02X 0x%02X.", Interpreter_Register_PC, Shared_Buffers.Interpreter_Memory[Interpreter_Register_PC], Shared_Buffers.Interpreter_Memory[(Interpreter_Register_PC + 1) & 0x0FFF]);
+
+			#if INTERPRETER_IS_DEBUGGER_ENABLED == 1
+				if (Breakpoint_Address != 0)
+				{
+					if (Breakpoint_Address == Interpreter_Register_PC)
 					{
-						unsigned char Register_Index, Value;
+						SerialPortWriteString("Reached breakpoint.\r\n");
+						Is_Stepping_Enabled = 1;
+					}
+				}
 
-						// Extract the operands
-						Register_Index = Instruction_High_Byte & 0x0F;
-						if (Register_Index >= INTERPRETER_FLAG_REGISTERS_COUNT) goto Invalid_Instruction; // Only indexes from 0 to 7 are allowed
+				if (Is_Stepping_Enabled)
+				{
+					unsigned char i, Character;
 
-						// Read the value
-						Value = EEPROMReadByte(EEPROM_ADDRESS_INTERPRETER_FLAG_REGISTER_0 + Register_Index);
-						LOG(INTERPRETER_IS_LOGGING_ENABLED, "LD V%01X (= 0x%02X), R.", Register_Index, Value);
-						Interpreter_Registers_V[Register_Index] = Value;
-						break;
+					// Display all registers
+					SerialPortWriteString("Registers :\r\n");
+					printf("PC=0x%04X, I=0x%04X, SP=0x%02X\r\n", Interpreter_Register_PC, Interpreter_Register_I, Interpreter_Register_SP);
+					for (i = 0; i < INTERPRETER_REGISTERS_V_COUNT; i++) printf("V%01X=0x%02X, ", i, Interpreter_Registers_V[i]);
+					SerialPortWriteString("\r\n");
+
+					// Wait for user input
+					SerialPortWriteString("Press 'c' to continue execution or 's' to step.\r\n");
+					while (1)
+					{
+						Character = SerialPortReadByte();
+						if (Character == 'c')
+						{
+							Is_Stepping_Enabled = 0;
+							SerialPortWriteString("Continuing execution...\r\n");
+							break;
+						}
+						if (Character == 's') break;
 					}
+				}
+			#endif
+
+			#if INTERPRETER_IS_TRACE_BUFFER_ENABLED == 1
+				// Remember the instruction in case the program crashes (only the first instruction of a fused instruction is recorded), the index wraps with a mask so the oldest entry is overwritten without any test
+				Pointer_Trace_Buffer_Entry = &Interpreter_Trace_Buffer[Interpreter_Trace_Buffer_Index];
+				Pointer_Trace_Buffer_Entry->Address = Interpreter_Register_PC;
+				Pointer_Trace_Buffer_Entry->Opcode_High_Byte = Shared_Buffers.Interpreter_Memory[Interpreter_Register_PC];
+				Pointer_Trace_Buffer_Entry->Opcode_Low_Byte = Shared_Buffers.Interpreter_Memory[(Interpreter_Register_PC + 1) & 0x0FFF];
+				Interpreter_Trace_Buffer_Index = (Interpreter_Trace_Buffer_Index + 1) & (INTERPRETER_TRACE_BUFFER_ENTRIES_COUNT - 1);
+			#endif
+
+			// Point to the next instruction before executing the current one, so the jump instructions can directly overwrite the program counter
+			Interpreter_Register_PC += 2;
+
+			#if INTERPRETER_IS_PROFILER_ENABLED == 1
+				if (Interpreter_Profiler_Instruction_Counters[Pointer_Instruction->ID] != 0xFFFF) Interpreter_Profiler_Instruction_Counters[Pointer_Instruction->ID]++;
+			#endif
+
+			// A fused instruction counts for two instructions, so the game speed stays the same (a jump skipped by a fused SE or SNE instruction is counted too, this small difference is not noticeable)
+			#if INTERPRETER_IS_INSTRUCTION_FUSION_ENABLED == 1
+				if ((Pointer_Instruction->ID >= INTERPRETER_INSTRUCTION_ID_FIRST_FUSED) && (Remaining_Instructions_Count > 1)) Remaining_Instructions_Count--;
+			#endif
+
+			#if INTERPRETER_IS_COST_MODEL_ENABLED == 1
+				Interpreter_Cost_Model_Cycles_Count += Interpreter_Cost_Model_Instruction_Cycles[Pointer_Instruction->ID];
+			#endif
+			#if INTERPRETER_IS_COST_MEASUREMENT_ENABLED == 1
+				Cost_Measurement_Instruction_ID = Pointer_Instruction->ID;
+				Interpreter_Cost_Measurement_Nested_Duration = 0;
+				Cost_Measurement_Start_Time = InterpreterPlatformReadTimeCounter();
+			#endif
+
+			// Execute the instruction
+			#if INTERPRETER_IS_BENCHMARK_ENABLED == 1
+				if (INTERPRETER_IS_DRW_INSTRUCTION(Pointer_Instruction->ID))
+				{
+					Benchmark_DRW_Start_Time = InterpreterPlatformReadTimeCounter();
+					Interpreter_Instruction_Handlers[Pointer_Instruction->ID](Pointer_Instruction->Register_Index_X, Pointer_Instruction->Register_Index_Y, Pointer_Instruction->Operand);
+					Interpreter_Benchmark_DRW_Duration += (unsigned short) (InterpreterPlatformReadTimeCounter() - Benchmark_DRW_Start_Time);
+					Interpreter_Benchmark_DRW_Instructions_Count++;
+				}
+				else
+			#endif
+			Interpreter_Instruction_Handlers[Pointer_Instruction->ID](Pointer_Instruction->Register_Index_X, Pointer_Instruction->Register_Index_Y, Pointer_Instruction->Operand);
 
-					default:
-						goto Invalid_Instruction;
+			#if INTERPRETER_IS_COST_MEASUREMENT_ENABLED == 1
+				// The LD Vx, K instruction duration depends on the user, not on the interpreter
+				if (Cost_Measurement_Instruction_ID != INTERPRETER_INSTRUCTION_ID_LD_VX_K)
+				{
+					Interpreter_Cost_Measurement_Counts[Cost_Measurement_Instruction_ID]++;
+					Interpreter_Cost_Measurement_Durations[Cost_Measurement_Instruction_ID] += (unsigned short) (InterpreterPlatformReadTimeCounter() - Cost_Measurement_Start_Time - Interpreter_Cost_Measurement_Nested_Duration);
 				}
-				break;
+			#endif
+
+			#if INTERPRETER_IS_EXECUTION_TRACE_ENABLED == 1
+				InterpreterPlatformTraceInstruction(Interpreter_Register_PC, Interpreter_Register_I, Interpreter_Register_SP, Interpreter_Registers_V, Interpreter_Display_Row_Offset);
+			#endif
+
+		#if INTERPRETER_IS_RECOMPILER_ENABLED == 1
+		Check_Execution_State:
+		#endif
+			if (Interpreter_Execution_State != INTERPRETER_EXECUTION_STATE_RUNNING)
+			{
+				// Stop the slice when the program is only waiting for the next tick
+				if (Interpreter_Execution_State == INTERPRETER_EXECUTION_STATE_IDLE) break;
+				#if INTERPRETER_IS_BENCHMARK_ENABLED == 1
+					Interpreter_Benchmark_Instructions_Count += Slice_Instructions_Count - Remaining_Instructions_Count + 1; // The loop counter has not been decremented for the last executed instruction
+				#endif
+				goto Exit;
 			}
+		}
+
+		#if INTERPRETER_IS_BENCHMARK_ENABLED == 1
+			// The loop counter has not been decremented for the instruction that stopped the slice
+			Interpreter_Benchmark_Instructions_Count += Slice_Instructions_Count - Remaining_Instructions_Count;
+			if (Remaining_Instructions_Count != 0) Interpreter_Benchmark_Instructions_Count++;
+		#endif
+
+		// Return to the normal speed as soon as one key of the chord is released, the menu key presses are ignored in turbo mode because the menu key release bounces look like new presses
+		if (Interpreter_Is_Turbo_Enabled)
+		{
+			if (!(InterpreterPlatformIsMenuKeyHeld() && (InterpreterPlatformReadKeysMask() & INTERPRETER_TURBO_CHORD_KEY)))
+			{
+				InterpreterSetTurboMode(0);
 
-			default:
-				goto Invalid_Instruction;
+				// The chord key may be released first, wait for the menu key to be released too and discard its bounces, so the menu is not displayed
+				InterpreterPlatformWaitForMenuKeyRelease();
+			}
+		}
+		// Exit when the menu key is pressed, unless the turbo chord key is pressed too
+		else if (InterpreterPlatformIsMenuKeyPressed())
+		{
+			if (!(InterpreterPlatformReadKeysMask() & INTERPRETER_TURBO_CHORD_KEY)) break;
+			InterpreterSetTurboMode(1);
 		}
 
-		// Increment the instruction address
-		Interpreter_Register_PC += 2;
+		// Wait for the end of the frame when the game speed is regulated (the delay and sound timers are clocked by the hardware, so they do not need to be updated here, the rendering delay is not needed either)
+		if ((Interpreter_Instructions_Per_Frame != 0) && !Interpreter_Is_Turbo_Enabled)
+		{
+			while (!InterpreterPlatformIsTickElapsed()) InterpreterWaitForTick();
 
-Next_Instruction:
+			// Display the frame buffer if the fast rendering mode has modified it
+			if (Interpreter_Is_Rendering_Needed)
+			{
+				InterpreterDrawFrameBuffer();
+				Interpreter_Is_Rendering_Needed = 0;
+			}
+			InterpreterPlatformClearTick(); // The tick flag must be manually cleared
+		}
 		// Transfer the frame buffer to the display only when it has changed and not faster than 60 times per second
-		if (Is_Rendering_Needed && NCO_IS_TICK_ELAPSED())
+		else if (Interpreter_Is_Rendering_Needed && InterpreterPlatformIsTickElapsed())
 		{
-			// Display the picture according to the emulation mode display
-			if (Is_High_Resolution_Enabled) DisplayDrawFullSizeBuffer(Shared_Buffer_Display);
-			else DisplayDrawHalfSizeBuffer(Shared_Buffer_Display);
+			// Display only one tick out of INTERPRETER_TURBO_SPEED_FACTOR in turbo mode, so the display is still refreshed at 60Hz
+			if (Interpreter_Is_Turbo_Enabled && (Interpreter_Turbo_Skipped_Frames_Count > 0))
+			{
+				Interpreter_Turbo_Skipped_Frames_Count--;
+				InterpreterPlatformClearTick();
+			}
+			else
+			{
+				// Display the picture according to the emulation mode display
+				InterpreterDrawFrameBuffer();
 
-			Is_Rendering_Needed = 0;
-			NCO_CLEAR_TICK_INTERRUPT_FLAG(); // The interrupt flag must be manually cleared
+				Interpreter_Is_Rendering_Needed = 0;
+				InterpreterPlatformClearTick(); // The tick flag must be manually cleared
 
-			// Wait the configured delay (if any)
-			for (unsigned char i = 0; i < Interpreter_Rendering_Delay; i++) __delay_ms(1);
+				// Wait the configured delay (if any), the turbo mode does not need it
+				if (Interpreter_Is_Turbo_Enabled) Interpreter_Turbo_Skipped_Frames_Count = INTERPRETER_TURBO_SPEED_FACTOR - 1;
+				else InterpreterPlatformWaitMilliseconds(Interpreter_Rendering_Delay);
+			}
 		}
 
-		continue; // Useless here but the compiler does not accept a label followed by no code
+		// Do not burn power when the program is waiting, the slice has already been stopped and the end of the frame has already been waited for when the game speed is regulated
+		if (Interpreter_Execution_State == INTERPRETER_EXECUTION_STATE_IDLE)
+		{
+			if ((Interpreter_Instructions_Per_Frame == 0) || Interpreter_Is_Turbo_Enabled)
+			{
+				InterpreterPlatformClearTick(); // The flag may still be set from a previous tick if no rendering was needed, discard it to really wait for the next one (the rendering, if any, will be done at the next tick)
+				InterpreterWaitForTick();
+			}
+			Interpreter_Execution_State = INTERPRETER_EXECUTION_STATE_RUNNING;
+		}
+
+		#if INTERPRETER_IS_BENCHMARK_ENABLED == 1
+			// The slice time includes the rendering and the waiting, like the game experiences them
+			Interpreter_Benchmark_Duration += (unsigned short) (InterpreterPlatformReadTimeCounter() - Benchmark_Slice_Start_Time);
+
+			// Stop the program when it has run long enough
+			if ((Interpreter_Benchmark_Maximum_Instructions_Count != 0) && (Interpreter_Benchmark_Instructions_Count >= Interpreter_Benchmark_Maximum_Instructions_Count)) break;
+		#endif
 	}
 
-Invalid_Instruction:
-	LOG(INTERPRETER_IS_LOGGING_ENABLED, "Invalid instruction 0x%02X%02X at address 0x%03X. Stopping interpreter.", Instruction_High_Byte, Instruction_Low_Byte, Interpreter_Register_PC);
-	memset(Shared_Buffer_Display, 0, sizeof(Shared_Buffer_Display));
-	snprintf(Shared_Buffers.String_Temporary, sizeof(Shared_Buffers.String_Temporary), LocalizedStringGet(LOCALIZED_STRING_ID_INTERPRETER_MESSAGE_INVALID_INSTRUCTION_CONTENT), Instruction_High_Byte, Instruction_Low_Byte, Interpreter_Register_PC);
-	DisplayDrawTextMessage(Shared_Buffer_Display, LocalizedStringGet(LOCALIZED_STRING_ID_INTERPRETER_MESSAGE_ERROR_TITLE), Shared_Buffers.String_Temporary);
-	while (!KeyboardIsMenuKeyPressed());
+Exit:
+	// Restore the normal tick frequency, the menu and the next game expect it
+	InterpreterSetTurboMode(0);
+
+	#if INTERPRETER_IS_INPUT_STREAM_ENABLED == 1
+		InterpreterInputStreamStop();
+	#endif
+
+	#if INTERPRETER_IS_IDLE_STATISTICS_ENABLED == 1
+		LOG(1, "Idle mode was entered %lu times for %lu us, saving %lu instruction cycles.", Interpreter_Idle_Mode_Entries_Count, Interpreter_Idle_Mode_Duration, Interpreter_Idle_Mode_Duration * INTERPRETER_INSTRUCTION_CYCLES_PER_MICROSECOND);
+	#endif
+	#if INTERPRETER_IS_PROFILER_ENABLED == 1
+		InterpreterProfilerSendCounters();
+	#endif
+	#if INTERPRETER_IS_BENCHMARK_ENABLED == 1
+		InterpreterBenchmarkSendReport();
+	#endif
+	#if INTERPRETER_IS_COST_MEASUREMENT_ENABLED == 1
+		InterpreterCostMeasurementSendDurations();
+	#endif
+	#if INTERPRETER_IS_PC_SAMPLING_ENABLED == 1
+		Interpreter_Is_PC_Sampling_Enabled = 0;
+		InterpreterPCSamplingSendHistogram();
+	#endif
 
-	return 1;
+	// The error message has already been displayed by the instruction handler
+	if (Interpreter_Execution_State == INTERPRETER_EXECUTION_STATE_ERROR)
+	{
+		#if INTERPRETER_IS_TRACE_BUFFER_ENABLED == 1
+			InterpreterTraceBufferSend();
+		#endif
+		return 1;
+	}
 
-Exit_Success:
 	// Make sure any played sound is immediately stopped
-	SoundStop();
+	InterpreterPlatformStopSound();
 
 	return 0;
 }
+
+unsigned char InterpreterGetDisplayRowOffset(void)
+{
+	return Interpreter_Display_Row_Offset;
+}
+
+#if INTERPRETER_IS_PC_SAMPLING_ENABLED == 1
+	void InterpreterSampleProgramCounter(void)
+	{
+		unsigned short Address;
+		unsigned char Bucket_Index;
+
+		if (!Interpreter_Is_PC_Sampling_Enabled) return;
+
+		// The program counter already points to the instruction following the executing one, this does not matter much with the histogram granularity (the value can also be torn if the interrupt occurred while it was being written, mask it to stay in the histogram bounds)
+		Address = Interpreter_Register_PC & 0x0FFF;
+		if (Address < INTERPRETER_PROGRAM_ENTRY_POINT) return;
+		Bucket_Index = (unsigned char) ((Address - INTERPRETER_PROGRAM_ENTRY_POINT) / INTERPRETER_PC_SAMPLING_BUCKET_SIZE);
+
+		if (Interpreter_PC_Sampling_Histogram[Bucket_Index] != 0xFFFF) Interpreter_PC_Sampling_Histogram[Bucket_Index]++;
+	}
+#endif
@@ -0,0 +1,270 @@
+/** @file Interpreter_Platform.c
+ * Implement the interpreter platform services with the console peripherals. See Interpreter_Platform.h for description.
+ * @author Adrien RICCIARDI
+ */
+#include <Display.h>
+#include <EEPROM.h>
+#include <FAT.h>
+#include <Interpreter_Platform.h>
+#include <Keyboard.h>
+#include <Localized_String.h>
+#include <Log.h>
+#include <NCO.h>
+#include <SD_Card.h>
+#include <Serial_Port.h>
+#include <Shared_Buffer.h>
+#include <Sound.h>
+#include <string.h>
+#include <xc.h>
+
+//-------------------------------------------------------------------------------------------------
+// Private constants
+//-------------------------------------------------------------------------------------------------
+/** Set to 1 to enable the log messages, set to 0 to disable them. */
+#define INTERPRETER_PLATFORM_IS_LOGGING_ENABLED 1
+
+/** The byte sent to the serial port to ask the host script for the next input stream byte (the ASCII ENQ character, it can't be confused with the log messages). */
+#define INTERPRETER_PLATFORM_INPUT_STREAM_REQUEST_CHARACTER 0x05
+
+//-------------------------------------------------------------------------------------------------
+// Public functions
+//-------------------------------------------------------------------------------------------------
+void InterpreterPlatformInitialize(void)
+{
+	// Enable the peripheral module
+	PMD1bits.TMR6MD = 0;
+
+	// Use timer 6 as the Chip-8 delay timer
+	T6CLK = 0x09; // Clock the timer by the NCO module
+	T6HLT = 0xA8; // Prescaler output is synchronized with Fosc/4, also synchronize the ON bit with the timer clock input, select the one-shot mode with one-shot operation and software start
+	T6CON = 0; // Do not enable the timer yet, do not enable any prescaler or postscaler (the timer is already clocked at the desired frequency)
+
+	#if INTERPRETER_IS_BENCHMARK_ENABLED == 1
+		// Make the timer 0 count microseconds continuously (the log timing functions can't be used at the same time)
+		PMD1bits.TMR0MD = 0;
+		T0CON1 = 0x44; // Use Fosc/4 as clock source, synchronize to Fosc/4, use a 1:16 prescaler
+		T0CON0 = 0x90; // Enable the timer, select the 16-bit mode, do not use a postscaler
+	#endif
+}
+
+unsigned char InterpreterPlatformIsTickElapsed(void)
+{
+	return NCO_IS_TICK_ELAPSED();
+}
+
+void InterpreterPlatformClearTick(void)
+{
+	NCO_CLEAR_TICK_INTERRUPT_FLAG();
+}
+
+void InterpreterPlatformWaitForTick(void)
+{
+	// Disable the interrupts to make sure that the tick interrupt can't be served between the flag check and the sleep instruction, a pending interrupt wakes the CPU up even if the interrupts are disabled
+	INTCON0bits.GIE = 0;
+	if (!NCO_IS_TICK_ELAPSED())
+	{
+		CPUDOZEbits.IDLEN = 1; // Do not stop the peripherals clock
+		SLEEP();
+	}
+	INTCON0bits.GIE = 1; // Serve the interrupt that woke the CPU up
+}
+
+#if INTERPRETER_IS_BENCHMARK_ENABLED == 1
+	unsigned short InterpreterPlatformReadTimeCounter(void)
+	{
+		unsigned short Counter;
+
+		// Read TMR0L first to latch the value in TMR0H
+		Counter = TMR0L;
+		Counter |= (unsigned short) (TMR0H << 8);
+
+		return Counter;
+	}
+#endif
+
+void InterpreterPlatformSetTickSpeedFactor(unsigned char Speed_Factor)
+{
+	// The delay and sound timers are clocked by the NCO, they keep their current count so no timer is lost when changing the speed
+	NCOConfigure(NCO_TICK_FREQUENCY_INTERPRETER * Speed_Factor); // The resulting value must fit in 16 bits
+}
+
+void InterpreterPlatformWaitMilliseconds(unsigned char Milliseconds)
+{
+	unsigned char i;
+
+	for (i = 0; i < Milliseconds; i++) __delay_ms(1); // The delay macro needs a constant value
+}
+
+void InterpreterPlatformSetDelayTimer(unsigned char Delay)
+{
+	T6CONbits.ON = 0; // Stop the timer in case it is already running
+	T6PR = Delay; // The timer will stop incrementing when the TMR register value will become equal to the PR register value
+	T6TMR = 0;
+	T6CONbits.ON = 1;
+}
+
+unsigned char InterpreterPlatformGetDelayTimer(void)
+{
+	if (T6CONbits.ON == 0) return 0; // When the timer has overflowed, the counter register is reset and the ON bit is cleared
+	return T6PR - T6TMR; // The hardware timer is incrementing while the Chip-8 timer is expected to decrement
+}
+
+void InterpreterPlatformPlaySound(unsigned char Duration)
+{
+	SoundPlay(Duration);
+}
+
+void InterpreterPlatformStopSound(void)
+{
+	SoundStop();
+}
+
+unsigned char InterpreterPlatformGetRandomSeed(void)
+{
+	// Use the timer feeding the sound PWM generation, which is always running
+	return T2TMR;
+}
+
+unsigned char InterpreterPlatformReadKeysMask(void)
+{
+	return KeyboardReadKeysMask();
+}
+
+unsigned char InterpreterPlatformIsMenuKeyPressed(void)
+{
+	return KeyboardIsMenuKeyPressed();
+}
+
+unsigned char InterpreterPlatformIsMenuKeyHeld(void)
+{
+	return KeyboardIsMenuKeyHeld();
+}
+
+void InterpreterPlatformWaitForMenuKeyRelease(void)
+{
+	while (KeyboardIsMenuKeyHeld());
+	__delay_ms(20);
+	KeyboardIsMenuKeyPressed();
+}
+
+void InterpreterPlatformDrawFrameBuffer(unsigned char Is_High_Resolution_Enabled, unsigned char Is_Second_Plane_Enabled, const TDisplayDirtyColumns *Pointer_Dirty_Pages, unsigned char Row_Offset)
+{
+	unsigned char *Pointer_Second_Plane;
+
+	// The display is monochrome, so the pixels lit only in the second plane are displayed half-lit
+	if (Is_Second_Plane_Enabled) Pointer_Second_Plane = Shared_Buffers.Interpreter_Display_Second_Plane;
+	else Pointer_Second_Plane = NULL;
+
+	// Update the pixels before scrolling the display, so the rows exposed by a scrolling are never displayed with their previous content
+	if (Is_High_Resolution_Enabled)
+	{
+		DisplayDrawFullSizePageBuffer(Shared_Buffer_Display, Pointer_Second_Plane, Pointer_Dirty_Pages);
+		DisplaySetStartLine(Row_Offset);
+	}
+	else
+	{
+		DisplayDrawHalfSizePageBuffer(Shared_Buffer_Display, Pointer_Second_Plane, Pointer_Dirty_Pages);
+		DisplaySetStartLine(Row_Offset * 2); // A frame buffer row is displayed on two display rows
+	}
+}
+
+void InterpreterPlatformDisplayErrorMessage(const char *Pointer_String_Message)
+{
+	memset(Shared_Buffer_Display, 0, sizeof(Shared_Buffer_Display));
+	DisplayDrawTextMessage(Shared_Buffer_Display, LocalizedStringGet(LOCALIZED_STRING_ID_INTERPRETER_MESSAGE_ERROR_TITLE), Pointer_String_Message);
+	while (!KeyboardIsMenuKeyPressed());
+}
+
+unsigned char InterpreterPlatformReadFlagRegister(unsigned char Index)
+{
+	return EEPROMReadByte(EEPROM_ADDRESS_INTERPRETER_FLAG_REGISTER_0 + Index);
+}
+
+void InterpreterPlatformWriteFlagRegister(unsigned char Index, unsigned char Value)
+{
+	EEPROMWriteByte(EEPROM_ADDRESS_INTERPRETER_FLAG_REGISTER_0 + Index, Value);
+}
+
+unsigned char InterpreterPlatformLoadProgramFile(char *Pointer_String_File_Name, unsigned char *Pointer_Buffer, unsigned short Maximum_Size, unsigned short *Pointer_Loaded_Size)
+{
+	unsigned char Result;
+	TFATFileInformation File_Information;
+	TFATFileDescriptor File_Descriptor;
+
+	// Begin listing the files
+	if (FATListStart("/") != 0)
+	{
+		LOG(INTERPRETER_PLATFORM_IS_LOGGING_ENABLED, "FATListStart() failed.");
+		return 1;
+	}
+
+	// Search for the game ROM file
+	while (1)
+	{
+		Result = FATListNext(&File_Information);
+		if (Result != 0) break;
+		LOG(INTERPRETER_PLATFORM_IS_LOGGING_ENABLED, "File found : name=\"%s\", is directory=%u, size=%lu, first cluster=%lu.",
+			File_Information.String_Short_Name,
+			File_Information.Is_Directory,
+			File_Information.Size,
+			File_Information.First_Cluster_Number);
+
+		// Do not take directories into account
+		if (File_Information.Is_Directory)
+		{
+			LOG(INTERPRETER_PLATFORM_IS_LOGGING_ENABLED, "This is a directory, skipping it.");
+			continue;
+		}
+
+		// Is this the searched file ?
+		if (strcmp((char *) File_Information.String_Short_Name, Pointer_String_File_Name) == 0)
+		{
+			LOG(INTERPRETER_PLATFORM_IS_LOGGING_ENABLED, "Found the game file, loading it.");
+			break;
+		}
+	}
+	// Was the file found ?
+	if (Result != 0)
+	{
+		LOG(INTERPRETER_PLATFORM_IS_LOGGING_ENABLED, "Error : could not find the game file, stopping.");
+		return 1;
+	}
+
+	// Load the file
+	FATReadSectorsStart(&File_Information, &File_Descriptor);
+	if (FATReadSectorsNext(&File_Descriptor, (unsigned char) (Maximum_Size / SD_CARD_BLOCK_SIZE), Pointer_Buffer) > 1)
+	{
+		LOG(INTERPRETER_PLATFORM_IS_LOGGING_ENABLED, "Error : failed to load the program from the file named \"%s\".", File_Information.String_Short_Name);
+		return 1;
+	}
+
+	// The whole sectors are read, so the buffer end may contain bytes following the file content
+	if (File_Information.Size < Maximum_Size) *Pointer_Loaded_Size = (unsigned short) File_Information.Size;
+	else *Pointer_Loaded_Size = Maximum_Size;
+
+	return 0;
+}
+
+#if INTERPRETER_IS_INPUT_STREAM_ENABLED == 1
+	unsigned char InterpreterPlatformOpenInputStream(unsigned char Is_Replay_Enabled)
+	{
+		// The FAT driver can only read files, so the stream goes through the serial port, which is always configured
+		return 0;
+	}
+
+	void InterpreterPlatformWriteInputStreamByte(unsigned char Data)
+	{
+		SerialPortWriteByte(Data);
+	}
+
+	unsigned char InterpreterPlatformReadInputStreamByte(void)
+	{
+		// There is not enough RAM to buffer the stream, so request each byte from the host script when it is needed (the UART reception FIFO would overflow otherwise)
+		SerialPortWriteByte(INTERPRETER_PLATFORM_INPUT_STREAM_REQUEST_CHARACTER);
+		return SerialPortReadByte();
+	}
+
+	void InterpreterPlatformCloseInputStream(void)
+	{
+	}
+#endif
@@ -0,0 +1,94 @@
+/** @file Interpreter_Tuning_Database.c
+ * See Interpreter_Tuning_Database.h for description. This file is generated by the Tools/Tuning_Database.py script, do not edit it.
+ * @author Adrien RICCIARDI
+ */
+#include <Interpreter_Tuning_Database.h>
+
+//-------------------------------------------------------------------------------------------------
+// Public variables
+//-------------------------------------------------------------------------------------------------
+const TInterpreterTuningDatabaseEntry Interpreter_Tuning_Database[] =
+{
+	// SD_Card_Demos/CH8EMULG.CH8
+	{ 0xF4772A60UL, 288, INTERPRETER_TUNING_DATABASE_SETTING_FAST_RENDERING, 0, 0 },
+	// SD_Card_Demos/CH8PICT.CH8
+	{ 0x27C24208UL, 164, INTERPRETER_TUNING_DATABASE_SETTING_FAST_RENDERING, 0, 0 },
+	// SD_Card_Demos/FISHIE.CH8
+	{ 0x71B8DD56UL, 160, INTERPRETER_TUNING_DATABASE_SETTING_FAST_RENDERING, 0, 0 },
+	// SD_Card_Demos/IBMLOGO.CH8
+	{ 0x9E083BA1UL, 132, INTERPRETER_TUNING_DATABASE_SETTING_FAST_RENDERING, 0, 0 },
+	// SD_Card_Demos/MORSE.CH8
+	{ 0x2625658FUL, 371, INTERPRETER_TUNING_DATABASE_SETTING_FAST_RENDERING, 0, 0 },
+	// SD_Card_Demos/OCTOJA10.CH8
+	{ 0x4FB61316UL, 1890, INTERPRETER_TUNING_DATABASE_SETTING_FAST_RENDERING, 0, 0 },
+	// SD_Card_Demos/OCTOJAM1.CH8
+	{ 0x998DB672UL, 426, INTERPRETER_TUNING_DATABASE_SETTING_FAST_RENDERING | INTERPRETER_TUNING_DATABASE_SETTING_DISPLAY_WRAPPING, 0, 0 },
+	// SD_Card_Demos/OCTOJAM3.CH8
+	{ 0xFF0AD231UL, 402, INTERPRETER_TUNING_DATABASE_SETTING_FAST_RENDERING, 0, 0 },
+	// SD_Card_Demos/OCTOJAM4.CH8
+	{ 0xFE98675CUL, 472, INTERPRETER_TUNING_DATABASE_SETTING_FAST_RENDERING, 0, 0 },
+	// SD_Card_Demos/OCTOJAM6.CH8
+	{ 0xFA169200UL, 1316, INTERPRETER_TUNING_DATABASE_SETTING_FAST_RENDERING, 0, 0 },
+	// SD_Card_Demos/OCTOJAM7.CH8
+	{ 0x15BE1390UL, 1784, INTERPRETER_TUNING_DATABASE_SETTING_FAST_RENDERING, 0, 0 },
+	// SD_Card_Demos/OCTOJAM8.CH8
+	{ 0xCAABBF7DUL, 444, INTERPRETER_TUNING_DATABASE_SETTING_FAST_RENDERING, 0, 0 },
+	// SD_Card_Demos/OCTOJAM9.CH8
+	{ 0x0102FE62UL, 690, INTERPRETER_TUNING_DATABASE_SETTING_FAST_RENDERING, 0, 0 },
+	// SD_Card_Demos/SIERPINS.CH8
+	{ 0x58429B4CUL, 521, INTERPRETER_TUNING_DATABASE_SETTING_FAST_RENDERING, 0, 0 },
+	// SD_Card_Games/3DVIPMAZ.SC8
+	{ 0x0DA3D3FEUL, 3554, INTERPRETER_TUNING_DATABASE_SETTING_FAST_RENDERING, 0, 0 },
+	// SD_Card_Games/ANT.SC8
+	{ 0x7491DE48UL, 3196, INTERPRETER_TUNING_DATABASE_SETTING_FAST_RENDERING, 3, 0 },
+	// SD_Card_Games/BLITZ.CH8
+	{ 0x49E5336BUL, 391, INTERPRETER_TUNING_DATABASE_SETTING_FAST_RENDERING, 0, 0 },
+	// SD_Card_Games/BLKRNBOW.CH8
+	{ 0xF2944FB8UL, 3302, INTERPRETER_TUNING_DATABASE_SETTING_FAST_RENDERING, 0, 0 },
+	// SD_Card_Games/CAVERN.CH8
+	{ 0x7350A842UL, 3226, INTERPRETER_TUNING_DATABASE_SETTING_FAST_RENDERING, 0, 0 },
+	// SD_Card_Games/CLOSTRO.CH8
+	{ 0x4B12409CUL, 3504, INTERPRETER_TUNING_DATABASE_SETTING_FAST_RENDERING | INTERPRETER_TUNING_DATABASE_SETTING_SHIFT_USING_VY, 0, 0 },
+	// SD_Card_Games/ENTRMINE.SC8
+	{ 0x6E767F84UL, 3423, INTERPRETER_TUNING_DATABASE_SETTING_FAST_RENDERING | INTERPRETER_TUNING_DATABASE_SETTING_MEMORY_LOAD_STORE_INCREMENT, 3, 0 },
+	// SD_Card_Games/GLITGHST.CH8
+	{ 0xE7443714UL, 2907, INTERPRETER_TUNING_DATABASE_SETTING_FAST_RENDERING, 0, 0 },
+	// SD_Card_Games/GOLF.CH8
+	{ 0x0330AD82UL, 2624, INTERPRETER_TUNING_DATABASE_SETTING_FAST_RENDERING | INTERPRETER_TUNING_DATABASE_SETTING_DISPLAY_WRAPPING | INTERPRETER_TUNING_DATABASE_SETTING_MEMORY_LOAD_STORE_INCREMENT | INTERPRETER_TUNING_DATABASE_SETTING_SHIFT_USING_VY, 0, 0 },
+	// SD_Card_Games/HIDDEN.CH8
+	{ 0xBB6A4258UL, 850, INTERPRETER_TUNING_DATABASE_SETTING_FAST_RENDERING, 0, 0 },
+	// SD_Card_Games/HORSJUMP.SC8
+	{ 0x7A0DFD8EUL, 326, INTERPRETER_TUNING_DATABASE_SETTING_FAST_RENDERING, 0, 0 },
+	// SD_Card_Games/LABYRINE.CH8
+	{ 0x261F0A49UL, 2858, INTERPRETER_TUNING_DATABASE_SETTING_FAST_RENDERING, 0, 0 },
+	// SD_Card_Games/LASERDEF.CH8
+	{ 0x3E0B30EDUL, 1572, INTERPRETER_TUNING_DATABASE_SETTING_FAST_RENDERING, 0, 0 },
+	// SD_Card_Games/OCTOGON.SC8
+	{ 0x2BD95389UL, 3581, INTERPRETER_TUNING_DATABASE_SETTING_FAST_RENDERING, 0, 0 },
+	// SD_Card_Games/OCTRIS.CH8
+	{ 0xDD13A915UL, 953, INTERPRETER_TUNING_DATABASE_SETTING_FAST_RENDERING, 0, 0 },
+	// SD_Card_Games/OUTLAW.CH8
+	{ 0x0D11B199UL, 522, INTERPRETER_TUNING_DATABASE_SETTING_DISPLAY_WRAPPING, 0, 0 },
+	// SD_Card_Games/RUSHHOUR.CH8
+	{ 0x6BD660B8UL, 3582, INTERPRETER_TUNING_DATABASE_SETTING_FAST_RENDERING, 0, 0 },
+	// SD_Card_Games/SHTH3RD.CH8
+	{ 0x5D70F38EUL, 1242, INTERPRETER_TUNING_DATABASE_SETTING_FAST_RENDERING, 0, 0 },
+	// SD_Card_Games/SNAKE.SC8
+	{ 0xC5CD56A7UL, 1438, INTERPRETER_TUNING_DATABASE_SETTING_FAST_RENDERING, 30, 0 },
+	// SD_Card_Games/SNKSURND.CH8
+	{ 0x99DE4C05UL, 2113, INTERPRETER_TUNING_DATABASE_SETTING_FAST_RENDERING, 0, 0 },
+	// SD_Card_Games/WDL.CH8
+	{ 0xB78BAA31UL, 2935, INTERPRETER_TUNING_DATABASE_SETTING_MEMORY_LOAD_STORE_INCREMENT | INTERPRETER_TUNING_DATABASE_SETTING_SHIFT_USING_VY, 0, 0 },
+	// SD_Card_Games_2/CAVE.CH8
+	{ 0x7F7EAC96UL, 882, INTERPRETER_TUNING_DATABASE_SETTING_FAST_RENDERING, 0, 0 },
+	// SD_Card_Games_2/WORM_V4.CH8
+	{ 0xE294E9E2UL, 677, INTERPRETER_TUNING_DATABASE_SETTING_FAST_RENDERING, 0, 0 },
+	// SD_Card_Tests/CHIPMARK.SC8
+	{ 0x89A059C6UL, 572, INTERPRETER_TUNING_DATABASE_SETTING_FAST_RENDERING, 0, 0 },
+	// SD_Card_Tests/MINIGAME.CH8
+	{ 0x15045028UL, 85, INTERPRETER_TUNING_DATABASE_SETTING_FAST_RENDERING, 0, 0 },
+	// SD_Card_Tests/TANKVPER.CH8
+	{ 0x716E77E6UL, 82, INTERPRETER_TUNING_DATABASE_SETTING_DISPLAY_WRAPPING, 0, 0 },
+};
+
+const unsigned char Interpreter_Tuning_Database_Entries_Count = sizeof(Interpreter_Tuning_Database) / sizeof(Interpreter_Tuning_Database[0]);
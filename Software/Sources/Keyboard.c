@@ -61,6 +61,12 @@ unsigned char KeyboardIsMenuKeyPressed(void)
 	return Is_Pressed;
 }
 
+unsigned char KeyboardIsMenuKeyHeld(void)
+{
+	if (PORTBbits.RB5) return 0; // Key switches are active low
+	return 1;
+}
+
 TKeyboardKey KeyboardWaitForKeys(TKeyboardKey Keys_Mask)
 {
 	unsigned char Read_Keys_Mask;
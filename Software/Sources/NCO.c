@@ -2,9 +2,32 @@
  * See NCO.h for description.
  * @author Adrien RICCIARDI
  */
+#include <Interpreter.h>
 #include <NCO.h>
 #include <xc.h>
 
+//-------------------------------------------------------------------------------------------------
+// Public variables
+//-------------------------------------------------------------------------------------------------
+volatile unsigned char NCO_Is_Tick_Elapsed = 0;
+
+//-------------------------------------------------------------------------------------------------
+// Private functions
+//-------------------------------------------------------------------------------------------------
+/** Interrupt handler for the NCO overflow. */
+static void __interrupt(irq(NCO1), high_priority) NCOInterrupt(void)
+{
+	// Keep the tick state until the user clears it
+	NCO_Is_Tick_Elapsed = 1;
+
+	#if INTERPRETER_IS_PC_SAMPLING_ENABLED == 1
+		InterpreterSampleProgramCounter();
+	#endif
+
+	// Clear the interrupt flag
+	PIR4bits.NCO1IF = 0;
+}
+
 //-------------------------------------------------------------------------------------------------
 // Public functions
 //-------------------------------------------------------------------------------------------------
@@ -15,6 +38,10 @@ void NCOInitialize(void)
 
 	// Use MFINTOSC/4 (31.25KHz) to clock the module
 	NCO1CLK = 0x04;
+
+	// Enable the interrupt, the interrupt handler only sets the tick flag
+	PIR4bits.NCO1IF = 0; // Make sure the interrupt flag is cleared to avoid triggering a false interrupt
+	PIE4bits.NCO1IE = 1;
 }
 
 void NCOConfigure(unsigned short Tick_Frequency)
@@ -0,0 +1,118 @@
+#!/usr/bin/env python3
+# Measure the interpreter speed and print the results as CSV, so they can be stored and compared from a release to another.
+# Host mode (default) : run the benchmark ROMs with the interpreter host runner (build it with "make host" in the Software directory) for a fixed amount of instructions.
+# Console mode (-s option) : decode the benchmark reports sent by a firmware built with "make benchmark", each report is sent when a game exits (the game is automatically stopped after 1000000 instructions).
+# Capture the serial port output to a file while running the games (for instance with "cat /dev/ttyUSB0 > Capture.txt" after having configured the port with stty), the serial port can also be directly provided if it is already configured.
+# The game speed regulation is disabled in host mode, make sure to also set InstructionsPerFrame=0 in the console configuration file to measure the raw interpreter speed.
+# The -r option adds the speed of runners built with each ROM translated to C by Tools/Recompiler.py, this is the speed the interpreter core could reach without fetching, decoding and dispatching the instructions.
+import os
+import subprocess
+import sys
+import tempfile
+
+Script_Directory = os.path.dirname(os.path.abspath(__file__))
+Programs_Directory = os.path.join(Script_Directory, "..", "Programs")
+Default_Runner = os.path.join(Script_Directory, "..", "Software", "Binaries", "Chip8_Console_Host")
+Recompiler = os.path.join(Script_Directory, "Recompiler.py")
+
+# The ROMs making the benchmark suite : the dedicated benchmarks, then some drawing-intensive demos and games that run without any key being pressed
+Benchmark_ROMs = [
+	"SD_Card_Tests/BENCHMRK.CH8",
+	"SD_Card_Tests/CHIPMARK.SC8",
+	"SD_Card_Tests/SCROLTST.SC8",
+	"SD_Card_Demos/OCTOJAM2.CH8",
+	"SD_Card_Demos/PARTICLE.CH8",
+	"SD_Card_Demos/TRIP8.CH8",
+	"SD_Card_Demos/ZERO.CH8",
+	"SD_Card_Games/ENTRMINE.SC8",
+	"SD_Card_Games/OCTOGON.SC8"
+]
+# How many instructions each ROM executes in host mode (the console firmware uses the same value)
+Instructions_Count = 1000000
+# Stop the programs that wait for a key after this amount of emulated ticks
+Maximum_Ticks_Count = 36000
+# Keep the fastest of several runs, to filter out the host scheduling noise
+Default_Repetitions_Count = 3
+
+Report_Prefix = "Benchmark : "
+CSV_Header = "Platform,ROM,Instructions,Duration_Us,Instructions_Per_Second,Instructions_Per_Frame,DRW_Instructions,DRW_Duration_Us,DRW_Time_Percent"
+
+# Convert a benchmark report line to a dictionary of integers (except for the ROM name)
+def Parse_Report(Line):
+	Fields = {}
+	for Field in Line[len(Report_Prefix):].split():
+		Key, Value = Field.split("=", 1)
+		Fields[Key] = Value if Key == "ROM" else int(Value)
+	return Fields
+
+# Format a report as a CSV line with the derived values (a 60Hz frame lasts 16667us)
+def Format_CSV_Line(Platform, ROM_Name, Report):
+	Duration = max(Report["Duration"], 1)
+	Instructions_Per_Second = Report["Instructions"] * 1000000 // Duration
+	DRW_Time_Percent = 100.0 * Report["DRW_Duration"] / Duration
+	return "{},{},{},{},{},{},{},{},{:.1f}".format(Platform, ROM_Name, Report["Instructions"], Report["Duration"], Instructions_Per_Second, Instructions_Per_Second // 60, Report["DRW_Instructions"], Report["DRW_Duration"], DRW_Time_Percent)
+
+# Run a ROM with the host runner and return its benchmark report
+def Run_ROM(Runner, ROM_Path):
+	Command = [ Runner, "-o", "InstructionsPerFrame=0", "-i", str(Instructions_Count), "-t", str(Maximum_Ticks_Count), os.path.join(Programs_Directory, ROM_Path) ]
+	Process = subprocess.run(Command, stdout = subprocess.DEVNULL, stderr = subprocess.PIPE, universal_newlines = True)
+	for Line in Process.stderr.splitlines():
+		if Line.startswith(Report_Prefix): return Parse_Report(Line)
+	print("Error : the ROM " + ROM_Path + " did not produce a benchmark report.", file = sys.stderr)
+	sys.exit(1)
+
+# Keep the fastest report of several runs
+def Run_ROM_Repeatedly(Runner, ROM_Path, Repetitions_Count):
+	Best_Report = None
+	for i in range(Repetitions_Count):
+		Report = Run_ROM(Runner, ROM_Path)
+		if (Best_Report == None) or (Report["Duration"] < Best_Report["Duration"]): Best_Report = Report
+	return Best_Report
+
+# Parse the command line
+Capture_File = None
+Runner = Default_Runner
+Repetitions_Count = Default_Repetitions_Count
+Is_Recompiler_Enabled = False
+Arguments = sys.argv[1:]
+while len(Arguments) > 0:
+	Argument = Arguments.pop(0)
+	if (Argument == "-s") and (len(Arguments) > 0): Capture_File = Arguments.pop(0)
+	elif (Argument == "-n") and (len(Arguments) > 0): Repetitions_Count = max(int(Arguments.pop(0)), 1)
+	elif Argument == "-r": Is_Recompiler_Enabled = True
+	elif Argument.startswith("-"):
+		print("Usage : " + sys.argv[0] + " [-n Repetitions] [-r] [Runner_Path]")
+		print("        " + sys.argv[0] + " -s Capture_File_Or_Serial_Port")
+		sys.exit(1)
+	else: Runner = Argument
+
+print(CSV_Header)
+
+# Console mode, decode the reports as they come (the serial port never ends, use Ctrl+C to stop)
+if Capture_File != None:
+	try:
+		with open(Capture_File, "r", errors = "replace") as File:
+			for Line in File:
+				Offset = Line.find(Report_Prefix)
+				if Offset < 0: continue
+				Report = Parse_Report(Line[Offset:].strip())
+				print(Format_CSV_Line("console", Report["ROM"], Report), flush = True)
+	except KeyboardInterrupt:
+		pass
+	sys.exit(0)
+
+# Host mode, the ROMs are run one after the other so they do not compete for the CPU
+if not os.path.isfile(Runner):
+	print("Error : the host runner \"" + Runner + "\" does not exist, build it with \"make host\" in the Software directory.", file = sys.stderr)
+	sys.exit(1)
+with tempfile.TemporaryDirectory() as Runners_Directory:
+	for ROM_Path in Benchmark_ROMs:
+		print(Format_CSV_Line("host", os.path.basename(ROM_Path), Run_ROM_Repeatedly(Runner, ROM_Path, Repetitions_Count)), flush = True)
+
+		# The recompiled code speed is the ceiling of the interpreter speed
+		if Is_Recompiler_Enabled:
+			Recompiled_Runner = os.path.join(Runners_Directory, os.path.basename(ROM_Path))
+			if subprocess.run([ Recompiler, "build", os.path.join(Programs_Directory, ROM_Path), Recompiled_Runner ], stdout = subprocess.DEVNULL).returncode != 0:
+				print("Error : the ROM " + ROM_Path + " could not be recompiled.", file = sys.stderr)
+				sys.exit(1)
+			print(Format_CSV_Line("host-recompiled", os.path.basename(ROM_Path), Run_ROM_Repeatedly(Recompiled_Runner, ROM_Path, Repetitions_Count)), flush = True)
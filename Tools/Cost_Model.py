@@ -0,0 +1,134 @@
+#!/usr/bin/env python3
+# Predict which games would run too slowly on the console, without having to try them on the console.
+# Step 1 : build the firmware with INTERPRETER_IS_BENCHMARK_ENABLED and INTERPRETER_IS_COST_MEASUREMENT_ENABLED (see Interpreter.h and Interpreter.c), run some games covering all instructions, and capture the serial port output to a file each time a game exits (for instance with "cat /dev/ttyUSB0 > Dump.bin" after having configured the port with stty).
+# Step 2 : "Cost_Model.py build Table_File Dump_File..." averages the measured durations of all dumps and writes the cycles table.
+# Step 3 : "Cost_Model.py report Table_File [Runner_Path]" runs all games and demos with the host runner (build it with "make host" in the Software directory) in cost model mode, and prints a CSV report telling how many frames would overrun the 60Hz tick on the console.
+# The table can also be given to the host runner with the -m option to get the list of the overrunning frames of a single game.
+import concurrent.futures
+import os
+import re
+import statistics
+import subprocess
+import sys
+
+Script_Directory = os.path.dirname(os.path.abspath(__file__))
+Programs_Directory = os.path.join(Script_Directory, "..", "Programs")
+Programs_Subdirectories = [ "SD_Card_Demos", "SD_Card_Games" ]
+Default_Runner = os.path.join(Script_Directory, "..", "Software", "Binaries", "Chip8_Console_Host")
+
+# The instruction names, in the same order than the TInterpreterInstructionID enum (the fused instructions are present only if the firmware has been built with them), followed by the frame buffer transfers
+Entry_Names = [
+	"INVALID", "SCROLL_DOWN (00Cn)", "SCROLL_UP (00Dn)", "CLS (00E0)", "RET (00EE)", "SCROLL_RIGHT (00FB)", "SCROLL_LEFT (00FC)", "EXIT (00FD)", "LOW (00FE)", "HIGH (00FF)",
+	"JP address (1nnn)", "CALL address (2nnn)", "SE Vx, byte (3xkk)", "SNE Vx, byte (4xkk)", "SE Vx, Vy (5xy0)", "SAVE Vx - Vy (5xy2)", "LOAD Vx - Vy (5xy3)", "LD Vx, byte (6xkk)", "ADD Vx, byte (7xkk)",
+	"LD Vx, Vy (8xy0)", "OR Vx, Vy (8xy1)", "AND Vx, Vy (8xy2)", "XOR Vx, Vy (8xy3)", "ADD Vx, Vy (8xy4)", "SUB Vx, Vy (8xy5)", "SHR Vx, Vy (8xy6)", "SUBN Vx, Vy (8xy7)", "SHL Vx, Vy (8xyE)",
+	"SNE Vx, Vy (9xy0)", "LD I, address (Annn)", "JP V0, address (Bnnn)", "RND Vx, byte (Cxkk)", "DRW Vx, Vy, nibble (Dxyn)", "SKP Vx (Ex9E)", "SKNP Vx (ExA1)",
+	"LD I, long address (F000 nnnn)", "PLANE n (Fn01)", "LD Vx, DT (Fx07)", "LD Vx, K (Fx0A)", "LD DT, Vx (Fx15)", "LD ST, Vx (Fx18)", "ADD I, Vx (Fx1E)", "LD F, Vx (Fx29)", "LD HF, Vx (Fx30)", "LD B, Vx (Fx33)",
+	"LD [I], Vx (Fx55)", "LD Vx, [I] (Fx65)", "LD R, Vx (Fx75)", "LD Vx, R (Fx85)",
+	"SE Vx, byte + JP (fused)", "SNE Vx, byte + JP (fused)", "LD Vx, byte + LD Vy, byte (fused)", "LD I + DRW (fused)", "LD I + ADD I, Vx (fused)"
+]
+Display_Entry_Names = [ "DISPLAY_HALF_SIZE", "DISPLAY_FULL_SIZE" ]
+Magic_Number = b"C8CM"
+# How many CPU instruction cycles are executed in one microsecond
+Cycles_Per_Microsecond = 16
+
+# The key script used to play the games (start the game, then move around), the programs are stopped after one minute
+Key_Script = "60:A,66:,120:RIGHT,180:LEFT,240:,300:A,306:,360:UP,420:DOWN,480:,600:B,606:"
+Maximum_Ticks_Count = 3600
+
+# Extract all cost measurement dumps from a capture file and return a list of (count, duration) tuples per dump
+def Read_Dumps(File_Name):
+	with open(File_Name, "rb") as File:
+		Data = File.read()
+
+	Dumps = []
+	Offset = Data.find(Magic_Number)
+	while Offset >= 0:
+		Entries_Count = Data[Offset + len(Magic_Number)]
+		Entries_Offset = Offset + len(Magic_Number) + 1
+		if len(Data) < Entries_Offset + Entries_Count * 8: break # Ignore a truncated dump
+		Entries = []
+		for i in range(Entries_Count):
+			Entry_Offset = Entries_Offset + i * 8
+			Entries.append((int.from_bytes(Data[Entry_Offset:Entry_Offset + 4], "little"), int.from_bytes(Data[Entry_Offset + 4:Entry_Offset + 8], "little")))
+		Dumps.append(Entries)
+		Offset = Data.find(Magic_Number, Entries_Offset + Entries_Count * 8)
+	return Dumps
+
+# Average the measurements and write the cycles table
+def Build_Table(Table_File_Name, Dump_File_Names):
+	# Sum the measurements of all dumps
+	Counts = None
+	for Dump_File_Name in Dump_File_Names:
+		for Entries in Read_Dumps(Dump_File_Name):
+			if Counts == None:
+				Counts = [ 0 ] * len(Entries)
+				Durations = [ 0 ] * len(Entries)
+			elif len(Entries) != len(Counts):
+				print("Error : the dumps have been made by different firmware builds.")
+				sys.exit(1)
+			for i in range(len(Entries)):
+				Counts[i] += Entries[i][0]
+				Durations[i] += Entries[i][1]
+	if Counts == None:
+		print("Error : no complete cost measurement dump was found.")
+		sys.exit(1)
+
+	# Convert the average durations to cycles, the last two entries are the frame buffer transfers
+	Instructions_Count = len(Counts) - 2
+	Names = Entry_Names[:Instructions_Count] + [ "64x32 frame buffer transfer", "128x64 frame buffer transfer" ]
+	Cycles = [ round(Durations[i] * Cycles_Per_Microsecond / Counts[i]) if Counts[i] > 0 else None for i in range(len(Counts)) ]
+
+	# The instructions that were never executed (or that can't be measured, like LD Vx, K) get the median cost of the measured ones
+	Measured_Cycles = [ Value for Value in Cycles[:Instructions_Count] if Value != None ]
+	Default_Cycles = round(statistics.median(Measured_Cycles)) if len(Measured_Cycles) > 0 else 0
+
+	with open(Table_File_Name, "w") as File:
+		File.write("# Console cycles table generated by Cost_Model.py from " + str(sum(Counts)) + " measurements\n")
+		File.write("# Entry Cycles # Name, executions count\n")
+		for i in range(len(Counts)):
+			Entry = Display_Entry_Names[i - Instructions_Count] if i >= Instructions_Count else str(i)
+			if Cycles[i] == None: File.write("{} {} # {}, not measured (median value)\n".format(Entry, Default_Cycles, Names[i]))
+			else: File.write("{} {} # {}, {}\n".format(Entry, Cycles[i], Names[i], Counts[i]))
+	print("Wrote the cycles of " + str(len(Measured_Cycles)) + " measured instructions to " + Table_File_Name + ".")
+
+# Run a ROM in cost model mode and return the report values
+def Run_ROM(Runner, Table_File_Name, ROM_Path):
+	Command = [ Runner, "-m", Table_File_Name, "-t", str(Maximum_Ticks_Count), "-k", Key_Script, os.path.join(Programs_Directory, ROM_Path) ]
+	Process = subprocess.run(Command, stdout = subprocess.PIPE, stderr = subprocess.DEVNULL, universal_newlines = True)
+	Frames = re.search(r"^Modelled frames : (\d+) \((\d+) overrun\)$", Process.stdout, re.MULTILINE)
+	Speed = re.search(r"^Modelled speed : (\d+) instructions per second, ([\d.]+) frames per second$", Process.stdout, re.MULTILINE)
+	if (Frames == None) or (Speed == None): return None
+	return int(Frames.group(1)), int(Frames.group(2)), int(Speed.group(1)), float(Speed.group(2))
+
+# Predict the speed of all games and demos
+def Report(Table_File_Name, Runner):
+	if not os.path.isfile(Runner):
+		print("Error : the host runner \"" + Runner + "\" does not exist, build it with \"make host\" in the Software directory.")
+		sys.exit(1)
+
+	ROM_Paths = []
+	for Subdirectory in Programs_Subdirectories:
+		for File_Name in sorted(os.listdir(os.path.join(Programs_Directory, Subdirectory))):
+			if File_Name.upper().endswith((".CH8", ".SC8")): ROM_Paths.append(Subdirectory + "/" + File_Name)
+
+	# Each runner process has its own interpreter instance, so the ROMs can be run in parallel
+	with concurrent.futures.ThreadPoolExecutor(max_workers = os.cpu_count()) as Executor:
+		Futures = { ROM_Path: Executor.submit(Run_ROM, Runner, Table_File_Name, ROM_Path) for ROM_Path in ROM_Paths }
+		Results = { ROM_Path: Future.result() for ROM_Path, Future in Futures.items() }
+
+	print("ROM,Frames,Overrun_Frames,Overrun_Percent,Instructions_Per_Second,Frames_Per_Second")
+	for ROM_Path in ROM_Paths:
+		if Results[ROM_Path] == None:
+			print(ROM_Path + ",error,,,,")
+			continue
+		Frames, Overrun_Frames, Instructions_Per_Second, Frames_Per_Second = Results[ROM_Path]
+		Overrun_Percent = 100.0 * Overrun_Frames / Frames if Frames > 0 else 0.0
+		print("{},{},{},{:.1f},{},{:.1f}".format(ROM_Path, Frames, Overrun_Frames, Overrun_Percent, Instructions_Per_Second, Frames_Per_Second))
+
+# Parse the command line
+if (len(sys.argv) >= 4) and (sys.argv[1] == "build"): Build_Table(sys.argv[2], sys.argv[3:])
+elif (len(sys.argv) in [ 3, 4 ]) and (sys.argv[1] == "report"): Report(sys.argv[2], sys.argv[3] if len(sys.argv) == 4 else Default_Runner)
+else:
+	print("Usage : " + sys.argv[0] + " build Table_File Dump_File [Dump_File...]")
+	print("        " + sys.argv[0] + " report Table_File [Runner_Path]")
+	sys.exit(1)
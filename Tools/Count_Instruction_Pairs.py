@@ -0,0 +1,64 @@
+#!/usr/bin/env python3
+# Count how often each pair of consecutive instructions appears in the Chip-8 and SuperChip-8 ROM images, in order to choose the instruction pairs the interpreter fuses.
+# The ROM images are scanned statically : each 16-bit word located at an even offset from the program entry point is considered as an instruction, so data bytes are counted too (they add some noise but do not change the most frequent pairs).
+import os
+import sys
+
+# Convert an instruction to its mnemonic, using the same names as the interpreter instruction IDs
+def Get_Instruction_Name(Instruction):
+	Class = Instruction >> 12
+	Low_Byte = Instruction & 0xFF
+	Low_Nibble = Instruction & 0x0F
+
+	if Class == 0x0:
+		if (Low_Byte & 0xF0) == 0xC0: return "SCROLL_DOWN"
+		if (Low_Byte & 0xF0) == 0xD0: return "SCROLL_UP"
+		Names = { 0xE0: "CLS", 0xEE: "RET", 0xFB: "SCROLL_RIGHT", 0xFC: "SCROLL_LEFT", 0xFD: "EXIT", 0xFE: "LOW", 0xFF: "HIGH" }
+		return Names.get(Low_Byte, "INVALID")
+	if (Class == 0x5) and (Low_Nibble in [ 0x2, 0x3 ]): return "SAVE_VX_VY" if Low_Nibble == 0x2 else "LOAD_VX_VY"
+	if Class == 0x8:
+		Names = { 0x0: "LD_VX_VY", 0x1: "OR_VX_VY", 0x2: "AND_VX_VY", 0x3: "XOR_VX_VY", 0x4: "ADD_VX_VY", 0x5: "SUB_VX_VY", 0x6: "SHR_VX_VY", 0x7: "SUBN_VX_VY", 0xE: "SHL_VX_VY" }
+		return Names.get(Low_Nibble, "INVALID")
+	if Class == 0xE:
+		Names = { 0x9E: "SKP_VX", 0xA1: "SKNP_VX" }
+		return Names.get(Low_Byte, "INVALID")
+	if Class == 0xF:
+		if Instruction == 0xF000: return "LD_I_LONG_ADDRESS"
+		if Low_Byte == 0x01: return "PLANE"
+		Names = { 0x07: "LD_VX_DT", 0x0A: "LD_VX_K", 0x15: "LD_DT_VX", 0x18: "LD_ST_VX", 0x1E: "ADD_I_VX", 0x29: "LD_F_VX", 0x30: "LD_HF_VX", 0x33: "LD_B_VX", 0x55: "LD_MEMORY_I_VX", 0x65: "LD_VX_MEMORY_I", 0x75: "LD_R_VX", 0x85: "LD_VX_R" }
+		return Names.get(Low_Byte, "INVALID")
+	Names = [ "", "JP_ADDRESS", "CALL_ADDRESS", "SE_VX_BYTE", "SNE_VX_BYTE", "SE_VX_VY", "LD_VX_BYTE", "ADD_VX_BYTE", "", "SNE_VX_VY", "LD_I_ADDRESS", "JP_V0_ADDRESS", "RND_VX_BYTE", "DRW_VX_VY_NIBBLE" ]
+	return Names[Class]
+
+if len(sys.argv) < 2:
+	print("Usage : " + sys.argv[0] + " Programs_Directory [Displayed_Pairs_Count]")
+	print("All .CH8 and .SC8 files found in the directory and its subdirectories are analyzed.")
+	sys.exit(1)
+Programs_Directory = sys.argv[1]
+Displayed_Pairs_Count = int(sys.argv[2]) if len(sys.argv) > 2 else 30
+
+# Scan all ROM files
+Pairs_Count = {}
+Instructions_Count = 0
+Files_Count = 0
+for Directory, _, File_Names in os.walk(Programs_Directory):
+	for File_Name in sorted(File_Names):
+		if not File_Name.upper().endswith((".CH8", ".SC8")): continue
+		with open(os.path.join(Directory, File_Name), "rb") as File:
+			Data = File.read()
+		Files_Count += 1
+
+		Previous_Name = None
+		for Offset in range(0, len(Data) - 1, 2):
+			Name = Get_Instruction_Name((Data[Offset] << 8) | Data[Offset + 1])
+			Instructions_Count += 1
+			# Pairs containing an invalid instruction are data, they can't be fused
+			if (Previous_Name != None) and (Previous_Name != "INVALID") and (Name != "INVALID"):
+				Pair = Previous_Name + " + " + Name
+				Pairs_Count[Pair] = Pairs_Count.get(Pair, 0) + 1
+			Previous_Name = Name
+
+# Display the most frequent pairs
+print("Analyzed " + str(Files_Count) + " files containing " + str(Instructions_Count) + " instructions.")
+for Pair, Count in sorted(Pairs_Count.items(), key = lambda Item: Item[1], reverse = True)[:Displayed_Pairs_Count]:
+	print("{:>6} ({:5.2f}%) : {}".format(Count, Count * 100 / Instructions_Count, Pair))
@@ -0,0 +1,86 @@
+#!/usr/bin/env python3
+# Record a game session on the console or with the host runner, then replay it exactly, so the interpreter speed can be compared from a firmware build to another on the same session.
+# The firmware must be built with INTERPRETER_IS_INPUT_STREAM_ENABLED (the "benchmark" makefile target enables it), the mode is selected by the InputStream key of the game configuration : 1 to record, 2 to replay.
+# Recording on the console : capture the serial port output to a file while playing (for instance with "cat /dev/ttyUSB0 > Capture.bin" after having configured the port with stty), then run "Input_Stream.py extract Capture.bin Stream.bin".
+# Replaying on the console : run "Input_Stream.py replay /dev/ttyUSB0 Stream.bin" before starting the game, the console asks for each stream byte when it needs it.
+# The host runner reads and writes the same stream files with its -R and -P options.
+import sys
+
+Magic_Number = b"C8IS"
+End_Marker = 0xFF
+Request_Character = 0x05
+Key_Names = [ "D", "C", "B", "A", "RIGHT", "LEFT", "DOWN", "UP" ] # The TKeyboardKey bits, starting from bit 0
+
+# Return the length of the complete stream starting at the beginning of the data, or 0 if the stream is truncated
+def Get_Stream_Length(Data):
+	Offset = len(Magic_Number) + 1
+	while Offset + 2 <= len(Data):
+		Offset += 2
+		if Data[Offset - 2] == End_Marker: return Offset
+	return 0
+
+# Extract the last complete stream from a serial port capture
+def Extract(Capture_File_Name, Stream_File_Name):
+	with open(Capture_File_Name, "rb") as File:
+		Data = File.read()
+
+	Stream = None
+	Offset = Data.find(Magic_Number)
+	while Offset >= 0:
+		Length = Get_Stream_Length(Data[Offset:])
+		if Length > 0: Stream = Data[Offset:Offset + Length]
+		Offset = Data.find(Magic_Number, Offset + len(Magic_Number))
+	if Stream == None:
+		print("Error : no complete input stream was found.")
+		sys.exit(1)
+
+	with open(Stream_File_Name, "wb") as File:
+		File.write(Stream)
+	print("Wrote a " + str(len(Stream)) + "-byte input stream to " + Stream_File_Name + ".")
+
+# Send the stream bytes one at a time, each time the console asks for one (the log messages the console may send are ignored)
+def Replay(Serial_Port, Stream_File_Name):
+	with open(Stream_File_Name, "rb") as File:
+		Stream = File.read()
+
+	print("Waiting for the console to start the game...")
+	with open(Serial_Port, "r+b", buffering = 0) as Port:
+		Offset = 0
+		while Offset < len(Stream):
+			Byte = Port.read(1)
+			if (len(Byte) == 0) or (Byte[0] != Request_Character): continue
+			Port.write(Stream[Offset:Offset + 1])
+			Offset += 1
+	print("The whole input stream has been replayed.")
+
+# Print the stream content in a readable way
+def Show(Stream_File_Name):
+	with open(Stream_File_Name, "rb") as File:
+		Stream = File.read()
+	if (not Stream.startswith(Magic_Number)) or (Get_Stream_Length(Stream) == 0):
+		print("Error : the file is not a complete input stream.")
+		sys.exit(1)
+
+	print("Random seed : 0x{:02X}".format(Stream[len(Magic_Number)]))
+	Frame = -1
+	Keys_Mask = 0
+	Offset = len(Magic_Number) + 1
+	while Stream[Offset] != End_Marker:
+		Frame += Stream[Offset] + 1
+		# Do not display the events that only make the frames count progress
+		if Stream[Offset + 1] != Keys_Mask:
+			Keys_Mask = Stream[Offset + 1]
+			Keys = [ Key_Names[i] for i in range(8) if Keys_Mask & (1 << i) ]
+			print("Frame {} : {}".format(Frame, "+".join(Keys) if len(Keys) > 0 else "no key"))
+		Offset += 2
+	print("The replay stops at frame " + str(Frame) + ".")
+
+# Parse the command line
+if (len(sys.argv) == 4) and (sys.argv[1] == "extract"): Extract(sys.argv[2], sys.argv[3])
+elif (len(sys.argv) == 4) and (sys.argv[1] == "replay"): Replay(sys.argv[2], sys.argv[3])
+elif (len(sys.argv) == 3) and (sys.argv[1] == "show"): Show(sys.argv[2])
+else:
+	print("Usage : " + sys.argv[0] + " extract Capture_File Stream_File")
+	print("        " + sys.argv[0] + " replay Serial_Port Stream_File")
+	print("        " + sys.argv[0] + " show Stream_File")
+	sys.exit(1)
@@ -0,0 +1,100 @@
+#!/usr/bin/env python3
+# Display the disassembly of a Chip-8 or SuperChip-8 ROM annotated with the program counter samples sent by the interpreter (see INTERPRETER_IS_PC_SAMPLING_ENABLED in Interpreter.h).
+# Capture the serial port output to a file while the game is running (for instance with "cat /dev/ttyUSB0 > Dump.bin" after having configured the port with stty), then exit the game with the menu key.
+# The ROM is disassembled linearly, so the data areas are displayed as instructions too.
+import sys
+
+# Convert an instruction to its assembly representation
+def Disassemble_Instruction(Instruction):
+	Class = Instruction >> 12
+	X = (Instruction >> 8) & 0x0F
+	Y = (Instruction >> 4) & 0x0F
+	N = Instruction & 0x0F
+	KK = Instruction & 0xFF
+	NNN = Instruction & 0x0FFF
+
+	if Class == 0x0:
+		if (KK & 0xF0) == 0xC0: return "SCD {}".format(N)
+		if (KK & 0xF0) == 0xD0: return "SCU {}".format(N)
+		Names = { 0xE0: "CLS", 0xEE: "RET", 0xFB: "SCR", 0xFC: "SCL", 0xFD: "EXIT", 0xFE: "LOW", 0xFF: "HIGH" }
+		return Names.get(KK, "DW 0x{:04X}".format(Instruction))
+	if Class == 0x1: return "JP 0x{:03X}".format(NNN)
+	if Class == 0x2: return "CALL 0x{:03X}".format(NNN)
+	if Class == 0x3: return "SE V{:X}, 0x{:02X}".format(X, KK)
+	if Class == 0x4: return "SNE V{:X}, 0x{:02X}".format(X, KK)
+	if (Class == 0x5) and (N == 0): return "SE V{:X}, V{:X}".format(X, Y)
+	if (Class == 0x5) and (N == 2): return "SAVE V{:X} - V{:X}".format(X, Y)
+	if (Class == 0x5) and (N == 3): return "LOAD V{:X} - V{:X}".format(X, Y)
+	if Class == 0x6: return "LD V{:X}, 0x{:02X}".format(X, KK)
+	if Class == 0x7: return "ADD V{:X}, 0x{:02X}".format(X, KK)
+	if Class == 0x8:
+		Names = { 0x0: "LD", 0x1: "OR", 0x2: "AND", 0x3: "XOR", 0x4: "ADD", 0x5: "SUB", 0x6: "SHR", 0x7: "SUBN", 0xE: "SHL" }
+		if N in Names: return "{} V{:X}, V{:X}".format(Names[N], X, Y)
+	if (Class == 0x9) and (N == 0): return "SNE V{:X}, V{:X}".format(X, Y)
+	if Class == 0xA: return "LD I, 0x{:03X}".format(NNN)
+	if Class == 0xB: return "JP V0, 0x{:03X}".format(NNN)
+	if Class == 0xC: return "RND V{:X}, 0x{:02X}".format(X, KK)
+	if Class == 0xD: return "DRW V{:X}, V{:X}, {}".format(X, Y, N)
+	if Class == 0xE:
+		if KK == 0x9E: return "SKP V{:X}".format(X)
+		if KK == 0xA1: return "SKNP V{:X}".format(X)
+	if Class == 0xF:
+		if Instruction == 0xF000: return "LD I, LONG (address in the next word)"
+		if KK == 0x01: return "PLANE {}".format(X)
+		Formats = { 0x07: "LD V{:X}, DT", 0x0A: "LD V{:X}, K", 0x15: "LD DT, V{:X}", 0x18: "LD ST, V{:X}", 0x1E: "ADD I, V{:X}", 0x29: "LD F, V{:X}", 0x30: "LD HF, V{:X}", 0x33: "LD B, V{:X}", 0x55: "LD [I], V{:X}", 0x65: "LD V{:X}, [I]", 0x75: "LD R, V{:X}", 0x85: "LD V{:X}, R" }
+		if KK in Formats: return Formats[KK].format(X)
+	return "DW 0x{:04X}".format(Instruction)
+
+if len(sys.argv) != 3:
+	print("Usage : " + sys.argv[0] + " ROM_File Dump_File_Or_Serial_Port")
+	sys.exit(1)
+Magic_Number = b"C8PS"
+Header_Size = len(Magic_Number) + 4
+
+# Read the data until a full dump is found (the dump can be preceded by log messages)
+Data = b""
+with open(sys.argv[2], "rb") as File:
+	while True:
+		Chunk = File.read(1)
+		if len(Chunk) == 0:
+			print("Error : no complete program counter sampling dump was found.")
+			sys.exit(1)
+		Data += Chunk
+
+		Offset = Data.find(Magic_Number)
+		if (Offset < 0) or (len(Data) < Offset + Header_Size): continue
+		Buckets_Count = Data[Offset + Header_Size - 1]
+		if len(Data) >= Offset + Header_Size + Buckets_Count * 2: break
+
+# Decode the histogram
+First_Address = Data[Offset + 4] | (Data[Offset + 5] << 8)
+Bucket_Size = Data[Offset + 6]
+Histogram = []
+for i in range(Buckets_Count):
+	Histogram.append(Data[Offset + Header_Size + i * 2] | (Data[Offset + Header_Size + i * 2 + 1] << 8))
+Total = sum(Histogram)
+if Total == 0:
+	print("No sample was recorded.")
+	sys.exit(0)
+
+with open(sys.argv[1], "rb") as File:
+	ROM = File.read()
+
+# Display the hottest areas first
+print("Hotspots :")
+for Bucket_Index in sorted(range(Buckets_Count), key = lambda Index: Histogram[Index], reverse = True)[:10]:
+	if Histogram[Bucket_Index] == 0: break
+	Address = First_Address + Bucket_Index * Bucket_Size
+	print("  0x{:03X}-0x{:03X} : {:>6} samples ({:5.2f}%)".format(Address, Address + Bucket_Size - 1, Histogram[Bucket_Index], Histogram[Bucket_Index] * 100 / Total))
+
+# Display the whole program, with the amount of samples at the beginning of each area
+print()
+print("Disassembly :")
+for Offset in range(0, len(ROM) - 1, 2):
+	Address = First_Address + Offset
+	Bucket_Index = Offset // Bucket_Size
+	if Bucket_Index >= Buckets_Count: break
+	if (Offset % Bucket_Size) == 0: Annotation = "{:>6} {:6.2f}% |".format(Histogram[Bucket_Index], Histogram[Bucket_Index] * 100 / Total)
+	else: Annotation = "{:>16}".format("|")
+	Instruction = (ROM[Offset] << 8) | ROM[Offset + 1]
+	print("{} 0x{:03X}: {:04X}  {}".format(Annotation, Address, Instruction, Disassemble_Instruction(Instruction)))
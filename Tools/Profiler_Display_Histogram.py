@@ -0,0 +1,54 @@
+#!/usr/bin/env python3
+# Display the instruction counters sent by the interpreter profiler (see INTERPRETER_IS_PROFILER_ENABLED in Interpreter.c) as a table sorted by execution count.
+# Capture the serial port output to a file while the game is running (for instance with "cat /dev/ttyUSB0 > Dump.bin" after having configured the port with stty), then exit the game with the menu key.
+# The serial port can also be directly provided if it is already configured.
+import sys
+
+# The instruction names, in the same order than the TInterpreterInstructionID enum (the fused instructions are present only if the firmware has been built with them)
+Instruction_Names = [
+	"INVALID", "SCROLL_DOWN (00Cn)", "SCROLL_UP (00Dn)", "CLS (00E0)", "RET (00EE)", "SCROLL_RIGHT (00FB)", "SCROLL_LEFT (00FC)", "EXIT (00FD)", "LOW (00FE)", "HIGH (00FF)",
+	"JP address (1nnn)", "CALL address (2nnn)", "SE Vx, byte (3xkk)", "SNE Vx, byte (4xkk)", "SE Vx, Vy (5xy0)", "SAVE Vx - Vy (5xy2)", "LOAD Vx - Vy (5xy3)", "LD Vx, byte (6xkk)", "ADD Vx, byte (7xkk)",
+	"LD Vx, Vy (8xy0)", "OR Vx, Vy (8xy1)", "AND Vx, Vy (8xy2)", "XOR Vx, Vy (8xy3)", "ADD Vx, Vy (8xy4)", "SUB Vx, Vy (8xy5)", "SHR Vx, Vy (8xy6)", "SUBN Vx, Vy (8xy7)", "SHL Vx, Vy (8xyE)",
+	"SNE Vx, Vy (9xy0)", "LD I, address (Annn)", "JP V0, address (Bnnn)", "RND Vx, byte (Cxkk)", "DRW Vx, Vy, nibble (Dxyn)", "SKP Vx (Ex9E)", "SKNP Vx (ExA1)",
+	"LD I, long address (F000 nnnn)", "PLANE n (Fn01)", "LD Vx, DT (Fx07)", "LD Vx, K (Fx0A)", "LD DT, Vx (Fx15)", "LD ST, Vx (Fx18)", "ADD I, Vx (Fx1E)", "LD F, Vx (Fx29)", "LD HF, Vx (Fx30)", "LD B, Vx (Fx33)",
+	"LD [I], Vx (Fx55)", "LD Vx, [I] (Fx65)", "LD R, Vx (Fx75)", "LD Vx, R (Fx85)",
+	"SE Vx, byte + JP (fused)", "SNE Vx, byte + JP (fused)", "LD Vx, byte + LD Vy, byte (fused)", "LD I + DRW (fused)", "LD I + ADD I, Vx (fused)"
+]
+Magic_Number = b"C8PH"
+
+if len(sys.argv) != 2:
+	print("Usage : " + sys.argv[0] + " Dump_File_Or_Serial_Port")
+	sys.exit(1)
+
+# Read the data until a full dump is found (the dump can be preceded by log messages)
+Data = b""
+with open(sys.argv[1], "rb") as File:
+	while True:
+		Chunk = File.read(1)
+		if len(Chunk) == 0:
+			print("Error : no complete profiler dump was found.")
+			sys.exit(1)
+		Data += Chunk
+
+		Offset = Data.find(Magic_Number)
+		if (Offset < 0) or (len(Data) < Offset + len(Magic_Number) + 1): continue
+		Counters_Count = Data[Offset + len(Magic_Number)]
+		Counters_Offset = Offset + len(Magic_Number) + 1
+		if len(Data) >= Counters_Offset + Counters_Count * 2: break
+
+# Decode the counters
+Counters = []
+Total = 0
+for i in range(Counters_Count):
+	Counter = Data[Counters_Offset + i * 2] | (Data[Counters_Offset + i * 2 + 1] << 8)
+	Name = Instruction_Names[i] if i < len(Instruction_Names) else "Unknown ID " + str(i)
+	Counters.append((Name, Counter))
+	Total += Counter
+
+# Display the executed instructions, the most frequent first
+print("{:<36} {:>7} {:>7}".format("Instruction", "Count", "Share"))
+for Name, Counter in sorted(Counters, key = lambda Item: Item[1], reverse = True):
+	if Counter == 0: continue
+	Saturated_Marker = " (saturated)" if Counter == 0xFFFF else ""
+	print("{:<36} {:>7} {:>6.2f}%{}".format(Name, Counter, Counter * 100 / Total, Saturated_Marker))
+print("{:<36} {:>7}".format("Total", Total))
@@ -0,0 +1,386 @@
+#!/usr/bin/env python3
+# Statically analyze a Chip-8, SuperChip-8 or XO-CHIP ROM to help writing its CONFIG.INI section, instead of trying the quirk keys one after another on the console.
+# The control-flow graph is built from the entry point (following the jumps, the subroutine calls and the skips), the V registers and I values are propagated through it when they are constant, so the memory ranges written by Fx55 and Fx33 can be compared to the code.
+# The report is printed to the standard error and the proposed INI fragment to the standard output, so "ROM_Analyzer.py Game.ch8 >> CONFIG.INI" appends the fragment (fill in the title and the key bindings afterwards).
+# The quirks are inferred from code patterns that only make sense with one behaviour, each proposed value is printed with the instruction that suggested it, check them by playing the game.
+# Use the -g option to also write the control-flow graph basic blocks to a Graphviz file.
+import os
+import sys
+
+Entry_Point = 0x200
+Memory_Size = 4096
+# The lores screen size, the sprites drawn across an edge by constant coordinates tell the program expects wrapping
+Screen_Width = 64
+Screen_Height = 32
+
+# The instruction names are the interpreter instruction IDs (see TInterpreterInstructionID in Interpreter.c)
+Class_Names = [ None, "JP_ADDRESS", "CALL_ADDRESS", "SE_VX_BYTE", "SNE_VX_BYTE", "SE_VX_VY", "LD_VX_BYTE", "ADD_VX_BYTE", None, "SNE_VX_VY", "LD_I_ADDRESS", "JP_V0_ADDRESS", "RND_VX_BYTE", "DRW_VX_VY_NIBBLE", None, None ]
+Group_0_Names = { 0xE0: "CLS", 0xEE: "RET", 0xFB: "SCROLL_RIGHT", 0xFC: "SCROLL_LEFT", 0xFD: "EXIT", 0xFE: "LOW", 0xFF: "HIGH" }
+Group_8_Names = { 0x0: "LD_VX_VY", 0x1: "OR_VX_VY", 0x2: "AND_VX_VY", 0x3: "XOR_VX_VY", 0x4: "ADD_VX_VY", 0x5: "SUB_VX_VY", 0x6: "SHR_VX_VY", 0x7: "SUBN_VX_VY", 0xE: "SHL_VX_VY" }
+Group_E_Names = { 0x9E: "SKP_VX", 0xA1: "SKNP_VX" }
+Group_F_Names = { 0x01: "PLANE", 0x07: "LD_VX_DT", 0x0A: "LD_VX_K", 0x15: "LD_DT_VX", 0x18: "LD_ST_VX", 0x1E: "ADD_I_VX", 0x29: "LD_F_VX", 0x30: "LD_HF_VX", 0x33: "LD_B_VX", 0x55: "LD_MEMORY_I_VX", 0x65: "LD_VX_MEMORY_I", 0x75: "LD_R_VX", 0x85: "LD_VX_R" }
+Skip_Names = [ "SE_VX_BYTE", "SNE_VX_BYTE", "SE_VX_VY", "SNE_VX_VY", "SKP_VX", "SKNP_VX" ]
+# The instructions that only exist on the SuperChip-8
+Super_Chip_Names = [ "SCROLL_DOWN", "SCROLL_RIGHT", "SCROLL_LEFT", "EXIT", "LOW", "HIGH", "LD_HF_VX", "LD_R_VX", "LD_VX_R" ]
+# The instructions that only exist on the XO-CHIP
+XO_Chip_Names = [ "SCROLL_UP", "SAVE_VX_VY", "LOAD_VX_VY", "LD_I_LONG_ADDRESS", "PLANE" ]
+# The instructions waiting for the next frame, a sprite erased then drawn again without one of them in between flickers
+Frame_Wait_Names = [ "LD_VX_DT", "LD_DT_VX", "LD_VX_K" ]
+
+# Decode the instruction located at the specified address, return its name and its X, Y and low byte fields
+def Decode(Memory, Address):
+	High_Byte, Low_Byte = Memory[Address], Memory[(Address + 1) & 0x0FFF]
+	Class = High_Byte >> 4
+	if Class == 0x0:
+		if (Low_Byte & 0xF0) == 0xC0: Name = "SCROLL_DOWN"
+		elif (Low_Byte & 0xF0) == 0xD0: Name = "SCROLL_UP"
+		else: Name = Group_0_Names.get(Low_Byte, "INVALID")
+		if High_Byte != 0x00: Name = "INVALID"
+	elif Class == 0x5: Name = { 0x0: "SE_VX_VY", 0x2: "SAVE_VX_VY", 0x3: "LOAD_VX_VY" }.get(Low_Byte & 0x0F, "INVALID")
+	elif Class == 0x8: Name = Group_8_Names.get(Low_Byte & 0x0F, "INVALID")
+	elif Class == 0x9: Name = "SNE_VX_VY" if (Low_Byte & 0x0F) == 0 else "INVALID"
+	elif Class == 0xE: Name = Group_E_Names.get(Low_Byte, "INVALID")
+	elif Class == 0xF:
+		# The LD I, long address instruction is followed by the address, the interpreter memory being 4KB only its low 12 bits are used
+		if (High_Byte == 0xF0) and (Low_Byte == 0x00): return "LD_I_LONG_ADDRESS", 0, 0, 0, ((Memory[(Address + 2) & 0x0FFF] << 8) | Memory[(Address + 3) & 0x0FFF]) & 0x0FFF
+		Name = Group_F_Names.get(Low_Byte, "INVALID")
+	else: Name = Class_Names[Class]
+	return Name, High_Byte & 0x0F, Low_Byte >> 4, Low_Byte, ((High_Byte & 0x0F) << 8) | Low_Byte
+
+# Return the size in bytes of the instruction located at the specified address
+def Get_Instruction_Size(Memory, Address):
+	if Decode(Memory, Address)[0] == "LD_I_LONG_ADDRESS": return 4
+	return 2
+
+# Format an instruction for the report
+def Format_Instruction(Memory, Address):
+	return "0x{:03X} {} ({})".format(Address, Decode(Memory, Address)[0], "".join("{:02X}".format(Memory[(Address + i) & 0x0FFF]) for i in range(Get_Instruction_Size(Memory, Address))))
+
+# Return the registers range accessed by the SAVE Vx - Vy and LOAD Vx - Vy instructions
+def Get_Registers_Range(X, Y):
+	return list(range(min(X, Y), max(X, Y) + 1))
+
+# Return the registers an instruction reads (0 to 15 for V0 to VF, 16 for I)
+def Get_Read_Registers(Name, X, Y):
+	if Name in [ "SE_VX_BYTE", "SNE_VX_BYTE", "ADD_VX_BYTE", "SKP_VX", "SKNP_VX", "LD_DT_VX", "LD_ST_VX", "LD_F_VX", "LD_HF_VX" ]: return [ X ]
+	if Name in [ "SE_VX_VY", "SNE_VX_VY", "OR_VX_VY", "AND_VX_VY", "XOR_VX_VY", "ADD_VX_VY", "SUB_VX_VY", "SHR_VX_VY", "SUBN_VX_VY", "SHL_VX_VY" ]: return [ X, Y ]
+	if Name == "LD_VX_VY": return [ Y ]
+	if Name == "JP_V0_ADDRESS": return [ 0 ]
+	if Name == "DRW_VX_VY_NIBBLE": return [ X, Y, 16 ]
+	if Name in [ "ADD_I_VX", "LD_B_VX" ]: return [ X, 16 ]
+	if Name in [ "LD_MEMORY_I_VX", "LD_R_VX" ]: return list(range(X + 1)) + [ 16 ]
+	if Name == "SAVE_VX_VY": return Get_Registers_Range(X, Y) + [ 16 ]
+	if Name in [ "LD_VX_MEMORY_I", "LOAD_VX_VY" ]: return [ 16 ]
+	return []
+
+# Return the registers an instruction writes (0 to 15 for V0 to VF, 16 for I)
+def Get_Written_Registers(Name, X, Y):
+	if Name in [ "LD_VX_BYTE", "ADD_VX_BYTE", "LD_VX_VY", "RND_VX_BYTE", "LD_VX_DT", "LD_VX_K" ]: return [ X ]
+	if Name in [ "OR_VX_VY", "AND_VX_VY", "XOR_VX_VY", "ADD_VX_VY", "SUB_VX_VY", "SHR_VX_VY", "SUBN_VX_VY", "SHL_VX_VY" ]: return [ X, 15 ]
+	if Name == "DRW_VX_VY_NIBBLE": return [ 15 ]
+	if Name in [ "LD_I_ADDRESS", "LD_I_LONG_ADDRESS", "ADD_I_VX", "LD_F_VX", "LD_HF_VX", "LD_MEMORY_I_VX" ]: return [ 16 ]
+	if Name in [ "LD_VX_MEMORY_I", "LD_VX_R" ]: return list(range(X + 1)) + [ 16 ]
+	if Name == "LOAD_VX_VY": return Get_Registers_Range(X, Y)
+	return []
+
+# Return the addresses the program can continue to after an instruction, the subroutine calls are considered to return
+def Get_Successors(Memory, Address, Indirect_Jump_Targets):
+	Name, X, Y, Byte, Address_Operand = Decode(Memory, Address)
+	Next_Address = (Address + Get_Instruction_Size(Memory, Address)) & 0x0FFF
+	if Name in [ "INVALID", "RET", "EXIT" ]: return []
+	if Name == "JP_ADDRESS": return [ Address_Operand ]
+	if Name == "CALL_ADDRESS": return [ Address_Operand, Next_Address ]
+	if Name == "JP_V0_ADDRESS": return Indirect_Jump_Targets.get(Address, [])
+	# The skipped instruction can be the 4-byte LD I, long address one
+	if Name in Skip_Names: return [ Next_Address, (Next_Address + Get_Instruction_Size(Memory, Next_Address)) & 0x0FFF ]
+	return [ Next_Address ]
+
+# Compute the V registers and I values after an instruction, None meaning that the value is not constant
+def Propagate_Values(Memory, Address, Values):
+	Name, X, Y, Byte, Address_Operand = Decode(Memory, Address)
+	Values = list(Values)
+	V_X, V_Y, I = Values[X], Values[Y], Values[16]
+	if Name == "LD_VX_BYTE": Values[X] = Byte
+	elif Name == "ADD_VX_BYTE": Values[X] = None if V_X == None else (V_X + Byte) & 0xFF
+	elif Name == "LD_VX_VY": Values[X] = V_Y
+	elif Name in [ "LD_I_ADDRESS", "LD_I_LONG_ADDRESS" ]: Values[16] = Address_Operand
+	elif Name == "ADD_I_VX": Values[16] = None if (I == None) or (V_X == None) else (I + V_X) & 0x0FFF
+	elif Name in [ "OR_VX_VY", "AND_VX_VY", "XOR_VX_VY", "ADD_VX_VY", "SUB_VX_VY", "SUBN_VX_VY" ] and (V_X != None) and (V_Y != None):
+		Results = { "OR_VX_VY": V_X | V_Y, "AND_VX_VY": V_X & V_Y, "XOR_VX_VY": V_X ^ V_Y, "ADD_VX_VY": V_X + V_Y, "SUB_VX_VY": V_X - V_Y, "SUBN_VX_VY": V_Y - V_X }
+		Values[X] = Results[Name] & 0xFF
+		Values[15] = None
+	else:
+		# The other results depend on the quirks or on the run time state
+		for Register in Get_Written_Registers(Name, X, Y): Values[Register] = None
+	return Values
+
+# Merge the values reaching an instruction from several paths
+def Merge_Values(Values_1, Values_2):
+	return [ Value_1 if Value_1 == Value_2 else None for Value_1, Value_2 in zip(Values_1, Values_2) ]
+
+class Analyzer:
+	def __init__(self, ROM_File_Name):
+		with open(ROM_File_Name, "rb") as File:
+			self.ROM = File.read()
+		self.Memory = bytearray(Memory_Size)
+		self.Memory[Entry_Point:Entry_Point + len(self.ROM)] = self.ROM[:Memory_Size - Entry_Point]
+		self.Indirect_Jump_Targets = {}
+		self.Notes = []
+
+	# Find all instructions reachable from the entry point, and the entry points of the subroutines
+	def Explore(self):
+		self.Instructions = set()
+		self.Subroutines = set()
+		Pending_Addresses = [ Entry_Point ]
+		while len(Pending_Addresses) > 0:
+			Address = Pending_Addresses.pop()
+			if Address in self.Instructions: continue
+			self.Instructions.add(Address)
+			Name, X, Y, Byte, Address_Operand = Decode(self.Memory, Address)
+			if Name == "CALL_ADDRESS": self.Subroutines.add(Address_Operand)
+			# Jump tables are made of jump instructions, follow them as long as they are present
+			if (Name == "JP_V0_ADDRESS") and (Address not in self.Indirect_Jump_Targets):
+				Targets = []
+				while (len(Targets) < 128) and (Decode(self.Memory, (Address_Operand + 2 * len(Targets)) & 0x0FFF)[0] == "JP_ADDRESS"): Targets.append((Address_Operand + 2 * len(Targets)) & 0x0FFF)
+				if len(Targets) == 0:
+					Targets = [ Address_Operand ]
+					self.Notes.append("The indirect jump at " + Format_Instruction(self.Memory, Address) + " does not lead to a jump table, its targets are unknown.")
+				self.Indirect_Jump_Targets[Address] = Targets
+			Pending_Addresses += Get_Successors(self.Memory, Address, self.Indirect_Jump_Targets)
+
+	# Find the instructions belonging to each subroutine, and the registers each one may write (including the subroutines it calls)
+	def Find_Subroutines_Bodies(self):
+		self.Subroutine_Bodies = {}
+		for Subroutine in self.Subroutines:
+			Body = set()
+			Pending_Addresses = [ Subroutine ]
+			while len(Pending_Addresses) > 0:
+				Address = Pending_Addresses.pop()
+				if (Address in Body) or (Address not in self.Instructions): continue
+				Body.add(Address)
+				Name = Decode(self.Memory, Address)[0]
+				if Name == "CALL_ADDRESS": Pending_Addresses.append((Address + 2) & 0x0FFF)
+				else: Pending_Addresses += Get_Successors(self.Memory, Address, self.Indirect_Jump_Targets)
+			self.Subroutine_Bodies[Subroutine] = Body
+
+		self.Subroutine_Written_Registers = { Subroutine: set() for Subroutine in self.Subroutines }
+		Is_Changed = True
+		while Is_Changed:
+			Is_Changed = False
+			for Subroutine, Body in self.Subroutine_Bodies.items():
+				Registers = set()
+				for Address in Body:
+					Name, X, Y, Byte, Address_Operand = Decode(self.Memory, Address)
+					if Name == "CALL_ADDRESS": Registers |= self.Subroutine_Written_Registers.get(Address_Operand, set())
+					else: Registers |= set(Get_Written_Registers(Name, X, Y))
+				if Registers != self.Subroutine_Written_Registers[Subroutine]:
+					self.Subroutine_Written_Registers[Subroutine] = Registers
+					Is_Changed = True
+
+	# Return the control-flow graph edges leaving an instruction when the values are propagated, a call continues after the subroutine so the caller keeps the values the subroutine does not write
+	def Get_Data_Flow_Successors(self, Address, Values):
+		Name, X, Y, Byte, Address_Operand = Decode(self.Memory, Address)
+		if Name == "CALL_ADDRESS":
+			Return_Values = list(Values)
+			for Register in self.Subroutine_Written_Registers.get(Address_Operand, range(17)): Return_Values[Register] = None
+			return [ (Address_Operand, Values), ((Address + 2) & 0x0FFF, Return_Values) ]
+		Successors_Values = Propagate_Values(self.Memory, Address, Values)
+		return [ (Successor, Successors_Values) for Successor in Get_Successors(self.Memory, Address, self.Indirect_Jump_Targets) ]
+
+	# Compute the constant values reaching each instruction
+	def Propagate_Constants(self):
+		self.Values = { Entry_Point: [ 0 ] * 17 }
+		Pending_Addresses = [ Entry_Point ]
+		while len(Pending_Addresses) > 0:
+			Address = Pending_Addresses.pop()
+			for Successor, Values in self.Get_Data_Flow_Successors(Address, self.Values[Address]):
+				if Successor in self.Values:
+					Values = Merge_Values(self.Values[Successor], Values)
+					if Values == self.Values[Successor]: continue
+				self.Values[Successor] = Values
+				Pending_Addresses.append(Successor)
+
+	# Find the memory written by the program, and the code it overwrites
+	def Find_Memory_Writes(self):
+		self.Code_Bytes = set()
+		for Address in self.Instructions: self.Code_Bytes |= { (Address + i) & 0x0FFF for i in range(Get_Instruction_Size(self.Memory, Address)) }
+		self.Self_Modifying_Writes = []
+		self.Unknown_Writes = []
+		for Address in sorted(self.Instructions):
+			Name, X, Y, Byte, Address_Operand = Decode(self.Memory, Address)
+			if Name == "LD_MEMORY_I_VX": Size = X + 1
+			elif Name == "LD_B_VX": Size = 3
+			elif Name == "SAVE_VX_VY": Size = abs(X - Y) + 1
+			else: continue
+			I = self.Values[Address][16]
+			if I == None:
+				self.Unknown_Writes.append(Address)
+				continue
+			Written_Code_Bytes = sorted(self.Code_Bytes & { (I + i) & 0x0FFF for i in range(Size) })
+			if len(Written_Code_Bytes) > 0: self.Self_Modifying_Writes.append((Address, Written_Code_Bytes))
+
+	# Find the instructions that read a register set by an instruction before any other instruction overwrites it, following the paths leaving each instruction of the provided list
+	def Find_Dependent_Reads(self, Start_Addresses, Is_Read_Function, Is_Overwrite_Function):
+		Reads = []
+		for Start_Address in Start_Addresses:
+			Visited_Addresses = set()
+			Pending_Addresses = Get_Successors(self.Memory, Start_Address, self.Indirect_Jump_Targets)
+			while len(Pending_Addresses) > 0:
+				Address = Pending_Addresses.pop()
+				if (Address in Visited_Addresses) or (Address not in self.Instructions): continue
+				Visited_Addresses.add(Address)
+				if Is_Read_Function(Address):
+					Reads.append((Start_Address, Address))
+					break
+				if Is_Overwrite_Function(Address): continue
+				Name, X, Y, Byte, Address_Operand = Decode(self.Memory, Address)
+				# Do not look into the subroutines, they usually start by setting the registers they use
+				if Name == "CALL_ADDRESS": Pending_Addresses.append((Address + 2) & 0x0FFF)
+				else: Pending_Addresses += Get_Successors(self.Memory, Address, self.Indirect_Jump_Targets)
+		return Reads
+
+	# Return how many pixels wide a sprite drawn with a constant I value is, or 0 if the sprite address is not known
+	def Get_Sprite_Width(self, Address, Rows_Count):
+		I = self.Values[Address][16]
+		if I == None: return 0
+		Pixels = 0
+		for Row in range(Rows_Count): Pixels |= self.Memory[(I + Row) & 0x0FFF]
+		Width = 8
+		while (Width > 0) and not (Pixels & (1 << (8 - Width))): Width -= 1
+		return Width
+
+	# Propose the configuration keys values, with the instruction that led to each one
+	def Infer_Configuration(self):
+		Names = { Address: Decode(self.Memory, Address) for Address in self.Instructions }
+		def Find(Function): return [ Address for Address in sorted(self.Instructions) if Function(*Names[Address]) ]
+
+		# The Chip-8 draws nothing with a zero rows count, so a program using it to draw 16x16 sprites is made for the SuperChip-8
+		self.Super_Chip_Instructions = Find(lambda Name, X, Y, Byte, Address_Operand: (Name in Super_Chip_Names) or ((Name == "DRW_VX_VY_NIBBLE") and (Byte & 0x0F == 0)))
+		self.Is_Super_Chip = len(self.Super_Chip_Instructions) > 0
+		self.XO_Chip_Instructions = Find(lambda Name, X, Y, Byte, Address_Operand: Name in XO_Chip_Names)
+		self.Is_XO_Chip = len(self.XO_Chip_Instructions) > 0
+		self.Is_High_Resolution_Used = len(Find(lambda Name, X, Y, Byte, Address_Operand: Name == "HIGH")) > 0
+		self.Large_Sprite_Instructions = Find(lambda Name, X, Y, Byte, Address_Operand: (Name == "DRW_VX_VY_NIBBLE") and (Byte & 0x0F == 0))
+		self.Configuration = {}
+		self.Evidences = {}
+
+		# The XO-CHIP programs are written for Octo, which shifts Vy, increments I and wraps the sprites
+		if self.Is_XO_Chip:
+			for Key in [ "ShiftUsingVy", "MemoryLoadStoreIncrement", "DisplayWrapping" ]:
+				self.Configuration[Key] = 1
+				self.Evidences[Key] = Format_Instruction(self.Memory, self.XO_Chip_Instructions[0]) + " is a XO-CHIP instruction, these programs expect the Octo behaviour"
+		# The SuperChip-8 shifts Vx, does not increment I and does not reset VF, which are the interpreter defaults, and it clips the sprites
+		elif not self.Is_Super_Chip:
+			# The original interpreter shifted Vy into Vx, a program using two different registers expects it
+			Shifts = Find(lambda Name, X, Y, Byte, Address_Operand: (Name in [ "SHR_VX_VY", "SHL_VX_VY" ]) and (X != Y))
+			if len(Shifts) > 0:
+				self.Configuration["ShiftUsingVy"] = 1
+				self.Evidences["ShiftUsingVy"] = Format_Instruction(self.Memory, Shifts[0]) + " shifts another register than the destination one"
+
+			# Loading twice or storing twice through the same I value is pointless, so a program doing it without setting I again expects I to have been incremented (storing the loaded registers back is a read-modify-write that works both ways)
+			Reads = []
+			for Name in [ "LD_MEMORY_I_VX", "LD_VX_MEMORY_I" ]:
+				Loads_Stores = Find(lambda Other_Name, X, Y, Byte, Address_Operand: Other_Name == Name)
+				Reads += self.Find_Dependent_Reads(Loads_Stores, lambda Address: Names[Address][0] == Name, lambda Address: 16 in Get_Written_Registers(Names[Address][0], Names[Address][1], Names[Address][2]) and (Names[Address][0] not in [ "LD_MEMORY_I_VX", "LD_VX_MEMORY_I" ]))
+			if len(Reads) > 0:
+				self.Configuration["MemoryLoadStoreIncrement"] = 1
+				self.Evidences["MemoryLoadStoreIncrement"] = Format_Instruction(self.Memory, Reads[0][1]) + " accesses the memory through I again after " + Format_Instruction(self.Memory, Reads[0][0])
+
+			# A program testing VF after a logical operation expects the operation to have reset it
+			Logical_Operations = Find(lambda Name, X, Y, Byte, Address_Operand: (Name in [ "OR_VX_VY", "AND_VX_VY", "XOR_VX_VY" ]) and (X != 15))
+			Reads = self.Find_Dependent_Reads(Logical_Operations, lambda Address: 15 in Get_Read_Registers(Names[Address][0], Names[Address][1], Names[Address][2]), lambda Address: 15 in Get_Written_Registers(Names[Address][0], Names[Address][1], Names[Address][2]))
+			if len(Reads) > 0:
+				self.Configuration["ResetVF"] = 1
+				self.Evidences["ResetVF"] = Format_Instruction(self.Memory, Reads[0][1]) + " reads VF right after " + Format_Instruction(self.Memory, Reads[0][0])
+
+			# A sprite drawn at constant coordinates across the screen edge is meant to wrap
+			for Address in Find(lambda Name, X, Y, Byte, Address_Operand: Name == "DRW_VX_VY_NIBBLE"):
+				Name, X, Y, Byte, Address_Operand = Names[Address]
+				Coordinate_X, Coordinate_Y = self.Values[Address][X], self.Values[Address][Y]
+				if ((Coordinate_X != None) and (Coordinate_X % Screen_Width > Screen_Width - self.Get_Sprite_Width(Address, Byte & 0x0F))) or ((Coordinate_Y != None) and (Coordinate_Y % Screen_Height > Screen_Height - (Byte & 0x0F))):
+					self.Configuration["DisplayWrapping"] = 1
+					self.Evidences["DisplayWrapping"] = Format_Instruction(self.Memory, Address) + " draws across the screen edge at ({}, {})".format(Coordinate_X, Coordinate_Y)
+					break
+
+		# A sprite erased and drawn again at the same coordinates before the next frame flickers if the frame buffer is transferred after each sprite
+		Sprites = Find(lambda Name, X, Y, Byte, Address_Operand: Name == "DRW_VX_VY_NIBBLE")
+		def Is_Same_Sprite(Address_1, Address_2): return (Names[Address_1][1:3] == Names[Address_2][1:3]) and (self.Values[Address_1][16] == self.Values[Address_2][16])
+		for Address in Sprites:
+			Name, X, Y, Byte, Address_Operand = Names[Address]
+			Redraws = self.Find_Dependent_Reads([ Address ], lambda Read_Address: (Names[Read_Address][0] == "DRW_VX_VY_NIBBLE") and Is_Same_Sprite(Address, Read_Address), lambda Overwrite_Address: (Names[Overwrite_Address][0] in Frame_Wait_Names) or (len({ X, Y } & set(Get_Written_Registers(Names[Overwrite_Address][0], Names[Overwrite_Address][1], Names[Overwrite_Address][2]))) > 0))
+			if len(Redraws) > 0:
+				self.Configuration["FastRendering"] = 1
+				self.Evidences["FastRendering"] = Format_Instruction(self.Memory, Redraws[0][1]) + " draws again the sprite erased by " + Format_Instruction(self.Memory, Address) + " before the next frame"
+				break
+
+	# Write the basic blocks and their edges to a Graphviz file
+	def Write_Graph(self, Graph_File_Name):
+		# A basic block starts at the entry point, at each branch target and after each branch
+		Leaders = { Entry_Point } | self.Subroutines
+		for Address in self.Instructions:
+			Successors = Get_Successors(self.Memory, Address, self.Indirect_Jump_Targets)
+			if Successors != [ (Address + Get_Instruction_Size(self.Memory, Address)) & 0x0FFF ]: Leaders |= set(Successors)
+		Edges = []
+		with open(Graph_File_Name, "w") as File:
+			File.write("digraph ROM {\n\tnode [shape=box, fontname=monospace];\n")
+			for Leader in sorted(Leaders & self.Instructions):
+				Address = Leader
+				Lines = []
+				while True:
+					Lines.append(Format_Instruction(self.Memory, Address))
+					Successors = Get_Successors(self.Memory, Address, self.Indirect_Jump_Targets)
+					if (Successors != [ (Address + Get_Instruction_Size(self.Memory, Address)) & 0x0FFF ]) or (Successors[0] in Leaders): break
+					Address = Successors[0]
+				File.write("\tB{:03X} [label=\"{}\\l\"];\n".format(Leader, "\\l".join(Lines)))
+				Edges += [ (Leader, Successor) for Successor in Successors if Successor in self.Instructions ]
+			for Source, Destination in Edges: File.write("\tB{:03X} -> B{:03X};\n".format(Source, Destination))
+			File.write("}\n")
+
+	def Analyze(self):
+		self.Explore()
+		self.Find_Subroutines_Bodies()
+		self.Propagate_Constants()
+		self.Find_Memory_Writes()
+		self.Infer_Configuration()
+
+	def Print_Report(self, Output):
+		Data_Bytes_Count = len([ Address for Address in range(Entry_Point, Entry_Point + len(self.ROM)) if Address not in self.Code_Bytes ])
+		print("ROM size : {} bytes ({} bytes of code, {} bytes of data).".format(len(self.ROM), len(self.ROM) - Data_Bytes_Count, Data_Bytes_Count), file = Output)
+		print("Control-flow graph : {} instructions, {} subroutines, {} indirect jumps.".format(len(self.Instructions), len(self.Subroutines), len(self.Indirect_Jump_Targets)), file = Output)
+		if self.Is_XO_Chip: print("Platform : XO-CHIP (" + Format_Instruction(self.Memory, self.XO_Chip_Instructions[0]) + ").", file = Output)
+		elif self.Is_Super_Chip: print("Platform : SuperChip-8 (" + Format_Instruction(self.Memory, self.Super_Chip_Instructions[0]) + ").", file = Output)
+		else: print("Platform : Chip-8.", file = Output)
+		print("Resolution : " + ("hires and lores" if self.Is_High_Resolution_Used else "lores") + ".", file = Output)
+		if len(self.Large_Sprite_Instructions) > 0: print("16x16 sprites : drawn by " + Format_Instruction(self.Memory, self.Large_Sprite_Instructions[0]) + ".", file = Output)
+		for Note in self.Notes: print("Note : " + Note, file = Output)
+
+		# The code is safe for aggressive decode caching when nothing can overwrite it
+		for Address, Written_Code_Bytes in self.Self_Modifying_Writes: print("Self-modifying code : " + Format_Instruction(self.Memory, Address) + " overwrites the code from 0x{:03X} to 0x{:03X}.".format(Written_Code_Bytes[0], Written_Code_Bytes[-1]), file = Output)
+		if len(self.Unknown_Writes) > 0: print("Unknown writes : {} store instructions use a computed I value, starting with {}.".format(len(self.Unknown_Writes), Format_Instruction(self.Memory, self.Unknown_Writes[0])), file = Output)
+		if (len(self.Self_Modifying_Writes) == 0) and (len(self.Unknown_Writes) == 0): print("Aggressive decode caching : safe, the code is never written.", file = Output)
+		else: print("Aggressive decode caching : unsafe.", file = Output)
+
+		for Key, Evidence in self.Evidences.items(): print("Proposing {}={} because {}.".format(Key, self.Configuration[Key], Evidence), file = Output)
+
+	def Print_Configuration(self, ROM_File_Name, Output):
+		Name = os.path.splitext(os.path.basename(ROM_File_Name))[0]
+		print("[0]", file = Output)
+		print("Title=" + Name, file = Output)
+		print("ROMFile=" + os.path.basename(ROM_File_Name).upper(), file = Output)
+		for Key, Value in self.Configuration.items(): print("{}={}".format(Key, Value), file = Output)
+
+# Parse the command line
+Graph_File_Name = None
+Arguments = sys.argv[1:]
+if (len(Arguments) == 3) and (Arguments[0] == "-g"):
+	Graph_File_Name = Arguments[1]
+	Arguments = Arguments[2:]
+if len(Arguments) != 1:
+	print("Usage : " + sys.argv[0] + " [-g Graph_File] ROM_File")
+	sys.exit(1)
+
+ROM_Analyzer = Analyzer(Arguments[0])
+ROM_Analyzer.Analyze()
+ROM_Analyzer.Print_Report(sys.stderr)
+ROM_Analyzer.Print_Configuration(Arguments[0], sys.stdout)
+if Graph_File_Name != None: ROM_Analyzer.Write_Graph(Graph_File_Name)
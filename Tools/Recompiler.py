@@ -0,0 +1,368 @@
+#!/usr/bin/env python3
+# Translate a Chip-8 or Super Chip-8 ROM to C, and build a host runner executing the translated code instead of interpreting the program, to know how fast the interpreter core could go without fetching, decoding and dispatching each instruction.
+# "Recompiler.py translate ROM_File C_File" writes the translated program, "Recompiler.py build ROM_File Runner_Path" also builds the host runner with it (see the "recompiled" makefile target in the Software directory).
+# The program is cut into blocks starting at the jump and call targets. A block runs forward until a jump backward, a call, a return, a JP V0, address (Bnnn), a memory write or an instruction that waits for a key, then the interpreter executes the program until it reaches a block again.
+# The blocks execute the instructions exactly like the interpreter does (the fused instructions included) and stop at the end of the slice, so the program behaves the same. A block is disabled when the program modifies its code, it is interpreted from then on.
+import collections
+import os
+import subprocess
+import sys
+import tempfile
+
+Script_Directory = os.path.dirname(os.path.abspath(__file__))
+Software_Directory = os.path.join(Script_Directory, "..", "Software")
+
+Entry_Point = 0x200
+# How many program bytes a block can span from its entry point, the instructions located after are reached by leaving the block
+Maximum_Block_Size = 64
+# The remaining program is interpreted when this amount of blocks has been translated
+Maximum_Blocks_Count = 2048
+
+# The instruction IDs of the single-instruction classes, and of the classes containing several instructions (the IDs are the TInterpreterInstructionID names without the INTERPRETER_INSTRUCTION_ID_ prefix)
+Class_IDs = [ None, "JP_ADDRESS", "CALL_ADDRESS", "SE_VX_BYTE", "SNE_VX_BYTE", "SE_VX_VY", "LD_VX_BYTE", "ADD_VX_BYTE", None, "SNE_VX_VY", "LD_I_ADDRESS", "JP_V0_ADDRESS", "RND_VX_BYTE", "DRW_VX_VY_NIBBLE", None, None ]
+Group_0_IDs = { 0xE0: "CLS", 0xEE: "RET", 0xFB: "SCROLL_RIGHT", 0xFC: "SCROLL_LEFT", 0xFD: "EXIT", 0xFE: "LOW", 0xFF: "HIGH" }
+Group_0_IDs.update({ Low_Byte: "SCROLL_DOWN" for Low_Byte in range(0xC0, 0xD0) })
+Group_0_IDs.update({ Low_Byte: "SCROLL_UP" for Low_Byte in range(0xD0, 0xE0) })
+Group_5_IDs = { 0x0: "SE_VX_VY", 0x2: "SAVE_VX_VY", 0x3: "LOAD_VX_VY" }
+Group_8_IDs = { 0x0: "LD_VX_VY", 0x1: "OR_VX_VY", 0x2: "AND_VX_VY", 0x3: "XOR_VX_VY", 0x4: "ADD_VX_VY", 0x5: "SUB_VX_VY", 0x6: "SHR_VX_VY", 0x7: "SUBN_VX_VY", 0xE: "SHL_VX_VY" }
+Group_E_IDs = { 0x9E: "SKP_VX", 0xA1: "SKNP_VX" }
+Group_F_IDs = { 0x00: "LD_I_LONG_ADDRESS", 0x01: "PLANE", 0x07: "LD_VX_DT", 0x0A: "LD_VX_K", 0x15: "LD_DT_VX", 0x18: "LD_ST_VX", 0x1E: "ADD_I_VX", 0x29: "LD_F_VX", 0x30: "LD_HF_VX", 0x33: "LD_B_VX", 0x55: "LD_MEMORY_I_VX", 0x65: "LD_VX_MEMORY_I", 0x75: "LD_R_VX", 0x85: "LD_VX_R" }
+
+# The instructions that can be fused with the following one by the interpreter
+Fusable_IDs = [ "SE_VX_BYTE", "SNE_VX_BYTE", "LD_VX_BYTE", "LD_I_ADDRESS" ]
+Fused_IDs = [ "SE_VX_BYTE_JP_ADDRESS", "SNE_VX_BYTE_JP_ADDRESS", "LD_VX_BYTE_LD_VY_BYTE", "LD_I_ADDRESS_DRW_VX_VY_NIBBLE", "LD_I_ADDRESS_ADD_I_VX" ]
+# The instructions calling their handler, then continuing in the block
+Continuing_Handler_IDs = [ "SCROLL_DOWN", "SCROLL_UP", "CLS", "SCROLL_RIGHT", "SCROLL_LEFT", "LOW", "HIGH", "RND_VX_BYTE", "DRW_VX_VY_NIBBLE", "LD_VX_DT", "LD_DT_VX", "LD_ST_VX", "LD_VX_MEMORY_I", "LOAD_VX_VY", "PLANE" ]
+# The instructions calling their handler, then leaving the block, with the instruction following them being a new block entry point or not
+Leaving_Handler_IDs = { "INVALID": False, "RET": False, "EXIT": False, "JP_V0_ADDRESS": False, "CALL_ADDRESS": True, "LD_VX_K": True, "LD_B_VX": True, "LD_MEMORY_I_VX": True, "SAVE_VX_VY": True, "LD_R_VX": True, "LD_VX_R": True }
+# The instructions that skip the next instruction, with the C condition telling that the skip happens
+Skip_Conditions = { "SE_VX_BYTE": "{X} == 0x{Byte:02X}", "SNE_VX_BYTE": "{X} != 0x{Byte:02X}", "SE_VX_VY": "{X} == {Y}", "SNE_VX_VY": "{X} != {Y}", "SKP_VX": "InterpreterReadKeysMask() & Interpreter_Keys_Table_From_Interpreter[{X}]", "SKNP_VX": "!(InterpreterReadKeysMask() & Interpreter_Keys_Table_From_Interpreter[{X}])" }
+
+# Stand for the lines storing or loading the registers kept in local variables
+Store_Marker = "@STORE@"
+Load_Marker = "@LOAD@"
+
+# An instruction decoded like InterpreterDecodeInstruction() does it
+Instruction = collections.namedtuple("Instruction", [ "ID", "X", "Y", "Operand", "Opcode", "Size", "Code_Size" ])
+
+# Decode the instruction located at the specified address, return None if the instruction (or the following instruction it may be fused with) is not fully part of the ROM
+def Decode(Program, Address):
+	Offset = Address - Entry_Point
+	if (Offset < 0) or (Offset + 2 > len(Program)): return None
+	High_Byte, Low_Byte = Program[Offset], Program[Offset + 1]
+	X = High_Byte & 0x0F
+	Y = Low_Byte >> 4
+	Operand = (X << 8) | Low_Byte
+	Opcode = (High_Byte << 8) | Low_Byte
+	Class = High_Byte >> 4
+
+	if Class == 0x0: ID = Group_0_IDs.get(Low_Byte, "INVALID")
+	elif Class == 0x5: ID = Group_5_IDs.get(Low_Byte & 0x0F, "SE_VX_VY")
+	elif Class == 0x8: ID = Group_8_IDs.get(Low_Byte & 0x0F, "INVALID")
+	elif Class == 0xE: ID = Group_E_IDs.get(Low_Byte, "INVALID")
+	elif Class == 0xF: ID = Group_F_IDs.get(Low_Byte, "INVALID")
+	else: ID = Class_IDs[Class]
+
+	# The LD I, long address instruction is followed by the address, only its low 12 bits are used because the interpreter memory is 4KB
+	if ID == "LD_I_LONG_ADDRESS":
+		if X != 0: ID = "INVALID"
+		else:
+			if Offset + 4 > len(Program): return None
+			return Instruction(ID, X, Y, ((Program[Offset + 2] << 8) | Program[Offset + 3]) & 0x0FFF, Opcode, 4, 4)
+
+	if ID in [ "SCROLL_DOWN", "SCROLL_UP", "DRW_VX_VY_NIBBLE" ]: Operand = Low_Byte & 0x0F
+	elif ID in [ "SE_VX_BYTE", "SNE_VX_BYTE", "LD_VX_BYTE", "ADD_VX_BYTE", "RND_VX_BYTE" ]: Operand = Low_Byte
+	# A skip instruction reads the next instruction first word to know how many bytes to skip
+	if ID in Skip_Conditions: Code_Size = 4
+	else: Code_Size = 2
+	if ID not in Fusable_IDs: return Instruction(ID, X, Y, Operand, Opcode, 2, Code_Size)
+
+	# The interpreter decision to fuse depends on the next instruction, so its bytes are part of the instruction code even if it is not fused
+	if Offset + 4 > len(Program): return None
+	Next_High_Byte, Next_Low_Byte = Program[Offset + 2], Program[Offset + 3]
+	Next_Class = Next_High_Byte >> 4
+	Size = 4
+	if (Next_Class == 0x1) and (ID in [ "SE_VX_BYTE", "SNE_VX_BYTE" ]):
+		ID += "_JP_ADDRESS"
+		Y = Operand
+		Operand = ((Next_High_Byte & 0x0F) << 8) | Next_Low_Byte
+	elif (Next_Class == 0x6) and (ID == "LD_VX_BYTE"):
+		ID = "LD_VX_BYTE_LD_VY_BYTE"
+		Y = Next_High_Byte & 0x0F
+		Operand |= Next_Low_Byte << 8
+	elif (Next_Class == 0xD) and (ID == "LD_I_ADDRESS"):
+		ID = "LD_I_ADDRESS_DRW_VX_VY_NIBBLE"
+		X = Next_High_Byte & 0x0F
+		Y = Next_Low_Byte >> 4
+		Operand |= (Next_Low_Byte << 12) & 0xFFFF
+	elif (Next_Class == 0xF) and (Next_Low_Byte == 0x1E) and (ID == "LD_I_ADDRESS"):
+		ID = "LD_I_ADDRESS_ADD_I_VX"
+		X = Next_High_Byte & 0x0F
+	else: Size = 2
+	return Instruction(ID, X, Y, Operand, Opcode, Size, 4)
+
+# Tell whether a jump can stay in the block, the interpreter puts the program in idle mode when it jumps to itself or to a loop polling the delay timer, which only happens with backward jumps
+def Get_Jump_Target(Address, Instruction):
+	# The program counter points after the jump instruction when the jump is executed
+	if Instruction.ID == "JP_ADDRESS": Program_Counter = Address + 2
+	else: Program_Counter = Address + 4
+	if (Instruction.Operand <= Address) or (Instruction.Operand == Program_Counter - 2): return None
+	return Instruction.Operand
+
+# Tell where a skip instruction goes when it skips, the LD I, long address instruction (F000 nnnn) is skipped entirely
+def Get_Skip_Target(Program, Address):
+	Offset = Address + 2 - Entry_Point
+	if (Offset + 2 <= len(Program)) and (Program[Offset] == 0xF0) and (Program[Offset + 1] == 0x00): return Address + 6
+	return Address + 4
+
+# Return the addresses the instruction can continue to in the block
+def Get_Successors(Program, Address, Instruction):
+	if Instruction.ID in Skip_Conditions: return [ Address + 2, Get_Skip_Target(Program, Address) ]
+	if Instruction.ID in [ "SE_VX_BYTE_JP_ADDRESS", "SNE_VX_BYTE_JP_ADDRESS", "JP_ADDRESS" ]:
+		Successors = [ Address + 4 ] if Instruction.ID != "JP_ADDRESS" else []
+		if Get_Jump_Target(Address, Instruction) != None: Successors.append(Instruction.Operand)
+		return Successors
+	if Instruction.ID in Leaving_Handler_IDs: return []
+	return [ Address + Instruction.Size ]
+
+# Translate the block starting at the specified address, return the block C function, its code bytes ranges and the entry points of the blocks it leads to
+def Translate_Block(Program, Entry_Address):
+	# Find all instructions reachable from the entry point without leaving the block area, the program can only go forward in a block
+	Instructions = {}
+	Pending_Addresses = [ Entry_Address ]
+	while len(Pending_Addresses) > 0:
+		Address = Pending_Addresses.pop()
+		if Address in Instructions: continue
+		Instructions[Address] = Decode(Program, Address)
+		for Successor in Get_Successors(Program, Address, Instructions[Address]):
+			if (Successor < Entry_Address + Maximum_Block_Size) and (Decode(Program, Successor) != None): Pending_Addresses.append(Successor)
+	Addresses = sorted(Instructions)
+
+	Function_Name = "InterpreterRecompiledBlock{:03X}".format(Entry_Address)
+	Next_Entry_Addresses = []
+	Used_Registers = set()
+	Written_Registers = set()
+	Referenced_Labels = set()
+	Temporary_Variables = set()
+	Bodies = {}
+
+	def Register(Index):
+		Used_Registers.add(Index)
+		return "V{:X}".format(Index)
+
+	def Write_Register(Index):
+		Written_Registers.add(Index)
+		return Register(Index)
+
+	# The registers are kept in local variables, they are written back before a handler is called and read again after (the registers are known only when the whole block has been translated, so the lines are generated at the end)
+	def Store_Lines():
+		return [ Store_Marker ]
+
+	def Load_Lines():
+		return [ Load_Marker ]
+
+	def Expand_Markers(Lines):
+		Expanded_Lines = []
+		for Line in Lines:
+			Indentation = Line[:len(Line) - len(Line.lstrip("\t"))]
+			if Line.strip() == Store_Marker: Expanded_Lines += [ Indentation + "Interpreter_Registers_V[{}] = V{:X};".format(Index, Index) for Index in sorted(Written_Registers) ]
+			elif Line.strip() == Load_Marker: Expanded_Lines += [ Indentation + "V{:X} = Interpreter_Registers_V[{}];".format(Index, Index) for Index in sorted(Used_Registers) ]
+			else: Expanded_Lines.append(Line)
+		return Expanded_Lines
+
+	# Continue to an instruction of the block or leave the block, the program counter must be set only when leaving
+	def Go_To(Current_Address, Target_Address):
+		if Target_Address in Instructions:
+			# The instructions are laid out in address order, the next one does not need a jump
+			if Target_Address == next((Address for Address in Addresses if Address > Current_Address), None): return []
+			Referenced_Labels.add(Target_Address)
+			return [ "goto Label_{:03X};".format(Target_Address) ]
+		Next_Entry_Addresses.append(Target_Address & 0x0FFF)
+		Referenced_Labels.add("Exit")
+		return [ "Interpreter_Register_PC = 0x{:03X};".format(Target_Address), "goto Exit;" ]
+
+	def Handler_Call_Lines(ID, Next_Address, X, Y, Operand):
+		return [ "Interpreter_Register_PC = 0x{:03X};".format(Next_Address), "Interpreter_Instruction_Handlers[INTERPRETER_INSTRUCTION_ID_{}]({}, {}, 0x{:X});".format(ID, X, Y, Operand) ]
+
+	for Address in Addresses:
+		Instruction = Instructions[Address]
+		ID, X, Y, Operand = Instruction.ID, Instruction.X, Instruction.Y, Instruction.Operand
+		Next_Address = Address + Instruction.Size
+		Lines = []
+
+		# Leave the block when the slice is over
+		if Address != Entry_Address:
+			Referenced_Labels.add("Exit")
+			Lines.append("if (Remaining_Instructions_Count == 0) {{ Interpreter_Register_PC = 0x{:03X}; goto Exit; }}".format(Address))
+
+		# Count the instruction like the interpreter does, a fused instruction counts for two instructions except at the end of the slice
+		if ID in Fused_IDs: Lines.append("if (Remaining_Instructions_Count > 1) Remaining_Instructions_Count -= 2; else Remaining_Instructions_Count = 0;")
+		else: Lines.append("Remaining_Instructions_Count--;")
+
+		if ID in Skip_Conditions:
+			Condition = Skip_Conditions[ID].format(X = Register(X), Y = Register(Y) if "{Y}" in Skip_Conditions[ID] else None, Byte = Operand & 0xFF)
+			Lines.append("if ({})".format(Condition))
+			Lines += [ "{" ] + [ "\t" + Line for Line in Go_To(Address, Get_Skip_Target(Program, Address)) ] + [ "}" ]
+			Lines += Go_To(Address, Address + 2)
+		elif ID in [ "SE_VX_BYTE_JP_ADDRESS", "SNE_VX_BYTE_JP_ADDRESS" ]:
+			Condition = "{} {} 0x{:02X}".format(Register(X), "!=" if ID == "SE_VX_BYTE_JP_ADDRESS" else "==", Y)
+			if Get_Jump_Target(Address, Instruction) != None: Jump_Lines = Go_To(Address, Operand)
+			else:
+				Next_Entry_Addresses.append(Operand)
+				Jump_Lines = Store_Lines() + [ "Interpreter_Register_PC = 0x{:03X};".format(Address + 4), "InterpreterExecuteJpAddress(0, 0, 0x{:03X});".format(Operand), "return Remaining_Instructions_Count;" ]
+			Lines.append("if ({})".format(Condition))
+			Lines += [ "{" ] + [ "\t" + Line for Line in Jump_Lines ] + [ "}" ]
+			Lines += Go_To(Address, Address + 4)
+		elif ID == "JP_ADDRESS":
+			if Get_Jump_Target(Address, Instruction) != None: Lines += Go_To(Address, Operand)
+			else:
+				Next_Entry_Addresses.append(Operand)
+				Lines += Store_Lines() + [ "Interpreter_Register_PC = 0x{:03X};".format(Next_Address), "InterpreterExecuteJpAddress(0, 0, 0x{:03X});".format(Operand), "return Remaining_Instructions_Count;" ]
+		elif ID in Leaving_Handler_IDs:
+			if Leaving_Handler_IDs[ID]: Next_Entry_Addresses.append(Next_Address & 0x0FFF)
+			if ID == "CALL_ADDRESS": Next_Entry_Addresses.append(Operand)
+			Lines += Store_Lines() + Handler_Call_Lines(ID, Next_Address, X, Y, Operand) + [ "return Remaining_Instructions_Count;" ]
+		elif ID in Continuing_Handler_IDs + [ "LD_I_ADDRESS_DRW_VX_VY_NIBBLE" ]:
+			if ID == "LD_I_ADDRESS_DRW_VX_VY_NIBBLE":
+				Lines.append("Interpreter_Register_I = 0x{:03X};".format(Operand & 0x0FFF))
+				ID, Operand = "DRW_VX_VY_NIBBLE", Operand >> 12
+			Lines += Store_Lines() + Handler_Call_Lines(ID, Next_Address, X, Y, Operand) + Load_Lines()
+			Lines += Go_To(Address, Next_Address)
+		else:
+			# The remaining instructions are executed without calling their handler
+			if ID == "LD_VX_BYTE": Lines.append("{} = 0x{:02X};".format(Write_Register(X), Operand))
+			elif ID == "ADD_VX_BYTE": Lines.append("{} += 0x{:02X};".format(Write_Register(X), Operand))
+			elif ID == "LD_VX_VY": Lines.append("{} = {};".format(Write_Register(X), Register(Y)))
+			elif ID in [ "OR_VX_VY", "AND_VX_VY", "XOR_VX_VY" ]:
+				Operator = { "OR_VX_VY": "|=", "AND_VX_VY": "&=", "XOR_VX_VY": "^=" }[ID]
+				Lines.append("{} {} {};".format(Write_Register(X), Operator, Register(Y)))
+				Lines.append("if (Interpreter_Is_VF_Reset_Enabled) {} = 0;".format(Write_Register(15)))
+			elif ID == "ADD_VX_VY":
+				Temporary_Variables.add("unsigned short Sum;")
+				Lines.append("Sum = {} + {};".format(Register(X), Register(Y)))
+				Lines.append("{} = (unsigned char) Sum;".format(Write_Register(X)))
+				Lines.append("{} = Sum >> 8;".format(Write_Register(15)))
+			elif ID in [ "SUB_VX_VY", "SUBN_VX_VY" ]:
+				Temporary_Variables.update([ "unsigned char Value_1;", "unsigned char Value_2;" ])
+				Lines.append("Value_1 = {};".format(Register(X)))
+				Lines.append("Value_2 = {};".format(Register(Y)))
+				if ID == "SUB_VX_VY":
+					Lines.append("{} = Value_1 - Value_2;".format(Write_Register(X)))
+					Lines.append("{} = Value_1 >= Value_2;".format(Write_Register(15)))
+				else:
+					Lines.append("{} = Value_2 - Value_1;".format(Write_Register(X)))
+					Lines.append("{} = Value_2 >= Value_1;".format(Write_Register(15)))
+			elif ID in [ "SHR_VX_VY", "SHL_VX_VY" ]:
+				Temporary_Variables.add("unsigned char Value_1;")
+				Lines.append("Value_1 = Interpreter_Is_Shift_Using_Vy_Enabled ? {} : {};".format(Register(Y), Register(X)))
+				if ID == "SHR_VX_VY":
+					Lines.append("{} = Value_1 >> 1;".format(Write_Register(X)))
+					Lines.append("{} = Value_1 & 0x01;".format(Write_Register(15)))
+				else:
+					Lines.append("{} = Value_1 << 1;".format(Write_Register(X)))
+					Lines.append("{} = Value_1 >> 7;".format(Write_Register(15)))
+			elif ID in [ "LD_I_ADDRESS", "LD_I_LONG_ADDRESS" ]: Lines.append("Interpreter_Register_I = 0x{:03X};".format(Operand))
+			elif ID == "ADD_I_VX": Lines.append("Interpreter_Register_I += {};".format(Register(X)))
+			elif ID == "LD_F_VX": Lines.append("Interpreter_Register_I = ({} & 0x0F) * 5;".format(Register(X)))
+			elif ID == "LD_HF_VX": Lines.append("Interpreter_Register_I = (16 * 5) + (({} & 0x0F) * 10);".format(Register(X)))
+			elif ID == "LD_VX_BYTE_LD_VY_BYTE":
+				Lines.append("{} = 0x{:02X};".format(Write_Register(X), Operand & 0xFF))
+				Lines.append("{} = 0x{:02X};".format(Write_Register(Y), Operand >> 8))
+			elif ID == "LD_I_ADDRESS_ADD_I_VX": Lines.append("Interpreter_Register_I = 0x{:03X} + {};".format(Operand, Register(X)))
+			else: raise Exception("Unhandled instruction " + ID)
+			Lines += Go_To(Address, Next_Address)
+
+		Bodies[Address] = Lines
+
+	# Write the function, the registers read or written by the block are loaded first
+	Output = [ "/** Translated block starting at 0x{:03X}. */".format(Entry_Address), "static unsigned short {}(unsigned short Remaining_Instructions_Count)".format(Function_Name), "{" ]
+	if len(Used_Registers) > 0: Output.append("\tunsigned char " + ", ".join("V{:X}".format(Index) for Index in sorted(Used_Registers)) + ";")
+	Output += [ "\t" + Line for Line in sorted(Temporary_Variables) ]
+	if (len(Used_Registers) > 0) or (len(Temporary_Variables) > 0): Output.append("")
+	Output += [ "\t" + Line for Line in Expand_Markers(Load_Lines()) ]
+	for Address in Addresses:
+		Instruction = Instructions[Address]
+		Output.append("")
+		if Address in Referenced_Labels: Output.append("Label_{:03X}:".format(Address))
+		Output.append("\t// 0x{:03X} : 0x{:04X} ({})".format(Address, Instruction.Opcode, Instruction.ID))
+		Output += [ "\t" + Line for Line in Expand_Markers(Bodies[Address]) ]
+	if "Exit" in Referenced_Labels:
+		Output += [ "", "Exit:" ] + [ "\t" + Line for Line in Expand_Markers(Store_Lines()) ] + [ "\treturn Remaining_Instructions_Count;" ]
+	Output.append("}")
+
+	# Merge the code bytes of the instructions
+	Code_Ranges = []
+	for Address in Addresses:
+		End_Address = Address + Instructions[Address].Code_Size
+		if (len(Code_Ranges) > 0) and (Address <= Code_Ranges[-1][1]): Code_Ranges[-1][1] = max(Code_Ranges[-1][1], End_Address)
+		else: Code_Ranges.append([ Address, End_Address ])
+
+	return Function_Name, Output, Code_Ranges, Next_Entry_Addresses
+
+# Translate the whole program and write the C file
+def Translate(ROM_File_Name, C_File_Name):
+	with open(ROM_File_Name, "rb") as File:
+		Program = File.read()
+	if len(Program) > 4096 - Entry_Point:
+		print("Error : the ROM is too big.")
+		sys.exit(1)
+
+	# Follow the program from its entry point, each block tells where the program can go after it
+	Blocks = {}
+	Pending_Addresses = collections.deque([ Entry_Point ])
+	while (len(Pending_Addresses) > 0) and (len(Blocks) < Maximum_Blocks_Count):
+		Address = Pending_Addresses.popleft()
+		if (Address in Blocks) or (Decode(Program, Address) == None): continue
+		Blocks[Address] = Translate_Block(Program, Address)
+		Pending_Addresses.extend(Blocks[Address][3])
+
+	Lines = [ "/** @file " + os.path.basename(C_File_Name), " * The " + os.path.basename(ROM_File_Name) + " program translated to C by Tools/Recompiler.py, Interpreter.c includes it when INTERPRETER_IS_RECOMPILER_ENABLED is set. Translate the program again instead of modifying this file.", " */" ]
+	Lines += [ "#if INTERPRETER_IS_INSTRUCTION_FUSION_ENABLED == 0", "\t#error \"The translated code executes the fused instructions like the interpreter does, the instruction fusion must be enabled.\"", "#endif", "" ]
+
+	# The translated code can be used only if the loaded program is this one
+	Lines.append("/** The translated program bytes. */")
+	Lines.append("static const unsigned char Interpreter_Recompiled_Program[] =")
+	Lines.append("{")
+	for Offset in range(0, len(Program), 16): Lines.append("\t" + " ".join("0x{:02X},".format(Byte) for Byte in Program[Offset:Offset + 16]))
+	Lines += [ "};", "" ]
+
+	for Address in sorted(Blocks): Lines += Blocks[Address][1] + [ "" ]
+
+	Lines.append("/** All translated blocks. */")
+	Lines.append("static const TInterpreterRecompiledBlock Interpreter_Recompiled_Blocks[] =")
+	Lines.append("{")
+	Lines += [ "\t{{ 0x{:03X}, {} }},".format(Address, Blocks[Address][0]) for Address in sorted(Blocks) ]
+	Lines += [ "};", "" ]
+
+	Lines.append("/** The program bytes each block has been built from. */")
+	Lines.append("static const TInterpreterRecompiledCodeRange Interpreter_Recompiled_Code_Ranges[] =")
+	Lines.append("{")
+	for Block_Index, Address in enumerate(sorted(Blocks)):
+		Lines += [ "\t{{ {}, 0x{:03X}, 0x{:03X} }},".format(Block_Index, Start_Address, End_Address) for Start_Address, End_Address in Blocks[Address][2] ]
+	Lines += [ "};" ]
+
+	with open(C_File_Name, "w") as File:
+		File.write("\n".join(Lines) + "\n")
+	print("Translated " + str(len(Blocks)) + " blocks to " + C_File_Name + ".")
+
+# Translate the program, then build the host runner with it
+def Build(ROM_File_Name, Runner_Path):
+	Runner_Path = os.path.abspath(Runner_Path)
+	with tempfile.TemporaryDirectory() as Temporary_Directory:
+		C_File_Name = os.path.join(Temporary_Directory, "Recompiled_Program.c")
+		Translate(ROM_File_Name, C_File_Name)
+		Command = [ "make", "-C", Software_Directory, "recompiled", "RECOMPILED_PROGRAM=" + C_File_Name, "PATH_BINARIES=" + os.path.dirname(Runner_Path), "RECOMPILED_BINARY_NAME=" + os.path.basename(Runner_Path) ]
+		Process = subprocess.run(Command, stdout = subprocess.PIPE, stderr = subprocess.STDOUT, universal_newlines = True)
+	if Process.returncode != 0:
+		print(Process.stdout)
+		print("Error : failed to build the runner.")
+		sys.exit(1)
+	print("Built the runner " + Runner_Path + ".")
+
+# Parse the command line
+if (len(sys.argv) == 4) and (sys.argv[1] == "translate"): Translate(sys.argv[2], sys.argv[3])
+elif (len(sys.argv) == 4) and (sys.argv[1] == "build"): Build(sys.argv[2], sys.argv[3])
+else:
+	print("Usage : " + sys.argv[0] + " translate ROM_File C_File")
+	print("        " + sys.argv[0] + " build ROM_File Runner_Path")
+	sys.exit(1)
@@ -0,0 +1,195 @@
+#!/usr/bin/env python3
+# Run all the games, demos and tests ROMs with the interpreter host runner (build it with "make host" in the Software directory) and compare the frame buffer content at fixed ticks with the stored golden hashes.
+# Each ROM is run with the settings of its CONFIG.INI section and with a key script, the ROMs are run in parallel on all host cores.
+# Use the -u option to record the current results as the new golden hashes, after having checked that an intended change renders correctly.
+# Use the -r option to run each ROM with a runner built with the ROM translated to C by Tools/Recompiler.py instead, the recompiled code must give the same results than the interpreter.
+# Use the -c option to build two runners hashing the virtual machine state after each instruction, one keeping the decoded instructions in the decode cache and one decoding each instruction every time, then to compare their traces on the ROMs stressing the cache. Both runners are built from the current sources, so this only checks the decode cache against the decoder of the same tree : it does not compare the traces with the original switch-based interpreter, which has no host runner (the golden frame hashes were recorded after the decode cache was added, so they do not check against it either).
+import concurrent.futures
+import os
+import subprocess
+import sys
+import tempfile
+
+Script_Directory = os.path.dirname(os.path.abspath(__file__))
+Programs_Directory = os.path.join(Script_Directory, "..", "Programs")
+Programs_Subdirectories = [ "SD_Card_Demos", "SD_Card_Games", "SD_Card_Tests" ]
+Golden_File = os.path.join(Script_Directory, "Regression_Test_Golden.txt")
+Default_Runner = os.path.join(Script_Directory, "..", "Software", "Binaries", "Chip8_Console_Host")
+Recompiler = os.path.join(Script_Directory, "Recompiler.py")
+Software_Directory = os.path.join(Script_Directory, "..", "Software")
+
+# The ROMs whose execution traces must not depend on the decode cache (the benchmarks run many different instructions, the self-modifying code test overwrites instructions that have been decoded)
+Decode_Cache_ROM_Paths = [ "SD_Card_Tests/BENCHMRK.CH8", "SD_Card_Tests/CHIPMARK.SC8", "SD_Card_Games/OCTOGON.SC8", "SD_Card_Tests/SELFMODC.CH8" ]
+
+# The ticks at which the frame buffer is hashed, the program is stopped after the last one
+Frame_Hash_Ticks = [ 60, 300, 900 ]
+# The key script used by the ROMs that do not have a specific one in the golden file (start the game, then move around)
+Default_Key_Script = "60:A,66:,120:RIGHT,180:LEFT,240:,300:A,306:,360:UP,420:DOWN,480:,600:B,606:"
+
+# Run a ROM and return its result line and its frame hashes
+def Run_ROM(Runner, ROM_Path, Key_Script):
+	Command = [ Runner, "-t", str(Frame_Hash_Ticks[-1]), "-f", ",".join(str(Tick) for Tick in Frame_Hash_Ticks) ]
+	if Key_Script != "": Command += [ "-k", Key_Script ]
+	Command.append(os.path.join(Programs_Directory, ROM_Path))
+	try:
+		Process = subprocess.run(Command, stdout = subprocess.PIPE, stderr = subprocess.DEVNULL, timeout = 60, universal_newlines = True)
+	except subprocess.TimeoutExpired:
+		return "timeout", ""
+
+	Result = "unknown"
+	Hashes = []
+	for Line in Process.stdout.splitlines():
+		if Line.startswith("Result : "): Result = Line[len("Result : "):]
+		elif Line.startswith("Frame hash at tick "):
+			Tick, Hash = Line[len("Frame hash at tick "):].split(" : ")
+			Hashes.append(Tick + ":" + Hash)
+	return Result, " ".join(Hashes)
+
+# Build a runner with the ROM translated to C, then run the ROM with it
+def Run_Recompiled_ROM(Runners_Directory, ROM_Path, Key_Script):
+	Runner = os.path.join(Runners_Directory, ROM_Path.replace("/", "_"))
+	Process = subprocess.run([ Recompiler, "build", os.path.join(Programs_Directory, ROM_Path), Runner ], stdout = subprocess.DEVNULL, stderr = subprocess.DEVNULL)
+	if Process.returncode != 0: return "recompilation failed", ""
+	return Run_ROM(Runner, ROM_Path, Key_Script)
+
+# Run a ROM with a traced runner and return its result and the trace hashes it printed
+def Run_Traced_ROM(Runner, ROM_Path, Key_Script):
+	Command = [ Runner, "-t", str(Frame_Hash_Ticks[-1]) ]
+	if Key_Script != "": Command += [ "-k", Key_Script ]
+	Command.append(os.path.join(Programs_Directory, ROM_Path))
+	try:
+		Process = subprocess.run(Command, stdout = subprocess.PIPE, stderr = subprocess.DEVNULL, timeout = 600, universal_newlines = True)
+	except subprocess.TimeoutExpired:
+		return "timeout", []
+
+	Result = "unknown"
+	Hashes = []
+	for Line in Process.stdout.splitlines():
+		if Line.startswith("Result : "): Result = Line[len("Result : "):]
+		elif Line.startswith("Trace hash at instruction "):
+			Instructions_Count, Hash = Line[len("Trace hash at instruction "):].split(" : ")
+			Hashes.append((int(Instructions_Count), Hash))
+	return Result, Hashes
+
+# Build the traced runners with and without the decode cache, then compare their traces
+def Compare_Decode_Cache_Traces(Key_Scripts):
+	with tempfile.TemporaryDirectory() as Runners_Directory:
+		Runners = []
+		for Decode_Cache in [ "1", "0" ]:
+			Runner_Name = "Chip8_Console_Host_Traced_" + Decode_Cache
+			Command = [ "make", "-C", Software_Directory, "traced", "DECODE_CACHE=" + Decode_Cache, "PATH_BINARIES=" + Runners_Directory, "TRACED_BINARY_NAME=" + Runner_Name ]
+			Process = subprocess.run(Command, stdout = subprocess.PIPE, stderr = subprocess.STDOUT, universal_newlines = True)
+			if Process.returncode != 0:
+				print(Process.stdout)
+				print("Error : failed to build the traced runner.")
+				sys.exit(1)
+			Runners.append(os.path.join(Runners_Directory, Runner_Name))
+
+		with concurrent.futures.ThreadPoolExecutor(max_workers = os.cpu_count()) as Executor:
+			Futures = { (ROM_Path, Runner): Executor.submit(Run_Traced_ROM, Runner, ROM_Path, Key_Scripts[ROM_Path]) for ROM_Path in Decode_Cache_ROM_Paths for Runner in Runners }
+			Results = { Key: Future.result() for Key, Future in Futures.items() }
+
+	# The traces are compared at each printed hash, so the first differing instructions can be located
+	Failures_Count = 0
+	for ROM_Path in Decode_Cache_ROM_Paths:
+		Cached_Result, Cached_Hashes = Results[(ROM_Path, Runners[0])]
+		Uncached_Result, Uncached_Hashes = Results[(ROM_Path, Runners[1])]
+		if (Cached_Result != Uncached_Result) or (len(Cached_Hashes) == 0):
+			print("FAIL " + ROM_Path + " : got " + Cached_Result + " with the decode cache and " + Uncached_Result + " without it")
+			Failures_Count += 1
+			continue
+
+		Previous_Instructions_Count = 0
+		for Cached_Hash, Uncached_Hash in zip(Cached_Hashes, Uncached_Hashes):
+			if Cached_Hash != Uncached_Hash:
+				print("FAIL " + ROM_Path + " : the traces differ between the instructions " + str(Previous_Instructions_Count + 1) + " and " + str(Cached_Hash[0]))
+				Failures_Count += 1
+				break
+			Previous_Instructions_Count = Cached_Hash[0]
+		else:
+			if len(Cached_Hashes) != len(Uncached_Hashes):
+				print("FAIL " + ROM_Path + " : the traces have different lengths")
+				Failures_Count += 1
+			else: print("PASS " + ROM_Path + " (" + str(Cached_Hashes[-1][0]) + " instructions)")
+
+	print(str(len(Decode_Cache_ROM_Paths) - Failures_Count) + "/" + str(len(Decode_Cache_ROM_Paths)) + " ROMs have the same traces with and without the decode cache.")
+	if Failures_Count > 0: sys.exit(1)
+	sys.exit(0)
+
+# Parse the command line
+Is_Update_Enabled = False
+Is_Recompiler_Enabled = False
+Is_Decode_Cache_Comparison_Enabled = False
+Runner = Default_Runner
+for Argument in sys.argv[1:]:
+	if Argument == "-u": Is_Update_Enabled = True
+	elif Argument == "-r": Is_Recompiler_Enabled = True
+	elif Argument == "-c": Is_Decode_Cache_Comparison_Enabled = True
+	elif Argument.startswith("-"):
+		print("Usage : " + sys.argv[0] + " [-u] [Runner_Path]")
+		print("        " + sys.argv[0] + " -r")
+		print("        " + sys.argv[0] + " -c")
+		sys.exit(1)
+	else: Runner = Argument
+if Is_Update_Enabled and (Is_Recompiler_Enabled or Is_Decode_Cache_Comparison_Enabled):
+	print("Error : the golden results can only be recorded by the interpreter.")
+	sys.exit(1)
+if (not Is_Recompiler_Enabled) and (not Is_Decode_Cache_Comparison_Enabled) and (not os.path.isfile(Runner)):
+	print("Error : the host runner \"" + Runner + "\" does not exist, build it with \"make host\" in the Software directory.")
+	sys.exit(1)
+
+# Load the golden results, each line contains the ROM path, the key script, the expected result and the expected hashes separated by '|'
+Golden_Results = {}
+if os.path.isfile(Golden_File):
+	with open(Golden_File, "r") as File:
+		for Line in File:
+			Line = Line.strip()
+			if (Line == "") or Line.startswith("#"): continue
+			ROM_Path, Key_Script, Result, Hashes = Line.split("|")
+			Golden_Results[ROM_Path] = (Key_Script, Result, Hashes)
+
+# Find all ROMs
+ROM_Paths = []
+for Subdirectory in Programs_Subdirectories:
+	for File_Name in sorted(os.listdir(os.path.join(Programs_Directory, Subdirectory))):
+		if File_Name.upper().endswith((".CH8", ".SC8")): ROM_Paths.append(Subdirectory + "/" + File_Name)
+
+# Run all ROMs in parallel, each runner process has its own interpreter instance
+Key_Scripts = { ROM_Path: Golden_Results[ROM_Path][0] if ROM_Path in Golden_Results else Default_Key_Script for ROM_Path in ROM_Paths }
+if Is_Decode_Cache_Comparison_Enabled: Compare_Decode_Cache_Traces(Key_Scripts)
+with concurrent.futures.ThreadPoolExecutor(max_workers = os.cpu_count()) as Executor:
+	if Is_Recompiler_Enabled:
+		with tempfile.TemporaryDirectory() as Runners_Directory:
+			Futures = { ROM_Path: Executor.submit(Run_Recompiled_ROM, Runners_Directory, ROM_Path, Key_Scripts[ROM_Path]) for ROM_Path in ROM_Paths }
+			Results = { ROM_Path: Future.result() for ROM_Path, Future in Futures.items() }
+	else:
+		Futures = { ROM_Path: Executor.submit(Run_ROM, Runner, ROM_Path, Key_Scripts[ROM_Path]) for ROM_Path in ROM_Paths }
+		Results = { ROM_Path: Future.result() for ROM_Path, Future in Futures.items() }
+
+# Record the new golden results
+if Is_Update_Enabled:
+	with open(Golden_File, "w") as File:
+		File.write("# ROM path|Key script|Result|Frame buffer hashes (generated by Regression_Test.py -u)\n")
+		for ROM_Path in ROM_Paths:
+			Result, Hashes = Results[ROM_Path]
+			File.write("|".join([ ROM_Path, Key_Scripts[ROM_Path], Result, Hashes ]) + "\n")
+	print("Recorded the golden results of " + str(len(ROM_Paths)) + " ROMs.")
+	sys.exit(0)
+
+# Compare with the golden results
+Failures_Count = 0
+for ROM_Path in ROM_Paths:
+	Result, Hashes = Results[ROM_Path]
+	if ROM_Path not in Golden_Results:
+		print("NEW  " + ROM_Path + " : no golden result (" + Result + ", " + Hashes + ")")
+		Failures_Count += 1
+		continue
+
+	_, Expected_Result, Expected_Hashes = Golden_Results[ROM_Path]
+	if (Result == Expected_Result) and (Hashes == Expected_Hashes): print("PASS " + ROM_Path)
+	else:
+		print("FAIL " + ROM_Path + " : got " + Result + ", " + Hashes + " instead of " + Expected_Result + ", " + Expected_Hashes)
+		Failures_Count += 1
+
+print(str(len(ROM_Paths) - Failures_Count) + "/" + str(len(ROM_Paths)) + " ROMs passed.")
+if Failures_Count > 0: sys.exit(1)
@@ -0,0 +1,106 @@
+#!/usr/bin/env python3
+# Generate the tuning database the interpreter looks the loaded ROMs up in (see Software/Includes/Interpreter_Tuning_Database.h), from SD card directories containing a CONFIG.INI file and the ROM files it references.
+# "Tuning_Database.py build [Directory...]" writes Software/Sources/Interpreter_Tuning_Database.c with the settings of all games of these directories (all SD card directories of the Programs directory by default), then rebuild the firmware.
+# "Tuning_Database.py hash ROM_File" prints the hash the interpreter computes for a ROM file, it is also displayed in the interpreter log.
+# A ROM configured with different settings in several places (like the test ROMs run with each quirk) is left out of the database, as are the games using only the default settings.
+import glob
+import os
+import sys
+
+Script_Directory = os.path.dirname(os.path.abspath(__file__))
+Programs_Directory = os.path.join(Script_Directory, "..", "Programs")
+Database_File = os.path.join(Script_Directory, "..", "Software", "Sources", "Interpreter_Tuning_Database.c")
+# The interpreter memory available to the program
+Maximum_ROM_Size = 4096 - 0x200
+
+# The INI keys of the on/off settings and their INTERPRETER_TUNING_DATABASE_SETTING_xxx flag
+Flag_Keys = { "FastRendering": "FAST_RENDERING", "DisplayWrapping": "DISPLAY_WRAPPING", "MemoryLoadStoreIncrement": "MEMORY_LOAD_STORE_INCREMENT", "ShiftUsingVy": "SHIFT_USING_VY", "ResetVF": "VF_RESET" }
+
+# Compute the 32-bit FNV-1a hash of the ROM content the interpreter loads
+def Hash_ROM(ROM):
+	Hash = 2166136261
+	for Byte in ROM[:Maximum_ROM_Size]:
+		Hash ^= Byte
+		Hash = (Hash * 16777619) & 0xFFFFFFFF
+	return Hash
+
+# Return the key/value pairs of each section of an INI file
+def Read_INI_Sections(File_Name):
+	Sections = []
+	with open(File_Name, "r", errors = "replace") as File:
+		for Line in File:
+			Line = Line.strip()
+			if Line.startswith("["): Sections.append({})
+			elif ("=" in Line) and (len(Sections) > 0):
+				Key, Value = Line.split("=", 1)
+				Sections[-1][Key.strip()] = Value.strip()
+	return Sections
+
+# Convert a game section to the database settings, the same way InterpreterLoadProgramFromFile() reads them
+def Get_Settings(Section):
+	Flags = [ Flag for Key, Flag in Flag_Keys.items() if int(Section.get(Key, "0"), 0) != 0 ]
+	Rendering_Delay = int(Section.get("RenderingDelay", "0"), 0)
+	# The rendering delay is done by the fast rendering code
+	if ("RenderingDelay" in Section) and ("FAST_RENDERING" not in Flags): Flags.insert(0, "FAST_RENDERING")
+	return (tuple(Flags), Rendering_Delay, int(Section.get("InstructionsPerFrame", "0"), 0))
+
+def Build(Directories):
+	# Gather the settings of each ROM, keyed by its hash and size
+	Entries = {}
+	Conflicting_Keys = set()
+	for Directory in Directories:
+		for Section in Read_INI_Sections(os.path.join(Directory, "CONFIG.INI")):
+			if "ROMFile" not in Section: continue
+			ROM_File_Name = os.path.join(Directory, Section["ROMFile"])
+			if not os.path.isfile(ROM_File_Name):
+				print("Warning : the ROM file " + os.path.normpath(ROM_File_Name) + " does not exist, skipping it.")
+				continue
+			with open(ROM_File_Name, "rb") as File:
+				ROM = File.read()[:Maximum_ROM_Size]
+			Key = (Hash_ROM(ROM), len(ROM))
+			Settings = Get_Settings(Section)
+			if (Key in Entries) and (Entries[Key][1] != Settings):
+				print("Warning : the ROM " + os.path.normpath(ROM_File_Name) + " is configured with different settings than " + os.path.normpath(Entries[Key][0]) + ", leaving it out.")
+				Conflicting_Keys.add(Key)
+			elif Key not in Entries: Entries[Key] = (ROM_File_Name, Settings)
+	Default_Settings = ((), 0, 0)
+	Entries = { Key: Entry for Key, Entry in Entries.items() if (Key not in Conflicting_Keys) and (Entry[1] != Default_Settings) }
+	if len(Entries) == 0:
+		print("Error : no game needs other settings than the default ones.")
+		sys.exit(1)
+	if len(Entries) > 255:
+		print("Error : the database can't contain more than 255 entries.")
+		sys.exit(1)
+
+	# Generate the database source file
+	with open(Database_File, "w") as File:
+		File.write("/** @file Interpreter_Tuning_Database.c\n")
+		File.write(" * See Interpreter_Tuning_Database.h for description. This file is generated by the Tools/Tuning_Database.py script, do not edit it.\n")
+		File.write(" * @author Adrien RICCIARDI\n")
+		File.write(" */\n")
+		File.write("#include <Interpreter_Tuning_Database.h>\n\n")
+		File.write("//-------------------------------------------------------------------------------------------------\n")
+		File.write("// Public variables\n")
+		File.write("//-------------------------------------------------------------------------------------------------\n")
+		File.write("const TInterpreterTuningDatabaseEntry Interpreter_Tuning_Database[] =\n{\n")
+		for (Hash, Size), (ROM_File_Name, (Flags, Rendering_Delay, Instructions_Per_Frame)) in sorted(Entries.items(), key = lambda Item: Item[1][0]):
+			Mask = " | ".join([ "INTERPRETER_TUNING_DATABASE_SETTING_" + Flag for Flag in Flags ]) if len(Flags) > 0 else "0"
+			File.write("\t// {}\n".format(os.path.relpath(ROM_File_Name, Programs_Directory)))
+			File.write("\t{{ 0x{:08X}UL, {}, {}, {}, {} }},\n".format(Hash, Size, Mask, Rendering_Delay, Instructions_Per_Frame))
+		File.write("};\n\n")
+		File.write("const unsigned char Interpreter_Tuning_Database_Entries_Count = sizeof(Interpreter_Tuning_Database) / sizeof(Interpreter_Tuning_Database[0]);\n")
+	print("Wrote " + str(len(Entries)) + " games settings to " + os.path.normpath(Database_File) + ".")
+
+# Parse the command line
+if (len(sys.argv) >= 2) and (sys.argv[1] == "build"):
+	Directories = sys.argv[2:]
+	if len(Directories) == 0: Directories = sorted(os.path.dirname(Path) for Path in glob.glob(os.path.join(Programs_Directory, "*", "CONFIG.INI")))
+	Build(Directories)
+elif (len(sys.argv) == 3) and (sys.argv[1] == "hash"):
+	with open(sys.argv[2], "rb") as File:
+		ROM = File.read()[:Maximum_ROM_Size]
+	print("ROM hash : 0x{:08X}, size : {} bytes.".format(Hash_ROM(ROM), len(ROM)))
+else:
+	print("Usage : " + sys.argv[0] + " build [Directory...]")
+	print("        " + sys.argv[0] + " hash ROM_File")
+	sys.exit(1)